@@ -34,6 +34,8 @@ NFD_LOG_INIT("FaceTable");
 FaceTable::FaceTable(Forwarder& forwarder)
   : m_forwarder(forwarder)
   , m_lastFaceId(FACEID_RESERVED_MAX)
+  , m_faces(FACEID_RESERVED_MAX + 1)
+  , m_nFaces(0)
 {
 }
 
@@ -42,23 +44,10 @@ FaceTable::~FaceTable()
 
 }
 
-shared_ptr<Face>
-FaceTable::get(FaceId id) const
-{
-  std::map<FaceId, shared_ptr<Face> >::const_iterator i = m_faces.find(id);
-  return (i == m_faces.end()) ? (shared_ptr<Face>()) : (i->second);
-}
-
-size_t
-FaceTable::size() const
-{
-  return m_faces.size();
-}
-
 void
 FaceTable::add(shared_ptr<Face> face)
 {
-  if (face->getId() != INVALID_FACEID && m_faces.count(face->getId()) > 0) {
+  if (face->getId() != INVALID_FACEID && this->get(face->getId()) != nullptr) {
     NFD_LOG_WARN("Trying to add existing face id=" << face->getId() << " to the face table");
     return;
   }
@@ -72,8 +61,8 @@ void
 FaceTable::addReserved(shared_ptr<Face> face, FaceId faceId)
 {
   BOOST_ASSERT(face->getId() == INVALID_FACEID);
-  BOOST_ASSERT(m_faces.count(face->getId()) == 0);
   BOOST_ASSERT(faceId <= FACEID_RESERVED_MAX);
+  BOOST_ASSERT(this->get(faceId) == nullptr);
   this->addImpl(face, faceId);
 }
 
@@ -81,7 +70,11 @@ void
 FaceTable::addImpl(shared_ptr<Face> face, FaceId faceId)
 {
   face->setId(faceId);
+  if (static_cast<size_t>(faceId) >= m_faces.size()) {
+    m_faces.resize(faceId + 1);
+  }
   m_faces[faceId] = face;
+  ++m_nFaces;
   NFD_LOG_INFO("Added face id=" << faceId << " remote=" << face->getRemoteUri()
                                           << " local=" << face->getLocalUri());
 
@@ -101,7 +94,8 @@ FaceTable::remove(shared_ptr<Face> face)
   this->onRemove(face);
 
   FaceId faceId = face->getId();
-  m_faces.erase(faceId);
+  m_faces[faceId].reset();
+  --m_nFaces;
   face->setId(INVALID_FACEID);
   NFD_LOG_INFO("Removed face id=" << faceId << " remote=" << face->getRemoteUri() <<
                                                  " local=" << face->getLocalUri());
@@ -120,7 +114,7 @@ FaceTable::remove(shared_ptr<Face> face)
 FaceTable::ForwardRange
 FaceTable::getForwardRange() const
 {
-  return m_faces | boost::adaptors::map_values;
+  return m_faces | boost::adaptors::filtered(IsOccupied());
 }
 
 FaceTable::const_iterator
@@ -27,13 +27,17 @@
 #define NFD_DAEMON_FW_FACE_TABLE_HPP
 
 #include "face/face.hpp"
-#include <boost/range/adaptor/map.hpp>
+#include <boost/range/adaptor/filtered.hpp>
 
 namespace nfd {
 
 class Forwarder;
 
 /** \brief container of all Faces
+ *
+ *  Faces are stored in a dense vector indexed by FaceId.  FaceIds are assigned sequentially
+ *  and never reused, so lookup by FaceId is a bounds check and an array access.  Slots of
+ *  removed faces are left empty and are skipped during enumeration.
  */
 class FaceTable : noncopyable
 {
@@ -58,9 +62,20 @@ public:
   size() const;
 
 public: // enumeration
-  typedef std::map<FaceId, shared_ptr<Face>> FaceMap;
+  typedef std::vector<shared_ptr<Face>> FaceVector;
+
+  /** \brief predicate that skips empty slots in FaceVector
+   */
+  struct IsOccupied
+  {
+    bool
+    operator()(const shared_ptr<Face>& face) const
+    {
+      return face != nullptr;
+    }
+  };
 
-  typedef boost::select_second_const_range<FaceMap> ForwardRange;
+  typedef boost::filtered_range<IsOccupied, const FaceVector> ForwardRange;
 
   /** \brief ForwardIterator for shared_ptr<Face>
    */
@@ -98,9 +113,24 @@ private:
 private:
   Forwarder& m_forwarder;
   FaceId m_lastFaceId;
-  FaceMap m_faces;
+  FaceVector m_faces;
+  size_t m_nFaces;
 };
 
+inline shared_ptr<Face>
+FaceTable::get(FaceId id) const
+{
+  if (id < 0 || static_cast<size_t>(id) >= m_faces.size())
+    return nullptr;
+  return m_faces[id];
+}
+
+inline size_t
+FaceTable::size() const
+{
+  return m_nFaces;
+}
+
 } // namespace nfd
 
 #endif // NFD_DAEMON_FW_FACE_TABLE_HPP
@@ -39,6 +39,7 @@ NFD_LOG_INIT("Forwarder");
 using fw::Strategy;
 
 const Name Forwarder::LOCALHOST_NAME("ndn:/localhost");
+const Name Forwarder::LOCALHOP_NAME("ndn:/localhop");
 
 Forwarder::Forwarder()
   : m_faceTable(*this)
@@ -90,6 +91,12 @@ Forwarder::onIncomingInterest(Face& inFace, Interest& interest)
     return;
   }
 
+  if (m_pintFilter != nullptr && interest.getIsPint() == 1) {
+    // goto incoming PINT pipeline, bypassing PIT
+    this->onIncomingPint(inFace, interest, false);
+    return;
+  }
+
   // PIT insert
   shared_ptr<pit::Entry> pitEntry = m_pit.insert(interest).first;
 
@@ -127,7 +134,12 @@ Forwarder::onIncomingInterest(Face& inFace, Interest& interest)
       match = m_csFromNdnSim->Lookup(interest.shared_from_this());
       csMatch = match.get();
     }
-    if (csMatch != 0) {
+    if (csMatch == 0) {
+      afterCsMiss(interest);
+    }
+    else {
+      afterCsHit(interest, *csMatch);
+
       const_cast<Data*>(csMatch)->setIncomingFaceId(FACEID_CONTENT_STORE);
       // XXX should we lookup PIT for other Interests that also match csMatch?
 
@@ -156,6 +168,13 @@ Forwarder::onIncomingInterest(Face& inFace, Interest& interest)
 
   if (m_usePint && cacheHit) { // mark as pInt, forward along mang
     interest.setIsPint(1);
+
+    if (m_pintFilter != nullptr && pitEntry->getInRecords().empty()) {
+      // nothing else is pending, the PIT entry was needed only for the CS hit
+      m_pit.erase(pitEntry);
+      this->onIncomingPint(inFace, interest, true);
+      return;
+    }
   }
 
   // std::cout << "forwarding " << interest.getName() << std::endl;
@@ -167,13 +186,52 @@ Forwarder::onIncomingInterest(Face& inFace, Interest& interest)
   this->setUnsatisfyTimer(pitEntry);
 
   // FIB lookup
-  shared_ptr<fib::Entry> fibEntry = m_fib.findLongestPrefixMatch(*pitEntry);
+  shared_ptr<fib::Entry> fibEntry = this->findFibEntry(*pitEntry);
 
   // dispatch to strategy
   this->dispatchToStrategy(pitEntry, bind(&Strategy::afterReceiveInterest, _1,
                                           cref(inFace), cref(interest), fibEntry, pitEntry));
 }
 
+void
+Forwarder::onIncomingPint(Face& inFace, const Interest& interest, bool isFromContentStore)
+{
+  // PIT aggregation
+  if (m_pintFilter->add(interest.getName())) {
+    NFD_LOG_DEBUG("onIncomingPint face=" << inFace.getId() <<
+                  " interest=" << interest.getName() << " aggregated");
+    return;
+  }
+
+  // scope control, as pit::Entry::violatesScope with a single InRecord from inFace:
+  // /localhost and /localhop from a non-local face can only go to local faces
+  bool isLocalScope = LOCALHOST_NAME.isPrefixOf(interest.getName()) ||
+    (!inFace.isLocal() && LOCALHOP_NAME.isPrefixOf(interest.getName()));
+
+  // FIB lookup, forward to nexthop with lowest cost except downstream
+  shared_ptr<fib::Entry> fibEntry = m_fib.findLongestPrefixMatch(interest.getName());
+  for (const fib::NextHop& nexthop : fibEntry->getNextHops()) {
+    shared_ptr<Face> outFace = nexthop.getFace();
+    if (outFace->getId() == inFace.getId())
+      continue;
+
+    if (isLocalScope && !outFace->isLocal())
+      continue;
+
+    NFD_LOG_DEBUG("onIncomingPint face=" << inFace.getId() <<
+                  " interest=" << interest.getName() << " to=" << outFace->getId());
+    outFace->sendInterest(interest);
+    ++m_counters.getNOutInterests();
+
+    m_strategyChoice.findEffectiveStrategy(interest.getName())
+      .afterForwardPint(inFace, interest, fibEntry, *outFace, isFromContentStore);
+    return;
+  }
+
+  NFD_LOG_DEBUG("onIncomingPint face=" << inFace.getId() <<
+                " interest=" << interest.getName() << " noNextHop");
+}
+
 void
 Forwarder::onInterestLoop(Face& inFace, Interest& interest,
                           shared_ptr<pit::Entry> pitEntry)
@@ -36,6 +36,7 @@
 #include "table/measurements.hpp"
 #include "table/strategy-choice.hpp"
 #include "table/dead-nonce-list.hpp"
+#include "table/pint-filter.hpp"
 
 #include "ns3/ndnSIM/model/cs/ndn-content-store.hpp"
 #include "ns3/nstime.h"
@@ -73,6 +74,21 @@ public:
   void
   setUsePint(bool usePint);
 
+  /** \brief forward PINTs without PIT state, aggregating them with the PINT filter
+   *
+   *  PINTs (including Interests turned into PINTs by a CS hit) go to the lowest-cost next hop
+   *  other than the incoming face that does not violate scope, without PIT entry or unsatisfy
+   *  timer.  The strategy does not choose the next hop; it is informed of forwarded PINTs
+   *  through Strategy::afterForwardPint.
+   *
+   *  \param pintFilter the filter, or nullptr to forward PINTs through PIT (default)
+   */
+  void
+  setPintFilter(shared_ptr<PintFilter> pintFilter);
+
+  shared_ptr<PintFilter>
+  getPintFilter() const;
+
 public: // faces
   FaceTable&
   getFaceTable();
@@ -134,12 +150,31 @@ public:
    */
   signal::Signal<Forwarder, pit::Entry> beforeExpirePendingInterest;
 
+  /** \brief trigger after ContentStore lookup found matching Data
+   *
+   *  Triggered with either NFD or ndnSIM ContentStore
+   */
+  signal::Signal<Forwarder, Interest, Data> afterCsHit;
+
+  /** \brief trigger after ContentStore lookup found no matching Data
+   *
+   *  Triggered with either NFD or ndnSIM ContentStore
+   */
+  signal::Signal<Forwarder, Interest> afterCsMiss;
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE: // pipelines
   /** \brief incoming Interest pipeline
    */
   VIRTUAL_WITH_TESTS void
   onIncomingInterest(Face& inFace, Interest& interest);
 
+  /** \brief incoming PINT pipeline, used with the PINT filter
+   *  \param isFromContentStore whether the Interest became a PINT because of a hit
+   *         in this forwarder's ContentStore
+   */
+  VIRTUAL_WITH_TESTS void
+  onIncomingPint(Face& inFace, const Interest& interest, bool isFromContentStore);
+
   /** \brief Interest loop pipeline
    */
   VIRTUAL_WITH_TESTS void
@@ -215,6 +250,20 @@ PROTECTED_WITH_TESTS_ELSE_PRIVATE:
   dispatchToStrategy(shared_ptr<pit::Entry> pitEntry, Function trigger);
 #endif
 
+  /** \brief get effective strategy of pitEntry
+   *
+   *  The strategy is cached on pitEntry until StrategyChoice changes
+   */
+  fw::Strategy&
+  findEffectiveStrategy(pit::Entry& pitEntry);
+
+  /** \brief get FIB entry for pitEntry (longest prefix match)
+   *
+   *  The FIB entry is cached on pitEntry until FIB entries are inserted or erased
+   */
+  shared_ptr<fib::Entry>
+  findFibEntry(pit::Entry& pitEntry);
+
 private:
   ForwarderCounters m_counters;
 
@@ -236,12 +285,14 @@ private:
   ns3::Ptr<ns3::ndn::ContentStore> m_csFromNdnSim;
 
   static const Name LOCALHOST_NAME;
+  static const Name LOCALHOP_NAME;
 
   // allow Strategy (base class) to enter pipelines
   friend class fw::Strategy;
 
   ForwardingDelayCallback m_forwardingDelayCallback;
   bool m_usePint = true;
+  shared_ptr<PintFilter> m_pintFilter;
 };
 
 inline const ForwarderCounters&
@@ -341,6 +392,18 @@ Forwarder::setUsePint(bool usePint)
   m_usePint = usePint;
 }
 
+inline void
+Forwarder::setPintFilter(shared_ptr<PintFilter> pintFilter)
+{
+  m_pintFilter = pintFilter;
+}
+
+inline shared_ptr<PintFilter>
+Forwarder::getPintFilter() const
+{
+  return m_pintFilter;
+}
+
 #ifdef WITH_TESTS
 inline void
 Forwarder::dispatchToStrategy(shared_ptr<pit::Entry> pitEntry, function<void(fw::Strategy*)> trigger)
@@ -350,10 +413,32 @@ inline void
 Forwarder::dispatchToStrategy(shared_ptr<pit::Entry> pitEntry, Function trigger)
 #endif
 {
-  fw::Strategy& strategy = m_strategyChoice.findEffectiveStrategy(*pitEntry);
+  fw::Strategy& strategy = this->findEffectiveStrategy(*pitEntry);
   trigger(&strategy);
 }
 
+inline fw::Strategy&
+Forwarder::findEffectiveStrategy(pit::Entry& pitEntry)
+{
+  fw::Strategy* strategy = pitEntry.getCachedStrategy(m_strategyChoice.getGeneration());
+  if (strategy == nullptr) {
+    strategy = &m_strategyChoice.findEffectiveStrategy(pitEntry);
+    pitEntry.setCachedStrategy(*strategy, m_strategyChoice.getGeneration());
+  }
+  return *strategy;
+}
+
+inline shared_ptr<fib::Entry>
+Forwarder::findFibEntry(pit::Entry& pitEntry)
+{
+  shared_ptr<fib::Entry> fibEntry = pitEntry.getCachedFibEntry(m_fib.getGeneration());
+  if (fibEntry == nullptr) {
+    fibEntry = m_fib.findLongestPrefixMatch(pitEntry);
+    pitEntry.setCachedFibEntry(fibEntry, m_fib.getGeneration());
+  }
+  return fibEntry;
+}
+
 // #ifdef WITH_TESTS
 // inline void
 // Forwarder::dispatchToStrategyByName(shared_ptr<Name> name, function<void(fw::Strategy*)> trigger)
@@ -0,0 +1,332 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014,  Regents of the University of California,
+ *                      Arizona Board of Regents,
+ *                      Colorado State University,
+ *                      University Pierre & Marie Curie, Sorbonne University,
+ *                      Washington University in St. Louis,
+ *                      Beijing Institute of Technology,
+ *                      The University of Memphis
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pint-adaptive-strategy.hpp"
+#include "core/logger.hpp"
+
+namespace nfd {
+namespace fw {
+
+NFD_LOG_INIT("PintAdaptiveStrategy");
+
+const Name PintAdaptiveStrategy::STRATEGY_NAME("ndn:/localhost/nfd/strategy/pint-adaptive/%FD%01");
+const double PintAdaptiveStrategy::EWMA_ALPHA = 0.125;
+const double PintAdaptiveStrategy::MIN_SCORE = 0.1;
+const time::nanoseconds PintAdaptiveStrategy::MEASUREMENTS_LIFETIME = time::seconds(16);
+const time::milliseconds PintAdaptiveStrategy::MIN_RETRANSMISSION_INTERVAL(100);
+
+PintAdaptiveStrategy::PintAdaptiveStrategy(Forwarder& forwarder, const Name& name)
+  : Strategy(forwarder, name)
+{
+}
+
+/** \brief determines whether a NextHop is eligible
+ *  \param currentDownstream incoming FaceId of current Interest
+ *  \param wantUnused if true, NextHop must not have unexpired OutRecord
+ *  \param now time::steady_clock::now(), ignored if !wantUnused
+ */
+static inline bool
+predicate_NextHop_eligible(const shared_ptr<pit::Entry>& pitEntry,
+  const fib::NextHop& nexthop, FaceId currentDownstream,
+  bool wantUnused = false,
+  time::steady_clock::TimePoint now = time::steady_clock::TimePoint::min())
+{
+  shared_ptr<Face> upstream = nexthop.getFace();
+
+  // upstream is current downstream
+  if (upstream->getId() == currentDownstream)
+    return false;
+
+  // forwarding would violate scope
+  if (pitEntry->violatesScope(*upstream))
+    return false;
+
+  if (wantUnused) {
+    // NextHop must not have unexpired OutRecord
+    pit::OutRecordCollection::const_iterator outRecord = pitEntry->getOutRecord(*upstream);
+    if (outRecord != pitEntry->getOutRecords().end() &&
+        outRecord->getExpiry() > now) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static inline bool
+compare_OutRecord_lastRenewed(const pit::OutRecord& a, const pit::OutRecord& b)
+{
+  return a.getLastRenewed() < b.getLastRenewed();
+}
+
+void
+PintAdaptiveStrategy::afterReceiveInterest(const Face& inFace,
+                                           const Interest& interest,
+                                           shared_ptr<fib::Entry> fibEntry,
+                                           shared_ptr<pit::Entry> pitEntry)
+{
+  const fib::NextHopList& nexthops = fibEntry->getNextHops();
+  bool isPint = interest.getIsPint() == 1;
+  bool isNewPitEntry = !pitEntry->hasUnexpiredOutRecords();
+
+  shared_ptr<PitEntryInfo> pitEntryInfo = pitEntry->getOrCreateStrategyInfo<PitEntryInfo>();
+  // an Interest marked as PINT by this forwarder's ContentStore was a miss downstream
+  bool isDownstreamHit = isPint && !pitEntryInfo->isSatisfiedByCs;
+  pitEntryInfo->isSatisfiedByCs = false;
+
+  shared_ptr<MeasurementsEntryInfo> measurementsEntryInfo;
+  shared_ptr<measurements::Entry> measurementsEntry =
+    this->getPrefixMeasurements(*fibEntry, pitEntry->getName());
+  if (static_cast<bool>(measurementsEntry)) {
+    this->getMeasurements().extendLifetime(*measurementsEntry, MEASUREMENTS_LIFETIME);
+    measurementsEntryInfo = this->getMeasurementsEntryInfo(*measurementsEntry);
+    pitEntryInfo->measurementsEntry = measurementsEntry;
+  }
+
+  if (isPint) {
+    // PINT is accounting feedback for the producer: follow the lowest-cost nexthop
+    fib::NextHopList::const_iterator it = std::find_if(nexthops.begin(), nexthops.end(),
+      bind(&predicate_NextHop_eligible, pitEntry, _1, inFace.getId(),
+           false, time::steady_clock::TimePoint::min()));
+    if (it == nexthops.end()) {
+      NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " pint noNextHop");
+      if (isNewPitEntry) {
+        this->rejectPendingInterest(pitEntry);
+      }
+      return;
+    }
+
+    this->sendInterest(pitEntry, it->getFace());
+    if (static_cast<bool>(measurementsEntryInfo)) {
+      measurementsEntryInfo->recordHit(it->getFace()->getId(), isDownstreamHit);
+    }
+    NFD_LOG_DEBUG(interest << " from=" << inFace.getId()
+                           << " pint-to=" << it->getFace()->getId());
+    return;
+  }
+
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+  if (!isNewPitEntry) {
+    // when was the last outgoing Interest?
+    const pit::OutRecordCollection& outRecords = pitEntry->getOutRecords();
+    pit::OutRecordCollection::const_iterator lastOutgoing = std::max_element(
+      outRecords.begin(), outRecords.end(), &compare_OutRecord_lastRenewed);
+    BOOST_ASSERT(lastOutgoing != outRecords.end()); // otherwise it's new PIT entry
+
+    if (now - lastOutgoing->getLastRenewed() < MIN_RETRANSMISSION_INTERVAL) {
+      NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " dontRetransmit");
+      return;
+    }
+  }
+
+  // retransmissions are only sent to nexthops that are not used yet
+  fib::NextHopList::const_iterator best = pickNextHop(nexthops, measurementsEntryInfo.get(),
+    bind(&predicate_NextHop_eligible, pitEntry, _1, inFace.getId(), !isNewPitEntry, now));
+  if (best == nexthops.end()) {
+    if (isNewPitEntry) {
+      NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " noNextHop");
+      this->rejectPendingInterest(pitEntry);
+    }
+    else {
+      NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " retransmit-noUnusedNextHop");
+    }
+    return;
+  }
+
+  shared_ptr<Face> outFace = best->getFace();
+  this->sendInterest(pitEntry, outFace);
+  double score = 0.0;
+  if (static_cast<bool>(measurementsEntryInfo)) {
+    score = measurementsEntryInfo->getScore(outFace->getId());
+    measurementsEntryInfo->recordHit(outFace->getId(), false);
+  }
+  NFD_LOG_DEBUG(interest << " from=" << inFace.getId()
+                         << (isNewPitEntry ? " newPitEntry-to=" : " retransmit-to=")
+                         << outFace->getId() << " score=" << score);
+}
+
+void
+PintAdaptiveStrategy::beforeSatisfyInterest(shared_ptr<pit::Entry> pitEntry,
+                                            const Face& inFace, const Data& data)
+{
+  if (inFace.getId() == FACEID_CONTENT_STORE) {
+    // the Interest being processed will be marked as PINT by the forwarder
+    pitEntry->getOrCreateStrategyInfo<PitEntryInfo>()->isSatisfiedByCs = true;
+    return;
+  }
+
+  shared_ptr<PitEntryInfo> pitEntryInfo = pitEntry->getStrategyInfo<PitEntryInfo>();
+  if (!static_cast<bool>(pitEntryInfo)) {
+    return;
+  }
+
+  shared_ptr<measurements::Entry> measurementsEntry = pitEntryInfo->measurementsEntry.lock();
+  if (!static_cast<bool>(measurementsEntry)) {
+    return;
+  }
+
+  this->getMeasurements().extendLifetime(*measurementsEntry, MEASUREMENTS_LIFETIME);
+  this->getMeasurementsEntryInfo(*measurementsEntry)->recordDelivery(inFace.getId(), true);
+}
+
+void
+PintAdaptiveStrategy::beforeExpirePendingInterest(shared_ptr<pit::Entry> pitEntry)
+{
+  shared_ptr<PitEntryInfo> pitEntryInfo = pitEntry->getStrategyInfo<PitEntryInfo>();
+  if (!static_cast<bool>(pitEntryInfo) || !hasRegularInRecord(*pitEntry)) {
+    // producers do not answer PINTs, so their expiration is not a delivery failure
+    return;
+  }
+
+  shared_ptr<measurements::Entry> measurementsEntry = pitEntryInfo->measurementsEntry.lock();
+  if (!static_cast<bool>(measurementsEntry)) {
+    return;
+  }
+
+  shared_ptr<MeasurementsEntryInfo> measurementsEntryInfo =
+    this->getMeasurementsEntryInfo(*measurementsEntry);
+  const pit::OutRecordCollection& outRecords = pitEntry->getOutRecords();
+  for (pit::OutRecordCollection::const_iterator it = outRecords.begin();
+       it != outRecords.end(); ++it) {
+    measurementsEntryInfo->recordDelivery(it->getFace()->getId(), false);
+  }
+}
+
+void
+PintAdaptiveStrategy::afterForwardPint(const Face& inFace, const Interest& interest,
+                                       shared_ptr<fib::Entry> fibEntry, const Face& outFace,
+                                       bool isFromContentStore)
+{
+  shared_ptr<measurements::Entry> measurementsEntry =
+    this->getPrefixMeasurements(*fibEntry, interest.getName());
+  if (!static_cast<bool>(measurementsEntry)) {
+    return;
+  }
+
+  this->getMeasurements().extendLifetime(*measurementsEntry, MEASUREMENTS_LIFETIME);
+  // a PINT marked by this forwarder's ContentStore was a miss downstream
+  this->getMeasurementsEntryInfo(*measurementsEntry)->recordHit(outFace.getId(),
+                                                                !isFromContentStore);
+  NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " pint-forwarded-to=" << outFace.getId());
+}
+
+shared_ptr<measurements::Entry>
+PintAdaptiveStrategy::getPrefixMeasurements(const fib::Entry& fibEntry,
+                                            const Name& interestName)
+{
+  shared_ptr<measurements::Entry> entry = this->getMeasurements().get(fibEntry);
+  if (static_cast<bool>(entry)) {
+    return entry;
+  }
+
+  // FIB prefix (e.g., default route) is shorter than the strategy namespace
+  return this->getMeasurements().get(interestName.getPrefix(interestName.size() > 0 ? -1 : 0));
+}
+
+shared_ptr<PintAdaptiveStrategy::MeasurementsEntryInfo>
+PintAdaptiveStrategy::getMeasurementsEntryInfo(measurements::Entry& entry)
+{
+  return entry.getOrCreateStrategyInfo<MeasurementsEntryInfo>();
+}
+
+fib::NextHopList::const_iterator
+PintAdaptiveStrategy::pickNextHop(const fib::NextHopList& nexthops,
+                                  const MeasurementsEntryInfo* measurementsEntryInfo,
+                                  const function<bool(const fib::NextHop&)>& isEligible)
+{
+  fib::NextHopList::const_iterator lowestCost = nexthops.end();
+  fib::NextHopList::const_iterator best = nexthops.end();
+  double bestScore = MIN_SCORE;
+  for (fib::NextHopList::const_iterator it = nexthops.begin(); it != nexthops.end(); ++it) {
+    if (!isEligible(*it))
+      continue;
+
+    if (lowestCost == nexthops.end())
+      lowestCost = it;
+
+    if (measurementsEntryInfo != nullptr) {
+      double score = measurementsEntryInfo->getScore(it->getFace()->getId());
+      if (score > bestScore || (score == bestScore && best == nexthops.end())) {
+        best = it;
+        bestScore = score;
+      }
+    }
+  }
+
+  return best != nexthops.end() ? best : lowestCost;
+}
+
+bool
+PintAdaptiveStrategy::hasRegularInRecord(const pit::Entry& pitEntry)
+{
+  // the forwarder marks an Interest satisfied by its ContentStore as PINT before inserting
+  // the in-record, so a regular in-record is one still waiting for Data
+  const pit::InRecordCollection& inRecords = pitEntry.getInRecords();
+  for (pit::InRecordCollection::const_iterator it = inRecords.begin();
+       it != inRecords.end(); ++it) {
+    if (it->getInterest().getIsPint() != 1) {
+      return true;
+    }
+  }
+  return false;
+}
+
+PintAdaptiveStrategy::MeasurementsEntryInfo::FaceInfo::FaceInfo()
+  : hitRate(0.0)
+  , deliveryRate(1.0)
+{
+}
+
+void
+PintAdaptiveStrategy::MeasurementsEntryInfo::recordHit(FaceId face, bool isHit)
+{
+  double& hitRate = faces[face].hitRate;
+  hitRate += EWMA_ALPHA * ((isHit ? 1.0 : 0.0) - hitRate);
+}
+
+void
+PintAdaptiveStrategy::MeasurementsEntryInfo::recordDelivery(FaceId face, bool isDelivered)
+{
+  double& deliveryRate = faces[face].deliveryRate;
+  deliveryRate += EWMA_ALPHA * ((isDelivered ? 1.0 : 0.0) - deliveryRate);
+}
+
+double
+PintAdaptiveStrategy::MeasurementsEntryInfo::getScore(FaceId face) const
+{
+  std::map<FaceId, FaceInfo>::const_iterator it = faces.find(face);
+  if (it == faces.end()) {
+    return 0.0;
+  }
+  return it->second.hitRate * it->second.deliveryRate;
+}
+
+PintAdaptiveStrategy::PitEntryInfo::PitEntryInfo()
+  : isSatisfiedByCs(false)
+{
+}
+
+} // namespace fw
+} // namespace nfd
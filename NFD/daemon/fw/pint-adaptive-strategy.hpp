@@ -0,0 +1,175 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014,  Regents of the University of California,
+ *                      Arizona Board of Regents,
+ *                      Colorado State University,
+ *                      University Pierre & Marie Curie, Sorbonne University,
+ *                      Washington University in St. Louis,
+ *                      Beijing Institute of Technology,
+ *                      The University of Memphis
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_PINT_ADAPTIVE_STRATEGY_HPP
+#define NFD_DAEMON_FW_PINT_ADAPTIVE_STRATEGY_HPP
+
+#include "strategy.hpp"
+
+#include <map>
+
+namespace nfd {
+namespace fw {
+
+/** \brief a forwarding strategy that learns from PINT accounting feedback
+ *
+ *  A forwarder that satisfies an Interest from its ContentStore marks the Interest as PINT
+ *  and forwards it upstream for accounting.  Therefore, a PINT means a cache downstream
+ *  holds content under the prefix, while a regular Interest means those caches have missed.
+ *  The samples are recorded under the upstream face the Interest is forwarded to.
+ *
+ *  For every prefix, this strategy keeps per-upstream-face measurements:
+ *  - hit rate: exponentially weighted average of PINT (1) vs regular Interest (0) forwarded
+ *    to the face, where PINTs marked by this forwarder's own ContentStore count as regular,
+ *  - delivery rate: exponentially weighted average of Data (1) vs timeout (0) on the face.
+ *
+ *  A new regular Interest is forwarded to the eligible nexthop with the highest
+ *  hit rate * delivery rate, if it is at least MIN_SCORE; otherwise, it is forwarded
+ *  to the lowest-cost eligible nexthop like BestRouteStrategy2.
+ *  PINT Interests always follow the lowest-cost nexthop, so that they reach the producer;
+ *  the forwarder may forward them without PIT entries (see Forwarder::setPintFilter),
+ *  in which case they are recorded in afterForwardPint.
+ *  A regular Interest retransmitted after MIN_RETRANSMISSION_INTERVAL is forwarded
+ *  to the best nexthop that is not used yet.
+ */
+class PintAdaptiveStrategy : public Strategy
+{
+public:
+  PintAdaptiveStrategy(Forwarder& forwarder, const Name& name = STRATEGY_NAME);
+
+  virtual void
+  afterReceiveInterest(const Face& inFace,
+                       const Interest& interest,
+                       shared_ptr<fib::Entry> fibEntry,
+                       shared_ptr<pit::Entry> pitEntry) DECL_OVERRIDE;
+
+  virtual void
+  beforeSatisfyInterest(shared_ptr<pit::Entry> pitEntry,
+                        const Face& inFace, const Data& data) DECL_OVERRIDE;
+
+  virtual void
+  beforeExpirePendingInterest(shared_ptr<pit::Entry> pitEntry) DECL_OVERRIDE;
+
+  virtual void
+  afterForwardPint(const Face& inFace, const Interest& interest,
+                   shared_ptr<fib::Entry> fibEntry, const Face& outFace,
+                   bool isFromContentStore) DECL_OVERRIDE;
+
+protected:
+  /// StrategyInfo on measurements::Entry
+  class MeasurementsEntryInfo : public StrategyInfo
+  {
+  public:
+    static constexpr int
+    getTypeId()
+    {
+      return 1010;
+    }
+
+    /// record whether an Interest forwarded to face was a PINT
+    void
+    recordHit(FaceId face, bool isHit);
+
+    /// record whether an Interest forwarded to face has brought Data back
+    void
+    recordDelivery(FaceId face, bool isDelivered);
+
+    /// \return hit rate * delivery rate of face, or 0 if face has no measurements
+    double
+    getScore(FaceId face) const;
+
+  public:
+    struct FaceInfo
+    {
+      FaceInfo();
+
+      double hitRate;
+      double deliveryRate;
+    };
+
+    std::map<FaceId, FaceInfo> faces;
+  };
+
+  /// StrategyInfo on pit::Entry
+  class PitEntryInfo : public StrategyInfo
+  {
+  public:
+    static constexpr int
+    getTypeId()
+    {
+      return 1011;
+    }
+
+    PitEntryInfo();
+
+  public:
+    /// Measurements entry of the prefix, used by Data and timeout triggers
+    weak_ptr<measurements::Entry> measurementsEntry;
+    /// whether the last incoming Interest was satisfied by this forwarder's ContentStore
+    bool isSatisfiedByCs;
+  };
+
+protected:
+  /** \return Measurements entry for the FIB prefix,
+   *          or for Interest name without last component if the FIB prefix is outside
+   *          of the strategy namespace
+   */
+  shared_ptr<measurements::Entry>
+  getPrefixMeasurements(const fib::Entry& fibEntry, const Name& interestName);
+
+  shared_ptr<MeasurementsEntryInfo>
+  getMeasurementsEntryInfo(measurements::Entry& entry);
+
+  /** \brief ranks nexthops of a regular Interest
+   *  \param measurementsEntryInfo measurements of the prefix, or nullptr if there are none
+   *  \return the eligible nexthop with the highest score if it is at least MIN_SCORE
+   *           (the lowest-cost one among equal scores); otherwise the lowest-cost eligible
+   *           nexthop; nexthops.end() if no nexthop is eligible
+   */
+  static fib::NextHopList::const_iterator
+  pickNextHop(const fib::NextHopList& nexthops,
+              const MeasurementsEntryInfo* measurementsEntryInfo,
+              const function<bool(const fib::NextHop&)>& isEligible);
+
+  /// \return whether any in-record of pitEntry is a regular Interest, i.e., expects Data
+  static bool
+  hasRegularInRecord(const pit::Entry& pitEntry);
+
+public:
+  static const Name STRATEGY_NAME;
+  static const time::milliseconds MIN_RETRANSMISSION_INTERVAL;
+
+protected:
+  /// weight of a new sample in exponentially weighted averages
+  static const double EWMA_ALPHA;
+  /// minimal score for a nexthop to be preferred over the lowest-cost nexthop
+  static const double MIN_SCORE;
+  static const time::nanoseconds MEASUREMENTS_LIFETIME;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_PINT_ADAPTIVE_STRATEGY_HPP
@@ -60,6 +60,15 @@ Strategy::beforeExpirePendingInterest(shared_ptr<pit::Entry> pitEntry)
   NFD_LOG_DEBUG("beforeExpirePendingInterest pitEntry=" << pitEntry->getName());
 }
 
+void
+Strategy::afterForwardPint(const Face& inFace, const Interest& interest,
+                           shared_ptr<fib::Entry> fibEntry, const Face& outFace,
+                           bool isFromContentStore)
+{
+  NFD_LOG_DEBUG("afterForwardPint inFace=" << inFace.getId() <<
+    " interest=" << interest.getName() << " outFace=" << outFace.getId());
+}
+
 //void
 //Strategy::afterAddFibEntry(shared_ptr<fib::Entry> fibEntry)
 //{
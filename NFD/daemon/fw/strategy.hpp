@@ -109,6 +109,22 @@ public: // triggers
   virtual void
   beforeExpirePendingInterest(shared_ptr<pit::Entry> pitEntry);
 
+  /** \brief trigger after PINT is forwarded without PIT entry
+   *
+   *  This trigger is invoked only if the forwarder aggregates PINTs with a PINT filter
+   *  (see Forwarder::setPintFilter).  The forwarder has already sent the PINT to outFace,
+   *  the lowest-cost next hop in fibEntry; the strategy cannot forward it elsewhere.
+   *
+   *  In this base class this method does nothing.
+   *
+   *  \param isFromContentStore whether the Interest became a PINT because of a hit
+   *         in this forwarder's ContentStore
+   */
+  virtual void
+  afterForwardPint(const Face& inFace, const Interest& interest,
+                   shared_ptr<fib::Entry> fibEntry, const Face& outFace,
+                   bool isFromContentStore);
+
 protected: // actions
   /// send Interest to outFace
   VIRTUAL_WITH_TESTS void
@@ -49,6 +49,7 @@ BOOST_CONCEPT_ASSERT((boost::DefaultConstructible<Fib::const_iterator>));
 Fib::Fib(NameTree& nameTree)
   : m_nameTree(nameTree)
   , m_nItems(0)
+  , m_generation(1)
 {
 }
 
@@ -126,6 +127,7 @@ Fib::insert(const Name& prefix)
   entry = make_shared<fib::Entry>(prefix);
   nameTreeEntry->setFibEntry(entry);
   ++m_nItems;
+  ++m_generation;
   return std::make_pair(entry, true);
 }
 
@@ -135,6 +137,7 @@ Fib::erase(shared_ptr<name_tree::Entry> nameTreeEntry)
   nameTreeEntry->setFibEntry(shared_ptr<fib::Entry>());
   m_nameTree.eraseEntryIfEmpty(nameTreeEntry);
   --m_nItems;
+  ++m_generation;
 }
 
 void
@@ -52,6 +52,14 @@ public:
   size_t
   size() const;
 
+  /** \brief returns a number that changes whenever a FIB entry is inserted or erased
+   *
+   *  Result of findLongestPrefixMatch for any name can change only when the generation changes,
+   *  so it can be cached together with the generation.
+   */
+  uint64_t
+  getGeneration() const;
+
 public: // lookup
   /// performs a longest prefix match
   shared_ptr<fib::Entry>
@@ -152,6 +160,7 @@ private:
 private:
   NameTree& m_nameTree;
   size_t m_nItems;
+  uint64_t m_generation;
 
   /** \brief The empty FIB entry.
    *
@@ -168,6 +177,12 @@ Fib::size() const
   return m_nItems;
 }
 
+inline uint64_t
+Fib::getGeneration() const
+{
+  return m_generation;
+}
+
 inline Fib::const_iterator
 Fib::end() const
 {
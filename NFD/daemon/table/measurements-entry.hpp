@@ -57,8 +57,8 @@ private:
   Name m_name;
 
 private: // lifetime
+  /// the entry is reclaimed lazily after this time (see Measurements)
   time::steady_clock::TimePoint m_expiry;
-  EventId m_cleanup;
   shared_ptr<name_tree::Entry> m_nameTreeEntry;
 
   friend class nfd::NameTree;
@@ -30,26 +30,47 @@
 
 namespace nfd {
 
+/// interval between sweeps
+static const time::nanoseconds SWEEP_INTERVAL = time::seconds(1);
+
+/// every entry is visited at least once in this number of sweeps
+static const size_t SWEEP_ROUNDS = 4;
+
+/// minimum number of entries visited in one sweep
+static const size_t SWEEP_MIN_BATCH = 64;
+
 Measurements::Measurements(NameTree& nameTree)
   : m_nameTree(nameTree)
   , m_nItems(0)
+  , m_isSweepScheduled(false)
 {
 }
 
 shared_ptr<measurements::Entry>
 Measurements::get(name_tree::Entry& nte)
 {
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+
   shared_ptr<measurements::Entry> entry = nte.getMeasurementsEntry();
-  if (entry != nullptr)
-    return entry;
+  if (entry != nullptr) {
+    if (entry->m_expiry > now)
+      return entry;
+
+    // expired but not yet reclaimed: replaced by a new entry, as if it was removed on expiry
+    nte.setMeasurementsEntry(nullptr);
+    --m_nItems;
+  }
 
   entry = make_shared<measurements::Entry>(nte.getPrefix());
   nte.setMeasurementsEntry(entry);
   ++m_nItems;
 
-  entry->m_expiry = time::steady_clock::now() + getInitialLifetime();
-  entry->m_cleanup = scheduler::schedule(getInitialLifetime(),
-                                         bind(&Measurements::cleanup, this, ref(*entry)));
+  entry->m_expiry = now + getInitialLifetime();
+
+  m_sweepQueue.push_back(entry);
+  if (!m_isSweepScheduled) {
+    this->scheduleSweep();
+  }
 
   return entry;
 }
@@ -91,8 +112,12 @@ Measurements::getParent(const measurements::Entry& child)
 shared_ptr<measurements::Entry>
 Measurements::findLongestPrefixMatch(const Name& name) const
 {
+  time::steady_clock::TimePoint now = time::steady_clock::now();
   shared_ptr<name_tree::Entry> nte = m_nameTree.findLongestPrefixMatch(name,
-      [] (const name_tree::Entry& nte) { return nte.getMeasurementsEntry() != nullptr; });
+      [now] (const name_tree::Entry& nte) {
+        return nte.getMeasurementsEntry() != nullptr &&
+               nte.getMeasurementsEntry()->m_expiry > now;
+      });
   if (nte != nullptr) {
     return nte->getMeasurementsEntry();
   }
@@ -103,7 +128,8 @@ shared_ptr<measurements::Entry>
 Measurements::findExactMatch(const Name& name) const
 {
   shared_ptr<name_tree::Entry> nte = m_nameTree.lookup(name);
-  if (nte != nullptr)
+  if (nte != nullptr && nte->getMeasurementsEntry() != nullptr &&
+      nte->getMeasurementsEntry()->m_expiry > time::steady_clock::now())
     return nte->getMeasurementsEntry();
   return nullptr;
 }
@@ -119,15 +145,19 @@ Measurements::extendLifetime(measurements::Entry& entry,
     return;
   }
 
-  time::steady_clock::TimePoint expiry = time::steady_clock::now() + lifetime;
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+  if (entry.m_expiry <= now) {
+    // entry has expired and is waiting to be reclaimed
+    return;
+  }
+
+  time::steady_clock::TimePoint expiry = now + lifetime;
   if (entry.m_expiry >= expiry) {
     // has longer lifetime, not extending
     return;
   }
 
-  scheduler::cancel(entry.m_cleanup);
   entry.m_expiry = expiry;
-  entry.m_cleanup = scheduler::schedule(lifetime, bind(&Measurements::cleanup, this, ref(entry)));
 }
 
 void
@@ -141,4 +171,41 @@ Measurements::cleanup(measurements::Entry& entry)
   }
 }
 
+void
+Measurements::sweep()
+{
+  m_isSweepScheduled = false;
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+
+  size_t nVisits = std::max(SWEEP_MIN_BATCH,
+                            (m_sweepQueue.size() + SWEEP_ROUNDS - 1) / SWEEP_ROUNDS);
+  for (size_t i = 0; i < nVisits && !m_sweepQueue.empty(); ++i) {
+    shared_ptr<measurements::Entry> entry = m_sweepQueue.front().lock();
+    m_sweepQueue.pop_front();
+
+    if (entry == nullptr || entry->m_nameTreeEntry == nullptr) {
+      // already replaced by get()
+      continue;
+    }
+
+    if (entry->m_expiry <= now) {
+      this->cleanup(*entry);
+      continue;
+    }
+
+    m_sweepQueue.push_back(entry);
+  }
+
+  if (!m_sweepQueue.empty()) {
+    this->scheduleSweep();
+  }
+}
+
+void
+Measurements::scheduleSweep()
+{
+  m_sweepEvent = scheduler::schedule(SWEEP_INTERVAL, bind(&Measurements::sweep, this));
+  m_isSweepScheduled = true;
+}
+
 } // namespace nfd
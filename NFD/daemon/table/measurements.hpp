@@ -29,6 +29,8 @@
 #include "measurements-entry.hpp"
 #include "name-tree.hpp"
 
+#include <deque>
+
 namespace nfd {
 
 namespace fib {
@@ -42,6 +44,10 @@ class Entry;
 
 /** \class Measurement
  *  \brief represents the Measurements table
+ *
+ *  Entries are not removed exactly at their expiry time.  An expired entry is treated as
+ *  nonexistent by lookups and replaced by get(), and a periodic sweeper visits a portion of
+ *  entries each time to reclaim expired ones, so that no scheduler event is used per entry.
  */
 class Measurements : noncopyable
 {
@@ -97,6 +103,14 @@ private:
   void
   cleanup(measurements::Entry& entry);
 
+  /** \brief reclaim expired entries among a portion of entries
+   */
+  void
+  sweep();
+
+  void
+  scheduleSweep();
+
   shared_ptr<measurements::Entry>
   get(name_tree::Entry& nte);
 
@@ -104,6 +118,11 @@ private:
   NameTree& m_nameTree;
   size_t m_nItems;
   static const time::nanoseconds s_defaultLifetime;
+
+  /// every entry, in order of next visit by the sweeper
+  std::deque<weak_ptr<measurements::Entry>> m_sweepQueue;
+  scheduler::ScopedEventId m_sweepEvent;
+  bool m_isSweepScheduled;
 };
 
 inline time::nanoseconds
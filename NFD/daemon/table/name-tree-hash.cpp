@@ -0,0 +1,145 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014,  Regents of the University of California,
+ *                      Arizona Board of Regents,
+ *                      Colorado State University,
+ *                      University Pierre & Marie Curie, Sorbonne University,
+ *                      Washington University in St. Louis,
+ *                      Beijing Institute of Technology,
+ *                      The University of Memphis
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "name-tree-hash.hpp"
+#include "core/city-hash.hpp"
+
+#include <boost/mpl/if.hpp>
+
+namespace nfd {
+namespace name_tree {
+
+class Hash32
+{
+public:
+  static size_t
+  compute(const char* buffer, size_t length)
+  {
+    return static_cast<size_t>(CityHash32(buffer, length));
+  }
+};
+
+class Hash64
+{
+public:
+  static size_t
+  compute(const char* buffer, size_t length)
+  {
+    return static_cast<size_t>(CityHash64(buffer, length));
+  }
+};
+
+typedef boost::mpl::if_c<sizeof(size_t) >= 8, Hash64, Hash32>::type CityHash;
+
+size_t
+computeComponentHash(const uint8_t* wire, size_t size)
+{
+  return CityHash::compute(reinterpret_cast<const char*>(wire), size);
+}
+
+/**
+ * \brief Read TLV-TYPE or TLV-LENGTH
+ * \return the value of the number; position is moved past it
+ * \throw tlv::Error the number does not fit before end
+ */
+static inline uint64_t
+readTypeOrLength(const uint8_t*& position, const uint8_t* end)
+{
+  if (position >= end)
+    {
+      throw tlv::Error("Name component TLV is truncated");
+    }
+
+  // almost all component types and lengths fit into one octet
+  if (*position < 253)
+    {
+      return *position++;
+    }
+  return tlv::readVarNumber(position, end);
+}
+
+/**
+ * \brief Call func(componentHash) for every component of the name
+ *
+ * Components are located directly in the name's wire encoding, without the parsed elements
+ */
+template<class Function>
+static inline void
+forEachComponentHash(const Name& prefix, const Function& func)
+{
+  const Block& wire = prefix.wireEncode();
+
+  const uint8_t* position = wire.value();
+  const uint8_t* end = wire.value() + wire.value_size();
+  while (position < end)
+    {
+      const uint8_t* component = position;
+      readTypeOrLength(position, end);
+      uint64_t length = readTypeOrLength(position, end);
+      if (length > static_cast<uint64_t>(end - position))
+        {
+          throw tlv::Error("TLV length exceeds buffer length");
+        }
+      position += length;
+
+      func(computeComponentHash(component, position - component));
+    }
+}
+
+size_t
+computeHash(const Name& prefix)
+{
+  size_t hashValue = 0;
+  forEachComponentHash(prefix, [&hashValue] (size_t hashUpdate) {
+      hashValue ^= hashUpdate;
+    });
+  return hashValue;
+}
+
+std::vector<size_t>
+computeHashSet(const Name& prefix)
+{
+  std::vector<size_t> hashValueSet;
+  computeHashSet(prefix, hashValueSet);
+  return hashValueSet;
+}
+
+void
+computeHashSet(const Name& prefix, std::vector<size_t>& hashSet)
+{
+  hashSet.clear();
+  hashSet.reserve(prefix.size() + 1);
+
+  size_t hashValue = 0;
+  hashSet.push_back(hashValue);
+
+  forEachComponentHash(prefix, [&hashValue, &hashSet] (size_t hashUpdate) {
+      hashValue ^= hashUpdate;
+      hashSet.push_back(hashValue);
+    });
+}
+
+} // namespace name_tree
+} // namespace nfd
@@ -0,0 +1,66 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014,  Regents of the University of California,
+ *                      Arizona Board of Regents,
+ *                      Colorado State University,
+ *                      University Pierre & Marie Curie, Sorbonne University,
+ *                      Washington University in St. Louis,
+ *                      Beijing Institute of Technology,
+ *                      The University of Memphis
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_NAME_TREE_HASH_HPP
+#define NFD_DAEMON_TABLE_NAME_TREE_HASH_HPP
+
+#include "common.hpp"
+
+namespace nfd {
+namespace name_tree {
+
+/**
+ * \brief Compute the hash value of a name component's WIRE FORMAT (TLV block)
+ *
+ * The hash value of a name prefix is XOR of hash values of its components
+ */
+size_t
+computeComponentHash(const uint8_t* wire, size_t size);
+
+/**
+ * \brief Compute the hash value of the given name prefix's WIRE FORMAT
+ */
+size_t
+computeHash(const Name& prefix);
+
+/**
+ * \brief Incrementally compute hash values
+ * \return Return a vector of hash values, starting from the root prefix
+ */
+std::vector<size_t>
+computeHashSet(const Name& prefix);
+
+/**
+ * \brief Incrementally compute hash values in one pass over the name's wire encoding
+ * \param[out] hashSet hash values of prefix.size() + 1 prefixes, starting from the root
+ *             prefix; storage of the vector is reused
+ */
+void
+computeHashSet(const Name& prefix, std::vector<size_t>& hashSet);
+
+} // namespace name_tree
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_NAME_TREE_HASH_HPP
@@ -25,7 +25,6 @@
 
 #include "name-tree.hpp"
 #include "core/logger.hpp"
-#include "core/city-hash.hpp"
 
 #include <boost/concept/assert.hpp>
 #include <boost/concept_check.hpp>
@@ -46,73 +45,6 @@ static_assert(std::is_default_constructible<NameTree::const_iterator>::value,
 BOOST_CONCEPT_ASSERT((boost::DefaultConstructible<NameTree::const_iterator>));
 #endif // HAVE_IS_DEFAULT_CONSTRUCTIBLE
 
-namespace name_tree {
-
-class Hash32
-{
-public:
-  static size_t
-  compute(const char* buffer, size_t length)
-  {
-    return static_cast<size_t>(CityHash32(buffer, length));
-  }
-};
-
-class Hash64
-{
-public:
-  static size_t
-  compute(const char* buffer, size_t length)
-  {
-    return static_cast<size_t>(CityHash64(buffer, length));
-  }
-};
-
-typedef boost::mpl::if_c<sizeof(size_t) >= 8, Hash64, Hash32>::type CityHash;
-
-// Interface of different hash functions
-size_t
-computeHash(const Name& prefix)
-{
-  prefix.wireEncode();  // guarantees prefix's wire buffer is not empty
-
-  size_t hashValue = 0;
-  size_t hashUpdate = 0;
-
-  for (Name::const_iterator it = prefix.begin(); it != prefix.end(); it++)
-    {
-      const char* wireFormat = reinterpret_cast<const char*>( it->wire() );
-      hashUpdate = CityHash::compute(wireFormat, it->size());
-      hashValue ^= hashUpdate;
-    }
-
-  return hashValue;
-}
-
-std::vector<size_t>
-computeHashSet(const Name& prefix)
-{
-  prefix.wireEncode();  // guarantees prefix's wire buffer is not empty
-
-  size_t hashValue = 0;
-  size_t hashUpdate = 0;
-
-  std::vector<size_t> hashValueSet;
-  hashValueSet.push_back(hashValue);
-
-  for (Name::const_iterator it = prefix.begin(); it != prefix.end(); it++)
-    {
-      const char* wireFormat = reinterpret_cast<const char*>( it->wire() );
-      hashUpdate = CityHash::compute(wireFormat, it->size());
-      hashValue ^= hashUpdate;
-      hashValueSet.push_back(hashValue);
-    }
-
-  return hashValueSet;
-}
-
-} // namespace name_tree
-
 NameTree::NameTree(size_t nBuckets)
   : m_nItems(0)
   , m_nBuckets(nBuckets)
@@ -150,14 +82,14 @@ NameTree::~NameTree()
 
 // insert() is a private function, and called by only lookup()
 std::pair<shared_ptr<name_tree::Entry>, bool>
-NameTree::insert(const Name& prefix)
+NameTree::insert(const Name& name, size_t prefixLength, size_t hashValue)
 {
-  NFD_LOG_TRACE("insert " << prefix);
+  NFD_LOG_TRACE("insert " << name.getPrefix(prefixLength));
 
-  size_t hashValue = name_tree::computeHash(prefix);
   size_t loc = hashValue % m_nBuckets;
 
-  NFD_LOG_TRACE("Name " << prefix << " hash value = " << hashValue << "  location = " << loc);
+  NFD_LOG_TRACE("Name " << name.getPrefix(prefixLength) << " hash value = " << hashValue <<
+                "  location = " << loc);
 
   // Check if this Name has been stored
   name_tree::Node* node = m_buckets[loc];
@@ -167,7 +99,10 @@ NameTree::insert(const Name& prefix)
     {
       if (static_cast<bool>(node->m_entry))
         {
-          if (prefix == node->m_entry->m_prefix)
+          const Name& entryPrefix = node->m_entry->m_prefix;
+          if (hashValue == node->m_entry->getHash() &&
+              entryPrefix.size() == prefixLength &&
+              entryPrefix.isPrefixOf(name))
             {
               return std::make_pair(node->m_entry, false); // false: old entry
             }
@@ -175,7 +110,8 @@ NameTree::insert(const Name& prefix)
       nodePrev = node;
     }
 
-  NFD_LOG_TRACE("Did not find " << prefix << ", need to insert it to the table");
+  NFD_LOG_TRACE("Did not find " << name.getPrefix(prefixLength) <<
+                ", need to insert it to the table");
 
   // If no bucket is empty occupied, we need to create a new node, and it is
   // linked from nodePrev
@@ -192,7 +128,7 @@ NameTree::insert(const Name& prefix)
     }
 
   // Create a new Entry
-  shared_ptr<name_tree::Entry> entry(make_shared<name_tree::Entry>(prefix));
+  shared_ptr<name_tree::Entry> entry(make_shared<name_tree::Entry>(name.getPrefix(prefixLength)));
   entry->setHash(hashValue);
   node->m_entry = entry; // link the Entry to its Node
   entry->m_node = node; // link the node to Entry. Used in eraseEntryIfEmpty.
@@ -206,15 +142,17 @@ NameTree::lookup(const Name& prefix)
 {
   NFD_LOG_TRACE("lookup " << prefix);
 
+  // hash values of all prefixes are computed at once, and prefix names are created only for
+  // new entries
+  name_tree::computeHashSet(prefix, m_lookupHashSet);
+
   shared_ptr<name_tree::Entry> entry;
   shared_ptr<name_tree::Entry> parent;
 
   for (size_t i = 0; i <= prefix.size(); i++)
     {
-      Name temp = prefix.getPrefix(i);
-
       // insert() will create the entry if it does not exist.
-      std::pair<shared_ptr<name_tree::Entry>, bool> ret = insert(temp);
+      std::pair<shared_ptr<name_tree::Entry>, bool> ret = insert(prefix, i, m_lookupHashSet[i]);
       entry = ret.first;
 
       if (ret.second == true)
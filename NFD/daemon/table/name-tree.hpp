@@ -28,23 +28,11 @@
 
 #include "common.hpp"
 #include "name-tree-entry.hpp"
+#include "name-tree-hash.hpp"
 
 namespace nfd {
 namespace name_tree {
 
-/**
- * \brief Compute the hash value of the given name prefix's WIRE FORMAT
- */
-size_t
-computeHash(const Name& prefix);
-
-/**
- * \brief Incrementally compute hash values
- * \return Return a vector of hash values, starting from the root prefix
- */
-std::vector<size_t>
-computeHashSet(const Name& prefix);
-
 /// a predicate to accept or reject an Entry in find operations
 typedef function<bool (const Entry& entry)> EntrySelector;
 
@@ -315,6 +303,7 @@ private:
   name_tree::Node**             m_buckets; // Name Tree Buckets in the NPHT
   shared_ptr<name_tree::Entry>  m_end;
   const_iterator                m_endIterator;
+  std::vector<size_t>           m_lookupHashSet; // reused by lookup()
 
   /**
    * \brief Create a Name Tree Entry if it does not exist, or return the existing
@@ -323,9 +312,12 @@ private:
    * \return The first item is the Name Tree Entry address, the second item is
    * a bool value indicates whether this is an old entry (false) or a new
    * entry (true).
+   * \param name the name, whose prefix is inserted
+   * \param prefixLength number of components of the inserted prefix
+   * \param hashValue hash value of the inserted prefix
    */
   std::pair<shared_ptr<name_tree::Entry>, bool>
-  insert(const Name& prefix);
+  insert(const Name& name, size_t prefixLength, size_t hashValue);
 };
 
 inline NameTree::const_iterator::~const_iterator()
@@ -0,0 +1,114 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014,  Regents of the University of California,
+ *                      Arizona Board of Regents,
+ *                      Colorado State University,
+ *                      University Pierre & Marie Curie, Sorbonne University,
+ *                      Washington University in St. Louis,
+ *                      Beijing Institute of Technology,
+ *                      The University of Memphis
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pint-filter.hpp"
+#include "core/city-hash.hpp"
+#include "core/logger.hpp"
+
+#include <algorithm>
+
+NFD_LOG_INIT("PintFilter");
+
+namespace nfd {
+
+const time::nanoseconds PintFilter::DEFAULT_WINDOW = time::seconds(1);
+const size_t PintFilter::DEFAULT_N_BITS = (1 << 16);
+const size_t PintFilter::N_HASHES = 3;
+
+static const size_t BITS_PER_WORD = 64;
+
+PintFilter::PintFilter(const time::nanoseconds& window, size_t nBits)
+  : m_window(window)
+  , m_windowEnd(time::steady_clock::now() + window)
+  , m_nAggregated(0)
+{
+  if (m_window <= time::nanoseconds::zero()) {
+    throw std::invalid_argument("window must be positive");
+  }
+
+  size_t size = BITS_PER_WORD;
+  while (size < nBits) {
+    size <<= 1;
+  }
+  m_mask = size - 1;
+
+  m_current.resize(size / BITS_PER_WORD, 0);
+  m_previous.resize(size / BITS_PER_WORD, 0);
+}
+
+bool
+PintFilter::add(const Name& name)
+{
+  this->rotate();
+
+  const Block& nameWire = name.wireEncode();
+  uint64_t hash = CityHash64(reinterpret_cast<const char*>(nameWire.wire()), nameWire.size());
+
+  // double hashing: i-th bit is h1 + i * h2, h2 is odd so that bits differ
+  uint64_t h1 = hash;
+  uint64_t h2 = (hash >> 32) | 1;
+
+  bool isInCurrent = true;
+  bool isInPrevious = true;
+  for (size_t i = 0; i < N_HASHES; ++i) {
+    size_t bit = (h1 + i * h2) & m_mask;
+    uint64_t mask = static_cast<uint64_t>(1) << (bit % BITS_PER_WORD);
+    uint64_t& word = m_current[bit / BITS_PER_WORD];
+
+    isInCurrent = isInCurrent && (word & mask) != 0;
+    isInPrevious = isInPrevious && (m_previous[bit / BITS_PER_WORD] & mask) != 0;
+    word |= mask;
+  }
+
+  if (isInCurrent || isInPrevious) {
+    ++m_nAggregated;
+    return true;
+  }
+  return false;
+}
+
+void
+PintFilter::rotate()
+{
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+  if (now < m_windowEnd)
+    return;
+
+  if (now < m_windowEnd + m_window) {
+    m_current.swap(m_previous);
+  }
+  else {
+    // more than one window passed without PINTs, the current window is too old as well
+    std::fill(m_previous.begin(), m_previous.end(), 0);
+  }
+  std::fill(m_current.begin(), m_current.end(), 0);
+
+  // windows are aligned to multiples of the window duration since construction
+  m_windowEnd += ((now - m_windowEnd) / m_window + 1) * m_window;
+
+  NFD_LOG_TRACE("rotate windowEnd=" << m_windowEnd.time_since_epoch().count());
+}
+
+} // namespace nfd
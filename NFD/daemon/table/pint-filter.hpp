@@ -0,0 +1,124 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014,  Regents of the University of California,
+ *                      Arizona Board of Regents,
+ *                      Colorado State University,
+ *                      University Pierre & Marie Curie, Sorbonne University,
+ *                      Washington University in St. Louis,
+ *                      Beijing Institute of Technology,
+ *                      The University of Memphis
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_PINT_FILTER_HPP
+#define NFD_DAEMON_TABLE_PINT_FILTER_HPP
+
+#include "common.hpp"
+
+namespace nfd {
+
+/** \brief represents an approximate set of names of recently forwarded PINTs
+ *
+ *  PINTs never bring Data back, so PIT entries created for them only serve to aggregate
+ *  PINTs for the same name.  The PINT filter provides the same aggregation without
+ *  per-Interest state and timers: names are recorded in a Bloom filter for the current time
+ *  window, and a PINT is aggregated if its name is in the filter of the current or the previous
+ *  window.  A name is therefore remembered for at least one and at most two windows.
+ *
+ *  There could be false positives (a PINT aggregated although its name has not been seen),
+ *  with probability about (1 - e^(-kn/m))^k for n names per window, m bits, and k = N_HASHES.
+ *
+ *  Windows are rotated when the filter is accessed, so the filter does not schedule events.
+ */
+class PintFilter : noncopyable
+{
+public:
+  /** \brief constructs the PINT filter
+   *  \param window duration of a window, must be positive
+   *  \param nBits number of bits of the filter of each window, rounded up to a power of two
+   *  \throw std::invalid_argument if window is not positive
+   */
+  explicit
+  PintFilter(const time::nanoseconds& window = DEFAULT_WINDOW, size_t nBits = DEFAULT_N_BITS);
+
+  /** \brief records name
+   *  \return true if name has (probably) been recorded within the last one or two windows,
+   *          i.e., the PINT should be aggregated
+   */
+  bool
+  add(const Name& name);
+
+  /** \return duration of a window
+   */
+  const time::nanoseconds&
+  getWindow() const;
+
+  /** \return number of bits of the filter of each window
+   */
+  size_t
+  getNBits() const;
+
+  /** \return number of aggregated PINTs
+   */
+  uint64_t
+  getNAggregated() const;
+
+private:
+  /** \brief start new window(s) if the current one has ended
+   */
+  void
+  rotate();
+
+public:
+  /// default window duration
+  static const time::nanoseconds DEFAULT_WINDOW;
+
+  /// default number of bits of the filter of each window
+  static const size_t DEFAULT_N_BITS;
+
+  /// number of bits set for each name
+  static const size_t N_HASHES;
+
+private:
+  time::nanoseconds m_window;
+  size_t m_mask;
+  std::vector<uint64_t> m_current;
+  std::vector<uint64_t> m_previous;
+  time::steady_clock::TimePoint m_windowEnd;
+  uint64_t m_nAggregated;
+};
+
+inline const time::nanoseconds&
+PintFilter::getWindow() const
+{
+  return m_window;
+}
+
+inline size_t
+PintFilter::getNBits() const
+{
+  return m_mask + 1;
+}
+
+inline uint64_t
+PintFilter::getNAggregated() const
+{
+  return m_nAggregated;
+}
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_PINT_FILTER_HPP
@@ -34,6 +34,9 @@ const Name Entry::LOCALHOP_NAME("ndn:/localhop");
 
 Entry::Entry(const Interest& interest)
   : m_interest(interest.shared_from_this())
+  , m_cachedStrategy(nullptr)
+  , m_strategyGeneration(0)
+  , m_fibGeneration(0)
 {
 }
 
@@ -38,6 +38,14 @@ namespace name_tree {
 class Entry;
 }
 
+namespace fib {
+class Entry;
+}
+
+namespace fw {
+class Strategy;
+}
+
 namespace pit {
 
 /** \brief represents an unordered collection of InRecords
@@ -163,6 +171,27 @@ public: // OutRecord
   bool
   hasUnexpiredOutRecords() const;
 
+public: // cached table lookups
+  /** \brief get the effective strategy cached by setCachedStrategy
+   *  \param generation current StrategyChoice generation
+   *  \return the cached strategy, or nullptr if it is not cached or StrategyChoice has changed
+   */
+  fw::Strategy*
+  getCachedStrategy(uint64_t generation) const;
+
+  void
+  setCachedStrategy(fw::Strategy& strategy, uint64_t generation);
+
+  /** \brief get the FIB entry cached by setCachedFibEntry
+   *  \param generation current Fib generation
+   *  \return the cached FIB entry, or nullptr if it is not cached or Fib has changed
+   */
+  shared_ptr<fib::Entry>
+  getCachedFibEntry(uint64_t generation) const;
+
+  void
+  setCachedFibEntry(shared_ptr<fib::Entry> fibEntry, uint64_t generation);
+
 public:
   EventId m_unsatisfyTimer;
   EventId m_stragglerTimer;
@@ -177,6 +206,11 @@ private:
 
   shared_ptr<name_tree::Entry> m_nameTreeEntry;
 
+  fw::Strategy* m_cachedStrategy;
+  uint64_t m_strategyGeneration;
+  shared_ptr<fib::Entry> m_cachedFibEntry;
+  uint64_t m_fibGeneration;
+
   friend class nfd::NameTree;
   friend class nfd::name_tree::Entry;
 };
@@ -199,6 +233,32 @@ Entry::getOutRecords() const
   return m_outRecords;
 }
 
+inline fw::Strategy*
+Entry::getCachedStrategy(uint64_t generation) const
+{
+  return m_strategyGeneration == generation ? m_cachedStrategy : nullptr;
+}
+
+inline void
+Entry::setCachedStrategy(fw::Strategy& strategy, uint64_t generation)
+{
+  m_cachedStrategy = &strategy;
+  m_strategyGeneration = generation;
+}
+
+inline shared_ptr<fib::Entry>
+Entry::getCachedFibEntry(uint64_t generation) const
+{
+  return m_fibGeneration == generation ? m_cachedFibEntry : nullptr;
+}
+
+inline void
+Entry::setCachedFibEntry(shared_ptr<fib::Entry> fibEntry, uint64_t generation)
+{
+  m_cachedFibEntry = fibEntry;
+  m_fibGeneration = generation;
+}
+
 } // namespace pit
 } // namespace nfd
 
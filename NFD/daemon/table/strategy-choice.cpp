@@ -39,6 +39,7 @@ NFD_LOG_INIT("StrategyChoice");
 StrategyChoice::StrategyChoice(NameTree& nameTree, shared_ptr<Strategy> defaultStrategy)
   : m_nameTree(nameTree)
   , m_nItems(0)
+  , m_generation(1)
 {
   this->setDefaultStrategy(defaultStrategy);
 }
@@ -118,6 +119,7 @@ StrategyChoice::insert(const Name& prefix, const Name& strategyName)
 
   this->changeStrategy(*entry, *oldStrategy, *strategy);
   entry->setStrategy(*strategy);
+  ++m_generation;
   return true;
 }
 
@@ -144,6 +146,7 @@ StrategyChoice::erase(const Name& prefix)
   nte->setStrategyChoiceEntry(shared_ptr<Entry>());
   m_nameTree.eraseEntryIfEmpty(nte);
   --m_nItems;
+  ++m_generation;
 }
 
 std::pair<bool, Name>
@@ -222,6 +225,7 @@ StrategyChoice::setDefaultStrategy(shared_ptr<Strategy> strategy)
   NFD_LOG_INFO("setDefaultStrategy " << strategy->getName());
 
   entry->setStrategy(*strategy);
+  ++m_generation;
 }
 
 static inline void
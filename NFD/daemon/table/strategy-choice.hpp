@@ -89,6 +89,14 @@ public: // Strategy Choice table
   get(const Name& prefix) const;
 
 public: // effective strategy
+  /** \brief returns a number that changes whenever the effective strategy of any prefix
+   *         may change
+   *
+   *  Result of findEffectiveStrategy can be cached together with the generation.
+   */
+  uint64_t
+  getGeneration() const;
+
   /// get effective strategy for prefix
   fw::Strategy&
   findEffectiveStrategy(const Name& prefix) const;
@@ -164,6 +172,7 @@ private:
 private:
   NameTree& m_nameTree;
   size_t m_nItems;
+  uint64_t m_generation;
 
   typedef std::map<Name, shared_ptr<fw::Strategy> > StrategyInstanceTable;
   StrategyInstanceTable m_strategyInstances;
@@ -175,6 +184,12 @@ StrategyChoice::size() const
   return m_nItems;
 }
 
+inline uint64_t
+StrategyChoice::getGeneration() const
+{
+  return m_generation;
+}
+
 inline StrategyChoice::const_iterator
 StrategyChoice::end() const
 {
@@ -0,0 +1,273 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "accounting-aggregate-consumer.hpp"
+#include "ns3/ptr.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
+#include "ns3/integer.h"
+#include "ns3/double.h"
+
+#include "model/ndn-app-face.hpp"
+
+#include <limits>
+
+NS_LOG_COMPONENT_DEFINE("ndn.AccountingAggregateConsumer");
+
+namespace ns3 {
+namespace ndn {
+
+NS_OBJECT_ENSURE_REGISTERED(AccountingAggregateConsumer);
+
+TypeId
+AccountingAggregateConsumer::GetTypeId(void)
+{
+  static TypeId tid =
+    TypeId("ns3::ndn::AccountingAggregateConsumer")
+      .SetGroupName("Ndn")
+      .SetParent<ConsumerCbr>()
+      .AddConstructor<AccountingAggregateConsumer>()
+      .AddAttribute("FirstConsumerID", "ID of the first logical consumer", IntegerValue(0),
+                    MakeIntegerAccessor(&AccountingAggregateConsumer::m_firstId),
+                    MakeIntegerChecker<uint32_t>())
+      .AddAttribute("NConsumers", "Number of logical consumers", UintegerValue(1),
+                    MakeUintegerAccessor(&AccountingAggregateConsumer::m_nConsumers),
+                    MakeUintegerChecker<uint32_t>(1))
+
+      .AddTraceSource("ReceivedContent",
+                      "Trace called every time a logical consumer receives requested content",
+                      MakeTraceSourceAccessor(&AccountingAggregateConsumer::m_receivedContent));
+
+  return tid;
+}
+
+AccountingAggregateConsumer::AccountingAggregateConsumer()
+  : m_firstId(0)
+  , m_nConsumers(1)
+  , m_consumerRng(0.0, 1.0)
+  , m_nPending(0)
+  , m_expiryTimerId(0)
+{
+  m_interestFactory = InterestFactory(InterestFactory::PINT_PAYLOAD_SEQS);
+}
+
+double
+AccountingAggregateConsumer::GetRate() const
+{
+  return m_frequency * m_nConsumers;
+}
+
+uint32_t
+AccountingAggregateConsumer::GetNConsumers() const
+{
+  return m_nConsumers;
+}
+
+uint32_t
+AccountingAggregateConsumer::GetConsumerID(uint32_t index) const
+{
+  return m_firstId + index;
+}
+
+uint64_t
+AccountingAggregateConsumer::GetNSent(uint32_t index) const
+{
+  return index < m_nSent.size() ? m_nSent[index] : 0;
+}
+
+uint64_t
+AccountingAggregateConsumer::GetNSatisfied(uint32_t index) const
+{
+  return index < m_nSatisfied.size() ? m_nSatisfied[index] : 0;
+}
+
+uint64_t
+AccountingAggregateConsumer::GetNTimedOut(uint32_t index) const
+{
+  return index < m_nTimedOut.size() ? m_nTimedOut[index] : 0;
+}
+
+Time
+AccountingAggregateConsumer::GetMeanRtt(uint32_t index) const
+{
+  if (GetNSatisfied(index) == 0)
+    return Time(0);
+
+  return TimeStep(m_rttSum[index] / static_cast<int64_t>(m_nSatisfied[index]));
+}
+
+Time
+AccountingAggregateConsumer::GetMaxRtt(uint32_t index) const
+{
+  return index < m_rttMax.size() ? TimeStep(m_rttMax[index]) : Time(0);
+}
+
+void
+AccountingAggregateConsumer::StartApplication()
+{
+  NS_LOG_FUNCTION_NOARGS();
+
+  m_nSent.assign(m_nConsumers, 0);
+  m_nSatisfied.assign(m_nConsumers, 0);
+  m_nTimedOut.assign(m_nConsumers, 0);
+  m_rttSum.assign(m_nConsumers, 0);
+  m_rttMax.assign(m_nConsumers, 0);
+  m_pendingRequests.assign(m_nConsumers, std::deque<Time>());
+  m_nPending = 0;
+
+  // rate of the merged process depends on NConsumers, which may be set after Randomize; gaps
+  // precomputed by ConsumerScheduleHelper are kept
+  UpdateRandom();
+
+  ConsumerCbr::StartApplication();
+
+  m_expiryTimerId =
+    m_timerWheel->Schedule(m_interestLifeTime,
+                           MakeCallback(&AccountingAggregateConsumer::ExpireRequests, this));
+}
+
+void
+AccountingAggregateConsumer::StopApplication()
+{
+  NS_LOG_FUNCTION_NOARGS();
+
+  if (m_timerWheel != 0)
+    m_timerWheel->Cancel(m_expiryTimerId);
+
+  ConsumerCbr::StopApplication();
+}
+
+void
+AccountingAggregateConsumer::SendPacket()
+{
+  if (!m_active)
+    return;
+
+  NS_LOG_FUNCTION_NOARGS();
+
+  uint32_t seq = std::numeric_limits<uint32_t>::max(); // invalid
+  uint32_t index = 0;
+
+  while (m_retxSeqs.size()) {
+    seq = *m_retxSeqs.begin();
+    m_retxSeqs.erase(m_retxSeqs.begin());
+    index = seq - m_firstId;
+    break;
+  }
+
+  if (seq == std::numeric_limits<uint32_t>::max()) {
+    // new request of a random logical consumer; it also retransmits the consumer's Interest
+    index = std::min(static_cast<uint32_t>(m_consumerRng.GetValue() * m_nConsumers),
+                     m_nConsumers - 1);
+    seq = GetConsumerID(index);
+    m_retxSeqs.erase(seq);
+
+    m_pendingRequests[index].push_back(Simulator::Now());
+    m_nPending++;
+  }
+
+  time::milliseconds interestLifeTime(m_interestLifeTime.GetMilliSeconds());
+  m_interestFactory.SetInterestLifetime(interestLifeTime);
+  shared_ptr<Interest> interest =
+    m_interestFactory.Create(m_interestName, seq, static_cast<uint32_t>(m_rand.GetValue()));
+
+  NS_LOG_INFO("> Interest for " << seq << " from consumer " << GetConsumerID(index));
+  m_nSent[index]++;
+
+  WillSendOutInterest(seq);
+
+  m_transmittedInterests(interest, this, m_face);
+  m_face->onReceiveInterest(*interest);
+
+  ScheduleNextPacket();
+}
+
+void
+AccountingAggregateConsumer::OnData(shared_ptr<const Data> data)
+{
+  if (!m_active)
+    return;
+
+  ConsumerCbr::OnData(data); // tracing, retransmissions, and RTT estimation inside
+
+  NS_LOG_FUNCTION(this << data);
+
+  uint32_t index = data->getName().at(-1).toSequenceNumber() - m_firstId;
+  if (index >= m_nConsumers)
+    return;
+
+  Time now = Simulator::Now();
+  std::deque<Time>& requests = m_pendingRequests[index];
+  for (const Time& sendTime : requests) {
+    Time rtt = now - sendTime;
+
+    m_nSatisfied[index]++;
+    m_rttSum[index] += rtt.GetTimeStep();
+    m_rttMax[index] = std::max(m_rttMax[index], rtt.GetTimeStep());
+
+    m_receivedContent(this, GetConsumerID(index), rtt);
+  }
+
+  m_nPending -= requests.size();
+  requests.clear();
+}
+
+void
+AccountingAggregateConsumer::ExpireRequests()
+{
+  Time expireBefore = Simulator::Now() - m_interestLifeTime;
+
+  for (uint32_t index = 0; index < m_nConsumers; index++) {
+    std::deque<Time>& requests = m_pendingRequests[index];
+    if (requests.empty())
+      continue;
+
+    while (!requests.empty() && requests.front() <= expireBefore) {
+      m_nTimedOut[index]++;
+      m_nPending--;
+      requests.pop_front();
+    }
+
+    if (requests.empty()) {
+      // nothing left to retransmit for the consumer
+      m_outstanding.Erase(GetConsumerID(index));
+      m_retxSeqs.erase(GetConsumerID(index));
+    }
+  }
+
+  m_expiryTimerId =
+    m_timerWheel->Schedule(m_interestLifeTime,
+                           MakeCallback(&AccountingAggregateConsumer::ExpireRequests, this));
+}
+
+TableMemoryUsage
+AccountingAggregateConsumer::GetMemoryUsage() const
+{
+  TableMemoryUsage usage = ConsumerCbr::GetMemoryUsage();
+  usage.nEntries += m_nPending;
+  usage.nBytes += m_nPending * sizeof(Time)
+                  + m_nConsumers * (sizeof(std::deque<Time>) + 3 * sizeof(uint64_t)
+                                    + 2 * sizeof(int64_t));
+  return usage;
+}
+
+} // namespace ndn
+} // namespace ns3
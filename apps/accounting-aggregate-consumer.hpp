@@ -0,0 +1,161 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_ACCOUNTING_AGGREGATE_CONSUMER_H
+#define NDN_ACCOUNTING_AGGREGATE_CONSUMER_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ndn-consumer-cbr.hpp"
+
+#include <deque>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-apps
+ * @brief Ndn application modeling a group of AccountingConsumer applications behind one face
+ *
+ * Instead of installing NConsumers AccountingConsumer applications on separate nodes attached to
+ * the same router, a single application is installed on a node connected to that router.  The
+ * logical consumers get IDs FirstConsumerID .. FirstConsumerID + NConsumers - 1.
+ *
+ * Every logical consumer sends Interests with Frequency rate.  The application draws Interests
+ * from a single process with rate NConsumers * Frequency (gaps follow the Randomize attribute;
+ * the superposition of many independent request processes is close to a Poisson process, so use
+ * exponential to model independent consumers) and assigns each of them to a uniformly chosen
+ * logical consumer.
+ *
+ * Like AccountingConsumer, which requests the same name all the time, every logical consumer
+ * requests its own name /<Prefix>/<seq>, where the sequence number is the ID of the consumer
+ * (so the payload, which repeats the sequence number, carries the ID too).  Interests are tracked by the outstanding
+ * Interest table of Consumer, so they are retransmitted on timeout and feed the RTT estimator.
+ *
+ * Data satisfies all pending requests of its logical consumer.  Requests not satisfied within
+ * LifeTime are counted as timed out, and the Interest of a consumer without pending requests is
+ * no longer retransmitted.  Per-consumer statistics are kept in flat arrays indexed by the
+ * logical consumer index (ID - FirstConsumerID).
+ */
+class AccountingAggregateConsumer : public ConsumerCbr {
+public:
+  static TypeId
+  GetTypeId();
+
+  AccountingAggregateConsumer();
+
+  /**
+   * @brief Get number of logical consumers
+   */
+  uint32_t
+  GetNConsumers() const;
+
+  /**
+   * @brief Get ID of the logical consumer with the given index
+   */
+  uint32_t
+  GetConsumerID(uint32_t index) const;
+
+  /**
+   * @brief Get number of Interests sent on behalf of the logical consumer (including
+   *        retransmissions)
+   */
+  uint64_t
+  GetNSent(uint32_t index) const;
+
+  /**
+   * @brief Get number of requests of the logical consumer that were satisfied
+   */
+  uint64_t
+  GetNSatisfied(uint32_t index) const;
+
+  /**
+   * @brief Get number of requests of the logical consumer that were not satisfied within LifeTime
+   */
+  uint64_t
+  GetNTimedOut(uint32_t index) const;
+
+  /**
+   * @brief Get average delay between the request and the Data for the logical consumer
+   */
+  Time
+  GetMeanRtt(uint32_t index) const;
+
+  /**
+   * @brief Get maximum delay between the request and the Data for the logical consumer
+   */
+  Time
+  GetMaxRtt(uint32_t index) const;
+
+  // From App
+  virtual TableMemoryUsage
+  GetMemoryUsage() const;
+
+protected:
+  // from ConsumerCbr
+  virtual double
+  GetRate() const;
+
+  // from App
+  virtual void
+  StartApplication();
+
+  virtual void
+  StopApplication();
+
+  virtual void
+  SendPacket();
+
+  virtual void
+  OnData(shared_ptr<const Data> data);
+
+private:
+  /**
+   * @brief Drop requests that have not been satisfied within LifeTime
+   */
+  void
+  ExpireRequests();
+
+private:
+  uint32_t m_firstId;
+  uint32_t m_nConsumers;
+
+  UniformVariable m_consumerRng;
+
+  /// @brief Send times of pending requests of every logical consumer, in order of sending
+  std::vector<std::deque<Time>> m_pendingRequests;
+  size_t m_nPending; ///< \brief total number of pending requests
+  TimerWheel::TimerId m_expiryTimerId;
+
+  // per-consumer statistics
+  std::vector<uint64_t> m_nSent;
+  std::vector<uint64_t> m_nSatisfied;
+  std::vector<uint64_t> m_nTimedOut;
+  std::vector<int64_t> m_rttSum; ///< \brief in time steps
+  std::vector<int64_t> m_rttMax; ///< \brief in time steps
+
+  /// @brief Logical consumer (ID) received Data after the given delay
+  TracedCallback<Ptr<AccountingAggregateConsumer>, uint32_t, Time> m_receivedContent;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_ACCOUNTING_AGGREGATE_CONSUMER_H
@@ -50,6 +50,12 @@ AccountingConsumer::GetTypeId(void)
       .AddAttribute("ConsumerID", "Consumer ID",
                     IntegerValue(std::numeric_limits<uint32_t>::max()),
                     MakeIntegerAccessor(&AccountingConsumer::m_id), MakeIntegerChecker<uint32_t>())
+      .AddAttribute("ConsumerIDInPayload",
+                    "Put the consumer ID into the first PINT payload value instead of the "
+                    "sequence number (changes the PINT size)",
+                    BooleanValue(false),
+                    MakeBooleanAccessor(&AccountingConsumer::m_isConsumerIdInPayload),
+                    MakeBooleanChecker())
       .AddAttribute("NumberOfContents", "Number of the Contents in total", StringValue("100"),
                     MakeUintegerAccessor(&AccountingConsumer::SetNumberOfContents,
                                          &AccountingConsumer::GetNumberOfContents),
@@ -76,7 +82,9 @@ AccountingConsumer::AccountingConsumer()
   , m_q(0.7)
   , m_s(0.7)
   , m_SeqRng(0.0, 1.0)
+  , m_isConsumerIdInPayload(false)
 {
+  m_interestFactory = InterestFactory(InterestFactory::PINT_PAYLOAD_SEQS);
   // SetNumberOfContents is called by NS-3 object system during the initialization
 }
 
@@ -154,27 +162,34 @@ AccountingConsumer::OnData(shared_ptr<const Data> contentObject)
   Consumer::OnData(contentObject); // default receive logic
   receiveCount++;
 
-  for(std::vector<NameTime*>::iterator it = startTimes.begin(); it != startTimes.end(); ++it) {
-     NameTime *nt = *it;
-     if (nt->name == contentObject->getName()) {
-         NameTime *nameRtt = new NameTime(contentObject->getName(), Simulator::Now(), Simulator::Now());
-         nameRtt->name = contentObject->getName();
-         nameRtt->rtt = (Simulator::Now() - nt->rtt);
+  // the prefix of the Data name is interned once, entries are looked up by its IDs
+  NameTime* nameRtt = new NameTime(contentObject->getName(), Simulator::Now(), Simulator::Now(),
+                                   m_interestName.size());
+  NameTime* nt = startTimes.Take(*nameRtt);
+  if (nt == nullptr) {
+    delete nameRtt;
+    return;
+  }
 
-         rtts.push_back(nameRtt);
-         m_receivedMeaningfulContent(this);
+  nameRtt->rtt = (Simulator::Now() - nt->rtt);
 
-         delete nt;
-         startTimes.erase(it); // drop it from the list, and go on with our lives
+  rtts.push_back(nameRtt);
+  m_receivedMeaningfulContent(this);
 
-         break;
-     }
-  }
+  delete nt; // drop it from the list, and go on with our lives
 
   //std::cout << "> Consumer(" << m_id << ") got data back with name "
   //          << contentObject->getName() << std::endl;
 }
 
+TableMemoryUsage
+AccountingConsumer::GetMemoryUsage() const
+{
+  TableMemoryUsage usage = ConsumerCbr::GetMemoryUsage();
+  usage += startTimes.GetMemoryUsage();
+  return usage;
+}
+
 void
 AccountingConsumer::SendPacket()
 {
@@ -194,44 +209,26 @@ AccountingConsumer::SendPacket()
 
   seq = 0;
 
-  shared_ptr<Name> nameWithSequence = make_shared<Name>(m_interestName);
-  nameWithSequence->appendSequenceNumber(seq);
-
-  shared_ptr<Interest> interest = make_shared<Interest>();
-  interest->setNonce(m_rand.GetValue());
-  interest->setName(*nameWithSequence);
-
-  // Note: we're setting this randomly, just to test the encoding/decoding
-  std::vector<uint64_t> payload;
-  payload.push_back(seq);
-  payload.push_back(seq);
-  payload.push_back(seq);
-  payload.push_back(seq);
-  interest->setPayload(payload);
+  // payload repeats seq, unless the consumer ID is requested as the accounting key
+  if (m_isConsumerIdInPayload) {
+    m_interestFactory.SetPayloadKey(m_id);
+  }
+  shared_ptr<Interest> interest =
+    m_interestFactory.Create(m_interestName, seq, static_cast<uint32_t>(m_rand.GetValue()));
 
   // NS_LOG_INFO ("Requesting Interest: \n" << *interest);
   // std::cout << "> " << m_id << ": Interest for " << seq << ", Total: " << m_seq << ", face: " << m_face->getId() << std::endl;
   NS_LOG_INFO("> Interest for " << seq << ", Total: " << m_seq << ", face: " << m_face->getId());
-  NS_LOG_DEBUG("Trying to add " << seq << " with " << Simulator::Now() << ". already "
-                                << m_seqTimeouts.size() << " items");
-
-  m_seqTimeouts.insert(SeqTimeout(seq, Simulator::Now()));
-  m_seqFullDelay.insert(SeqTimeout(seq, Simulator::Now()));
-
-  m_seqLastDelay.erase(seq);
-  m_seqLastDelay.insert(SeqTimeout(seq, Simulator::Now()));
-
-  m_seqRetxCounts[seq]++;
-
-  m_rtt->SentSeq(SequenceNumber32(seq), 1);
+  Consumer::WillSendOutInterest(seq);
 
   m_transmittedInterests(interest, this, m_face);
   m_face->onReceiveInterest(*interest);
 
-  NameTime *nt = new NameTime(interest->getName(), Simulator::Now(), Simulator::Now());
-  startTimes.push_back(nt);
+  NameTime *nt =
+    new NameTime(interest->getName(), Simulator::Now(), Simulator::Now(), m_interestName.size());
+  startTimes.Insert(nt);
 
-  AccountingConsumer::ScheduleNextPacket();
+  ScheduleNextPacket();
   sentCount++;
 
   //std::cout << "> Consumer(" << GetNode()->GetId() << ") is sending interest, "
@@ -263,19 +260,5 @@ AccountingConsumer::GetNextSeq()
   return content_index;
 }
 
-void
-AccountingConsumer::ScheduleNextPacket()
-{
-
-  if (m_firstTime) {
-    m_sendEvent = Simulator::Schedule(Seconds(0.0), &AccountingConsumer::SendPacket, this);
-    m_firstTime = false;
-  }
-  else if (!m_sendEvent.IsRunning())
-    m_sendEvent = Simulator::Schedule((m_random == 0) ? Seconds(1.0 / m_frequency)
-                                                      : Seconds(m_random->GetValue()),
-                                      &AccountingConsumer::SendPacket, this);
-}
-
 } // namespace ndn
 } // namespace ns3
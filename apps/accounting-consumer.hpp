@@ -48,12 +48,12 @@ protected:
   virtual void
   OnData(shared_ptr<const Data> data);
 
+  virtual TableMemoryUsage
+  GetMemoryUsage() const;
+
   uint32_t
   GetNextSeq();
 
-  virtual void
-  ScheduleNextPacket();
-
 private:
   void
   SetConsumerID(uint32_t id);
@@ -89,7 +89,8 @@ private:
   uint64_t receiveCount;
 
   UniformVariable m_SeqRng; // RNG
-  std::vector<NameTime*> startTimes;
+  bool m_isConsumerIdInPayload;
+  NameTimeIndex startTimes;
 
   // Meaningful content retrieval trace callback
   TracedCallback<Ptr<AccountingConsumer>> m_receivedMeaningfulContent;
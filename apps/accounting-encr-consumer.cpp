@@ -30,24 +30,20 @@
 #include "ns3/double.h"
 
 #include <map>
+#include <set>
 
 #include "model/ndn-app-face.hpp"
 #include "utils/ndn-fw-hop-count-tag.hpp"
 
 NS_LOG_COMPONENT_DEFINE("ndn.AccountingEncrConsumer");
 
-char
-randomChar1()
-{
-    int stringLength = sizeof(alphanum) - 1;
-    return alphanum[rand() % stringLength];
-}
-
 namespace ns3 {
 namespace ndn {
 
 NS_OBJECT_ENSURE_REGISTERED(AccountingEncrConsumer);
 
+static const name::Component KEY_COMPONENT("key");
+
 TypeId
 AccountingEncrConsumer::GetTypeId(void)
 {
@@ -59,6 +55,12 @@ AccountingEncrConsumer::GetTypeId(void)
       .AddAttribute("ConsumerID", "Consumer ID",
                     IntegerValue(std::numeric_limits<uint32_t>::max()),
                     MakeIntegerAccessor(&AccountingEncrConsumer::m_id), MakeIntegerChecker<uint32_t>())
+      .AddAttribute("ConsumerIDInPayload",
+                    "Put the consumer ID into the first PINT payload value instead of the "
+                    "sequence number (changes the PINT size)",
+                    BooleanValue(false),
+                    MakeBooleanAccessor(&AccountingEncrConsumer::m_isConsumerIdInPayload),
+                    MakeBooleanChecker())
       .AddAttribute("NumberOfContents", "Number of the Contents in total", StringValue("100"),
                     MakeUintegerAccessor(&AccountingEncrConsumer::SetNumberOfContents,
                                          &AccountingEncrConsumer::GetNumberOfContents),
@@ -86,6 +88,7 @@ AccountingEncrConsumer::AccountingEncrConsumer()
   , m_q(0.7)
   , m_s(0.7)
   , m_SeqRng(0.0, 1.0)
+  , m_isConsumerIdInPayload(false)
 {
   // SetNumberOfContents is called by NS-3 object system during the initialization
 }
@@ -152,53 +155,70 @@ AccountingEncrConsumer::OnData(shared_ptr<const Data> contentObject)
   Consumer::OnData(contentObject); // default receive logic
   receiveCount++;
 
-  Name name = contentObject->getName();
-  std::string nameUri = name.toUri();
-  receivedNames.push_back(nameUri);
+  const Name& name = contentObject->getName();
+  receivedNames.insert(name);
 
-  std::string contentName;
-  std::string keyName;
-  std::map<std::string, std::string>::iterator itr = contentToKeyMap.find(nameUri);
+  Name contentName;
+  Name keyName;
+  std::map<Name, Name>::iterator itr = contentToKeyMap.find(name);
   if (itr != contentToKeyMap.end()) { // we received a data packet, mapped to key packet
-      contentName = nameUri;
+      contentName = name;
       keyName = itr->second;
   } else { // received a key packet, mapped to data packet
-      keyName = nameUri;
-      itr = keyToContentMap.find(nameUri);
+      keyName = name;
+      itr = keyToContentMap.find(name);
+      if (itr == keyToContentMap.end())
+        return;
       contentName = itr->second;
   }
 
   // if we've received both, we're done...
-  if (std::find(receivedNames.begin(), receivedNames.end(), contentName) != receivedNames.end() &&
-    std::find(receivedNames.begin(), receivedNames.end(), keyName) != receivedNames.end()) {
+  if (receivedNames.find(contentName) != receivedNames.end() &&
+    receivedNames.find(keyName) != receivedNames.end()) {
 
         // search for the corresponding interest entry
-        for(std::vector<NameTime*>::iterator it = startTimes.begin(); it != startTimes.end(); ++it) {
-           NameTime *nt = *it;
-           std::string ntUri = nt->name.toUri();
-           if (ntUri == contentName) {
-               Name realContentName(contentName);
-               NameTime *nameRtt = new NameTime(realContentName, Simulator::Now(), Simulator::Now());
-               nameRtt->name = contentObject->getName();
-               nameRtt->rtt = (Simulator::Now() - nt->rtt);
-
-               rtts.push_back(nameRtt);
-               m_receivedMeaningfulContent(this);
-
-               delete nt;
-               startTimes.erase(it); // drop it from the list, and go on with our lives
-
-               std::vector<std::string>::iterator citr = std::find(receivedNames.begin(), receivedNames.end(), contentName);
-               receivedNames.erase(citr);
-               std::vector<std::string>::iterator kitr = std::find(receivedNames.begin(), receivedNames.end(), keyName);
-               receivedNames.erase(kitr);
-
-               break;
-           }
+        NameTime key(contentName, Time(), Time(), m_interestName.size());
+        NameTime* nt = startTimes.Take(key);
+        if (nt != nullptr) {
+            NameTime *nameRtt =
+              new NameTime(name, Simulator::Now(), Simulator::Now(), m_interestName.size());
+            nameRtt->rtt = (Simulator::Now() - nt->rtt);
+
+            rtts.push_back(nameRtt);
+            m_receivedMeaningfulContent(this);
+
+            delete nt; // drop it from the list, and go on with our lives
+
+            receivedNames.erase(receivedNames.find(contentName));
+            receivedNames.erase(receivedNames.find(keyName));
         }
     }
 }
 
+TableMemoryUsage
+AccountingEncrConsumer::GetMemoryUsage() const
+{
+  // tree nodes: color, parent, left, right
+  static const size_t treeNodeOverhead = 4 * sizeof(void*);
+
+  TableMemoryUsage usage = ConsumerCbr::GetMemoryUsage();
+  usage += startTimes.GetMemoryUsage();
+
+  usage.nEntries += keyToContentMap.size() + contentToKeyMap.size() + receivedNames.size();
+  for (const auto& i : keyToContentMap) {
+    usage.nBytes += treeNodeOverhead + MemoryAccounting::EstimateNameSize(i.first)
+                    + MemoryAccounting::EstimateNameSize(i.second);
+  }
+  for (const auto& i : contentToKeyMap) {
+    usage.nBytes += treeNodeOverhead + MemoryAccounting::EstimateNameSize(i.first)
+                    + MemoryAccounting::EstimateNameSize(i.second);
+  }
+  for (const auto& i : receivedNames) {
+    usage.nBytes += treeNodeOverhead + MemoryAccounting::EstimateNameSize(i);
+  }
+  return usage;
+}
+
 void
 AccountingEncrConsumer::SendPacket()
 {
@@ -220,21 +240,13 @@ AccountingEncrConsumer::SendPacket()
 
   seq = m_seq++;
 
-  std::string prefix = m_interestName.toUri();
-
-  std::string suffix = "/";
-  for(unsigned int i = 0; i < 32; ++i)
-  {
-      char c = randomChar1();
-      suffix += c;
-  }
-
-  shared_ptr<Name> keyName = make_shared<Name>(prefix + suffix);
-  keyName->append("key"); // add the key annotation
+  // content and key names share the same /<Prefix>/<suffix> base
+  shared_ptr<Name> nameWithSequence = MakeRandomSuffixName(32);
+  shared_ptr<Name> keyName = make_shared<Name>(*nameWithSequence);
+  keyName->append(KEY_COMPONENT); // add the key annotation
   keyName->appendSequenceNumber(seq);
   seq = m_seq++;
 
-  shared_ptr<Name> nameWithSequence = make_shared<Name>(prefix + suffix);
   nameWithSequence->appendSequenceNumber(seq);
 
   shared_ptr<Interest> interest = make_shared<Interest>();
@@ -244,9 +256,9 @@ AccountingEncrConsumer::SendPacket()
   interest->setName(*nameWithSequence);
   keyInterest->setName(*keyName);
 
-  // Note: we're setting this randomly, just to test the encoding/decoding
+  // payload repeats seq, unless the consumer ID is requested as the accounting key
   std::vector<uint64_t> payload;
-  payload.push_back(seq);
+  payload.push_back(m_isConsumerIdInPayload ? m_id : seq);
   payload.push_back(seq);
   payload.push_back(seq);
   payload.push_back(seq);
@@ -255,37 +267,22 @@ AccountingEncrConsumer::SendPacket()
 
   // NS_LOG_INFO ("Requesting Interest: \n" << *interest);
   NS_LOG_INFO("> Interest for " << seq << ", Total: " << m_seq << ", face: " << m_face->getId());
-  NS_LOG_DEBUG("Trying to add " << seq << " with " << Simulator::Now() << ". already "
-                                << m_seqTimeouts.size() << " items");
-
-  m_seqTimeouts.insert(SeqTimeout(seq, Simulator::Now()));
-  m_seqTimeouts.insert(SeqTimeout(seq - 1, Simulator::Now()));
-  m_seqFullDelay.insert(SeqTimeout(seq, Simulator::Now()));
-  m_seqFullDelay.insert(SeqTimeout(seq - 1, Simulator::Now()));
-
-  m_seqLastDelay.erase(seq);
-  m_seqLastDelay.erase(seq - 1);
-  m_seqLastDelay.insert(SeqTimeout(seq, Simulator::Now()));
-  m_seqLastDelay.insert(SeqTimeout(seq - 1, Simulator::Now()));
-
-  m_seqRetxCounts[seq]++;
-  m_seqRetxCounts[seq - 1]++;
-
-  m_rtt->SentSeq(SequenceNumber32(seq), 1);
-  m_rtt->SentSeq(SequenceNumber32(seq - 1), 1);
+  Consumer::WillSendOutInterest(seq);
+  Consumer::WillSendOutInterest(seq - 1);
 
   m_transmittedInterests(interest, this, m_face);
   m_transmittedInterests(keyInterest, this, m_face);
   m_face->onReceiveInterest(*interest);
   m_face->onReceiveInterest(*keyInterest);
 
-  NameTime *nt = new NameTime(interest->getName(), Simulator::Now(), Simulator::Now());
-  startTimes.push_back(nt);
-  keyToContentMap.insert(std::pair<std::string, std::string>(keyName->toUri(), nameWithSequence->toUri()));
-  contentToKeyMap.insert(std::pair<std::string, std::string>(nameWithSequence->toUri(), keyName->toUri()));
+  NameTime *nt =
+    new NameTime(interest->getName(), Simulator::Now(), Simulator::Now(), m_interestName.size());
+  startTimes.Insert(nt);
+  keyToContentMap.insert(std::make_pair(*keyName, *nameWithSequence));
+  contentToKeyMap.insert(std::make_pair(*nameWithSequence, *keyName));
 
-  AccountingEncrConsumer::ScheduleNextPacket();
-  AccountingEncrConsumer::ScheduleNextPacket();
+  ScheduleNextPacket();
+  ScheduleNextPacket();
   sentCount += 2; // we issue an interest for the content and key at the same time
 }
 
@@ -314,20 +311,6 @@ AccountingEncrConsumer::GetNextSeq()
   return content_index;
 }
 
-void
-AccountingEncrConsumer::ScheduleNextPacket()
-{
-
-  if (m_firstTime) {
-    m_sendEvent = Simulator::Schedule(Seconds(0.0), &AccountingEncrConsumer::SendPacket, this);
-    m_firstTime = false;
-  }
-  else if (!m_sendEvent.IsRunning())
-    m_sendEvent = Simulator::Schedule((m_random == 0) ? Seconds(1.0 / m_frequency)
-                                                      : Seconds(m_random->GetValue()),
-                                      &AccountingEncrConsumer::SendPacket, this);
-}
-
 
 // TypeId
 // AccountingEncrConsumer::GetTypeId(void)
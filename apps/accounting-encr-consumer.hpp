@@ -24,6 +24,9 @@
 
 #include "ndn-consumer-cbr.hpp"
 
+#include <map>
+#include <set>
+
 namespace ns3 {
 namespace ndn {
 
@@ -40,7 +43,7 @@ public:
   AccountingEncrConsumer();
   ~AccountingEncrConsumer();
 
-  std::vector<NameTime*> startTimes;
+  NameTimeIndex startTimes;
 
 protected:
 
@@ -50,12 +53,12 @@ protected:
   virtual void
   OnData(shared_ptr<const Data> data);
 
+  virtual TableMemoryUsage
+  GetMemoryUsage() const;
+
   uint32_t
   GetNextSeq();
 
-  virtual void
-  ScheduleNextPacket();
-
 private:
   void
   SetNumberOfContents(uint32_t numOfContents);
@@ -85,13 +88,14 @@ private:
   uint64_t receiveCount;
 
   UniformVariable m_SeqRng; // RNG
+  bool m_isConsumerIdInPayload;
 
   // Meaningful content retrieval trace callback
   TracedCallback<Ptr<AccountingEncrConsumer>> m_receivedMeaningfulContent;
 
-  std::map<std::string, std::string> keyToContentMap;
-  std::map<std::string, std::string> contentToKeyMap;
-  std::vector<std::string> receivedNames;
+  std::map<Name, Name> keyToContentMap;
+  std::map<Name, Name> contentToKeyMap;
+  std::multiset<Name> receivedNames;
 
 };
 
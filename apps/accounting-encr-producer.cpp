@@ -21,6 +21,7 @@
 #include "ns3/log.h"
 #include "ns3/string.h"
 #include "ns3/uinteger.h"
+#include "ns3/boolean.h"
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
 
@@ -65,11 +66,20 @@ AccountingEncrProducer::GetTypeId(void)
          MakeUintegerChecker<uint32_t>())
       .AddAttribute("KeyLocator",
                     "Name to be used for key locator.  If root, then key locator is not used",
-                    NameValue(), MakeNameAccessor(&AccountingEncrProducer::m_keyLocator), MakeNameChecker());
+                    NameValue(), MakeNameAccessor(&AccountingEncrProducer::m_keyLocator), MakeNameChecker())
+      .AddAttribute("ConsumerIDInPayload",
+                    "Also count PINTs per consumer ID in the first payload value (consumers "
+                    "must set ConsumerIDInPayload too)",
+                    BooleanValue(false),
+                    MakeBooleanAccessor(&AccountingEncrProducer::m_isConsumerIdInPayload),
+                    MakeBooleanChecker());
   return tid;
 }
 
 AccountingEncrProducer::AccountingEncrProducer()
+  : receivedPints(0)
+  , receivedInterests(0)
+  , m_isConsumerIdInPayload(false)
 {
   NS_LOG_FUNCTION_NOARGS();
 }
@@ -81,6 +91,8 @@ AccountingEncrProducer::StartApplication()
   NS_LOG_FUNCTION_NOARGS();
   App::StartApplication();
 
+  m_pintAccounting.SetPayloadKeyed(m_isConsumerIdInPayload);
+
   FibHelper::AddRoute(GetNode(), m_prefix, m_face, 0);
 }
 
@@ -89,9 +101,20 @@ AccountingEncrProducer::StopApplication()
 {
   NS_LOG_FUNCTION_NOARGS();
 
+  NS_LOG_INFO("PINT accounting: " << m_pintAccounting.GetNPints() << " PINTs from "
+              << m_pintAccounting.GetFaceCounters().size() << " faces, "
+              << m_pintAccounting.GetNameCounters().size() << " names, "
+              << m_pintAccounting.GetKeyCounters().size() << " accounting keys");
+
   App::StopApplication();
 }
 
+const PintAccounting&
+AccountingEncrProducer::GetPintAccounting() const
+{
+  return m_pintAccounting;
+}
+
 void
 AccountingEncrProducer::OnInterest(shared_ptr<const Interest> interest)
 {
@@ -139,7 +162,7 @@ AccountingEncrProducer::OnInterest(shared_ptr<const Interest> interest)
   } else {
 
     receivedPints++;
-    std::vector<uint64_t> payload = interest->getPayload();
+    m_pintAccounting.Add(*interest);
 
     // std::cout << "Producer received a pInt with payload" << std::endl;
     // std::cout << "\t" << payload.at(0) << "," << payload.at(1) << "," << payload.at(2) << "," << payload.at(3) << std::endl;
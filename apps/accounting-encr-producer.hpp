@@ -25,6 +25,8 @@
 #include "ndn-app.hpp"
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 
+#include "ns3/ndnSIM/utils/ndn-pint-accounting.hpp"
+
 #include "ns3/nstime.h"
 #include "ns3/ptr.h"
 
@@ -51,6 +53,12 @@ public:
   virtual void
   OnInterest(shared_ptr<const Interest> interest);
 
+  /**
+   * @brief Get accounting information folded from the received PINTs
+   */
+  const PintAccounting&
+  GetPintAccounting() const;
+
 protected:
   // inherited from Application base class.
   virtual void
@@ -69,6 +77,9 @@ private:
   uint32_t receivedPints;
   uint32_t receivedInterests;
   Name m_keyLocator;
+  bool m_isConsumerIdInPayload;
+
+  PintAccounting m_pintAccounting;
 };
 
 } // namespace ndn
@@ -34,13 +34,6 @@
 
 NS_LOG_COMPONENT_DEFINE("ndn.AccountingRandomConsumer");
 
-char
-randomChar2()
-{
-    int stringLength = sizeof(alphanum) - 1;
-    return alphanum[rand() % stringLength];
-}
-
 namespace ns3 {
 namespace ndn {
 
@@ -150,22 +143,29 @@ AccountingRandomConsumer::OnData(shared_ptr<const Data> contentObject)
   Consumer::OnData(contentObject); // default receive logic
   receiveCount++;
 
-  for(std::vector<NameTime*>::iterator it = startTimes.begin(); it != startTimes.end(); ++it) {
-     NameTime *nt = *it;
-     if (nt->name == contentObject->getName()) {
-         NameTime *nameRtt = new NameTime(contentObject->getName(), Simulator::Now(), Simulator::Now());
-         nameRtt->name = contentObject->getName();
-         nameRtt->rtt = (Simulator::Now() - nt->rtt);
+  // the prefix of the Data name is interned once, entries are looked up by its IDs
+  NameTime* nameRtt = new NameTime(contentObject->getName(), Simulator::Now(), Simulator::Now(),
+                                   m_interestName.size());
+  NameTime* nt = startTimes.Take(*nameRtt);
+  if (nt == nullptr) {
+    delete nameRtt;
+    return;
+  }
 
-         rtts.push_back(nameRtt);
-         m_receivedMeaningfulContent(this);
+  nameRtt->rtt = (Simulator::Now() - nt->rtt);
 
-         delete nt;
-         startTimes.erase(it); // drop it from the list, and go on with our lives
+  rtts.push_back(nameRtt);
+  m_receivedMeaningfulContent(this);
 
-         break;
-     }
-  }
+  delete nt; // drop it from the list, and go on with our lives
+}
+
+TableMemoryUsage
+AccountingRandomConsumer::GetMemoryUsage() const
+{
+  TableMemoryUsage usage = ConsumerCbr::GetMemoryUsage();
+  usage += startTimes.GetMemoryUsage();
+  return usage;
 }
 
 void
@@ -190,16 +190,7 @@ AccountingRandomConsumer::SendPacket()
 
   seq = 0;
 
-  std::string prefix = m_interestName.toUri();
-
-  std::string suffix = "/";
-  for(unsigned int i = 0; i < 32; ++i)
-  {
-      char c = randomChar2();
-      suffix += c;
-  }
-  shared_ptr<Name> nameWithSequence = make_shared<Name>(prefix + suffix);
-
+  shared_ptr<Name> nameWithSequence = MakeRandomSuffixName(32);
   nameWithSequence->appendSequenceNumber(seq);
 
   // Now actually create the interest
@@ -217,26 +208,16 @@ AccountingRandomConsumer::SendPacket()
 
   // NS_LOG_INFO ("Requesting Interest: \n" << *interest);
   NS_LOG_INFO("> Interest for " << seq << ", Total: " << m_seq << ", face: " << m_face->getId());
-  NS_LOG_DEBUG("Trying to add " << seq << " with " << Simulator::Now() << ". already "
-                                << m_seqTimeouts.size() << " items");
-
-  m_seqTimeouts.insert(SeqTimeout(seq, Simulator::Now()));
-  m_seqFullDelay.insert(SeqTimeout(seq, Simulator::Now()));
-
-  m_seqLastDelay.erase(seq);
-  m_seqLastDelay.insert(SeqTimeout(seq, Simulator::Now()));
-
-  m_seqRetxCounts[seq]++;
-
-  m_rtt->SentSeq(SequenceNumber32(seq), 1);
+  Consumer::WillSendOutInterest(seq);
 
   m_transmittedInterests(interest, this, m_face);
   m_face->onReceiveInterest(*interest);
 
-  NameTime *nt = new NameTime(interest->getName(), Simulator::Now(), Simulator::Now());
-  startTimes.push_back(nt);
+  NameTime *nt =
+    new NameTime(interest->getName(), Simulator::Now(), Simulator::Now(), m_interestName.size());
+  startTimes.Insert(nt);
 
-  AccountingRandomConsumer::ScheduleNextPacket();
+  ScheduleNextPacket();
   sentCount++;
 }
 
@@ -265,19 +246,5 @@ AccountingRandomConsumer::GetNextSeq()
   return content_index;
 }
 
-void
-AccountingRandomConsumer::ScheduleNextPacket()
-{
-
-  if (m_firstTime) {
-    m_sendEvent = Simulator::Schedule(Seconds(0.0), &AccountingRandomConsumer::SendPacket, this);
-    m_firstTime = false;
-  }
-  else if (!m_sendEvent.IsRunning())
-    m_sendEvent = Simulator::Schedule((m_random == 0) ? Seconds(1.0 / m_frequency)
-                                                      : Seconds(m_random->GetValue()),
-                                      &AccountingRandomConsumer::SendPacket, this);
-}
-
 } // namespace ndn
 } // namespace ns3
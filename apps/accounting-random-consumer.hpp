@@ -40,7 +40,7 @@ public:
   AccountingRandomConsumer();
   ~AccountingRandomConsumer();
 
-  std::vector<NameTime*> startTimes;
+  NameTimeIndex startTimes;
 
 protected:
 
@@ -50,12 +50,12 @@ protected:
   virtual void
   OnData(shared_ptr<const Data> data);
 
+  virtual TableMemoryUsage
+  GetMemoryUsage() const;
+
   uint32_t
   GetNextSeq();
 
-  virtual void
-  ScheduleNextPacket();
-
 private:
   void
   SetNumberOfContents(uint32_t numOfContents);
@@ -21,6 +21,7 @@
 #include "ns3/log.h"
 #include "ns3/string.h"
 #include "ns3/uinteger.h"
+#include "ns3/boolean.h"
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
 
@@ -65,11 +66,20 @@ AccountingRandomProducer::GetTypeId(void)
          MakeUintegerChecker<uint32_t>())
       .AddAttribute("KeyLocator",
                     "Name to be used for key locator.  If root, then key locator is not used",
-                    NameValue(), MakeNameAccessor(&AccountingRandomProducer::m_keyLocator), MakeNameChecker());
+                    NameValue(), MakeNameAccessor(&AccountingRandomProducer::m_keyLocator), MakeNameChecker())
+      .AddAttribute("ConsumerIDInPayload",
+                    "Also count PINTs per consumer ID in the first payload value (consumers "
+                    "must set ConsumerIDInPayload too)",
+                    BooleanValue(false),
+                    MakeBooleanAccessor(&AccountingRandomProducer::m_isConsumerIdInPayload),
+                    MakeBooleanChecker());
   return tid;
 }
 
 AccountingRandomProducer::AccountingRandomProducer()
+  : receivedPints(0)
+  , receivedInterests(0)
+  , m_isConsumerIdInPayload(false)
 {
   NS_LOG_FUNCTION_NOARGS();
 }
@@ -81,6 +91,8 @@ AccountingRandomProducer::StartApplication()
   NS_LOG_FUNCTION_NOARGS();
   App::StartApplication();
 
+  m_pintAccounting.SetPayloadKeyed(m_isConsumerIdInPayload);
+
   FibHelper::AddRoute(GetNode(), m_prefix, m_face, 0);
 }
 
@@ -89,9 +101,20 @@ AccountingRandomProducer::StopApplication()
 {
   NS_LOG_FUNCTION_NOARGS();
 
+  NS_LOG_INFO("PINT accounting: " << m_pintAccounting.GetNPints() << " PINTs from "
+              << m_pintAccounting.GetFaceCounters().size() << " faces, "
+              << m_pintAccounting.GetNameCounters().size() << " names, "
+              << m_pintAccounting.GetKeyCounters().size() << " accounting keys");
+
   App::StopApplication();
 }
 
+const PintAccounting&
+AccountingRandomProducer::GetPintAccounting() const
+{
+  return m_pintAccounting;
+}
+
 void
 AccountingRandomProducer::OnInterest(shared_ptr<const Interest> interest)
 {
@@ -139,7 +162,7 @@ AccountingRandomProducer::OnInterest(shared_ptr<const Interest> interest)
   } else {
 
     receivedPints++;
-    std::vector<uint64_t> payload = interest->getPayload();
+    m_pintAccounting.Add(*interest);
 
     // std::cout << "Producer received a pInt with payload" << std::endl;
     // std::cout << "\t" << payload.at(0) << "," << payload.at(1) << "," << payload.at(2) << "," << payload.at(3) << std::endl;
@@ -75,6 +75,12 @@ App::DoDispose(void)
   Application::DoDispose();
 }
 
+TableMemoryUsage
+App::GetMemoryUsage() const
+{
+  return TableMemoryUsage();
+}
+
 uint32_t
 App::GetId() const
 {
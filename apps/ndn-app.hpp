@@ -22,6 +22,7 @@
 
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 #include "ns3/ndnSIM/model/ndn-app-face.hpp"
+#include "ns3/ndnSIM/utils/ndn-memory-accounting.hpp"
 
 #include "ns3/application.h"
 #include "ns3/ptr.h"
@@ -80,6 +81,14 @@ public:
   virtual void
   OnData(shared_ptr<const Data> data);
 
+  /**
+   * @brief Get number of entries and estimated bytes in application's bookkeeping structures
+   *
+   * Base implementation reports no usage
+   */
+  virtual TableMemoryUsage
+  GetMemoryUsage() const;
+
 protected:
   /**
    * @brief Do cleanup when application is destroyed
@@ -20,6 +20,7 @@
 #include "ndn-consumer-cbr.hpp"
 #include "ns3/ptr.h"
 #include "ns3/log.h"
+#include "ns3/assert.h"
 #include "ns3/simulator.h"
 #include "ns3/packet.h"
 #include "ns3/callback.h"
@@ -29,13 +30,44 @@
 #include "ns3/integer.h"
 #include "ns3/double.h"
 
+#include "ns3/node.h"
+
 #include "model/ndn-app-face.hpp"
 
+#include <cmath>
+
 NS_LOG_COMPONENT_DEFINE("ndn.ConsumerCbr");
 
 namespace ns3 {
 namespace ndn {
 
+// Streams passed to AssignStreams are non-negative int64_t values, so they never have the top
+// bit set.  Default streams always have it set, so the two ranges cannot collide:
+//
+//   bit 63: default stream, bit 62: schedule generator, bits 32..61: node ID, bits 0..31: app index
+static const uint64_t DEFAULT_STREAM = 1ULL << 63;
+static const uint64_t SCHEDULE_STREAM = 1ULL << 62;
+static const uint32_t MAX_DEFAULT_STREAM_NODE_ID = (1U << 30) - 1;
+
+/**
+ * @brief Get stream derived from the node ID and the index of the application on the node
+ */
+static uint64_t
+getDefaultStream(const Application& app)
+{
+  Ptr<Node> node = app.GetNode();
+  NS_ASSERT_MSG(node->GetId() <= MAX_DEFAULT_STREAM_NODE_ID,
+                "Node ID does not fit default stream, use ConsumerCbr::AssignStreams");
+
+  uint32_t appIndex = 0;
+  while (appIndex < node->GetNApplications()
+         && PeekPointer(node->GetApplication(appIndex)) != &app) {
+    appIndex++;
+  }
+
+  return DEFAULT_STREAM | (static_cast<uint64_t>(node->GetId()) << 32) | appIndex;
+}
+
 NS_OBJECT_ENSURE_REGISTERED(ConsumerCbr);
 
 TypeId
@@ -60,6 +92,18 @@ ConsumerCbr::GetTypeId(void)
                     IntegerValue(std::numeric_limits<uint32_t>::max()),
                     MakeIntegerAccessor(&ConsumerCbr::m_seqMax), MakeIntegerChecker<uint32_t>())
 
+      .AddAttribute("BatchSize",
+                    "Maximum number of Interests sent out by a single simulator event "
+                    "(also number of randomized gaps drawn at once)",
+                    UintegerValue(1), MakeUintegerAccessor(&ConsumerCbr::m_batchSize),
+                    MakeUintegerChecker<uint32_t>(1))
+
+      .AddAttribute("BatchWindow",
+                    "Interests due within this time from the current send event are sent out "
+                    "by the same event (0 keeps exact send times)",
+                    StringValue("0s"), MakeTimeAccessor(&ConsumerCbr::m_batchWindow),
+                    MakeTimeChecker())
+
     ;
 
   return tid;
@@ -69,6 +113,14 @@ ConsumerCbr::ConsumerCbr()
   : m_frequency(1.0)
   , m_firstTime(true)
   , m_random(0)
+  , m_isStreamAssigned(false)
+  , m_batchSize(1)
+  , m_nextInterval(0)
+  , m_isSendingBatch(false)
+  , m_isNextPacketRequested(false)
+  , m_hasSchedule(false)
+  , m_scheduleHorizon(0)
+  , m_scheduleTime(0)
 {
   NS_LOG_FUNCTION_NOARGS();
   m_seqMax = std::numeric_limits<uint32_t>::max();
@@ -80,38 +132,215 @@ ConsumerCbr::~ConsumerCbr()
     delete m_random;
 }
 
+int64_t
+ConsumerCbr::AssignStreams(int64_t stream)
+{
+  NS_ASSERT_MSG(stream >= 0, "Stream must be non-negative");
+
+  m_suffixGenerator.SetStream(stream);
+  m_scheduleGenerator.SetStream(stream + 1);
+  m_isStreamAssigned = true;
+  return 2;
+}
+
+void
+ConsumerCbr::StartApplication()
+{
+  if (!m_isStreamAssigned) {
+    m_suffixGenerator.SetStream(getDefaultStream(*this));
+  }
+
+  Consumer::StartApplication();
+}
+
+std::function<void()>
+ConsumerCbr::PrepareSchedule(const Time& until, size_t chunkSize)
+{
+  if (!m_hasSchedule) {
+    UpdateRandom(); // in case Frequency was set after Randomize
+    if (!HasScheduleValues())
+      return std::function<void()>();
+
+    if (!m_isStreamAssigned) {
+      m_scheduleGenerator.SetStream(getDefaultStream(*this) | SCHEDULE_STREAM);
+    }
+
+    TimeValue start, stop;
+    GetAttribute("StartTime", start);
+    GetAttribute("StopTime", stop);
+
+    Time end = until;
+    if (!stop.Get().IsZero() && stop.Get() < end)
+      end = stop.Get();
+
+    m_hasSchedule = true;
+    m_scheduleHorizon = std::max((end - start.Get()).GetSeconds(), 0.0);
+    m_scheduleTime = 0; // the first Interest is sent right at the start
+  }
+
+  size_t nEntries = GetNScheduleEntries();
+  if (m_scheduleTime > m_scheduleHorizon || nEntries >= (chunkSize + 1) / 2)
+    return std::function<void()>();
+
+  CompactSchedule(); // in the simulator thread, the job only appends
+  size_t count = chunkSize - nEntries;
+  return [this, count] { FillSchedule(count); };
+}
+
+bool
+ConsumerCbr::HasScheduleValues() const
+{
+  return m_random != 0;
+}
+
+double
+ConsumerCbr::AppendScheduleEntry()
+{
+  double mean = 1.0 / GetRate();
+  if (m_random == 0)
+    return mean;
+
+  double interval;
+  if (m_randomType == "uniform") {
+    interval = 2 * mean * m_scheduleGenerator.NextDouble(); // as UniformVariable(0, 2 * mean)
+  }
+  else {
+    do {
+      interval = -mean * std::log(m_scheduleGenerator.NextDouble());
+    } while (interval > 50 * mean); // as ExponentialVariable(mean, 50 * mean)
+  }
+  m_intervals.push_back(interval);
+  return interval;
+}
+
+size_t
+ConsumerCbr::GetNScheduleEntries() const
+{
+  return m_intervals.size() - m_nextInterval;
+}
+
+void
+ConsumerCbr::CompactSchedule()
+{
+  m_intervals.erase(m_intervals.begin(), m_intervals.begin() + m_nextInterval);
+  m_nextInterval = 0;
+}
+
+void
+ConsumerCbr::FillSchedule(size_t count)
+{
+  // each gap leads to the next Interest, the last one precomputed is sent after the horizon
+  for (; count > 0 && m_scheduleTime <= m_scheduleHorizon; count--) {
+    m_scheduleTime += AppendScheduleEntry();
+  }
+}
+
+shared_ptr<Name>
+ConsumerCbr::MakeRandomSuffixName(size_t suffixLength)
+{
+  shared_ptr<Name> name = make_shared<Name>(m_interestName);
+  name->append(m_suffixGenerator.GenerateComponent(suffixLength));
+  return name;
+}
+
 void
 ConsumerCbr::ScheduleNextPacket()
 {
   // double mean = 8.0 * m_payloadSize / m_desiredRate.GetBitRate ();
   // std::cout << "next: " << Simulator::Now().ToDouble(Time::S) + mean << "s\n";
 
-  if (m_firstTime) {
-    m_sendEvent = Simulator::Schedule(Seconds(0.0), &Consumer::SendPacket, this);
+  if (m_isSendingBatch) {
+    // SendBatch decides whether the next packet is sent right away or by a new event
+    m_isNextPacketRequested = true;
+  }
+  else if (m_firstTime) {
+    m_sendEvent = Simulator::Schedule(Seconds(0.0), &ConsumerCbr::SendBatch, this);
     m_firstTime = false;
   }
   else if (!m_sendEvent.IsRunning())
-    m_sendEvent = Simulator::Schedule((m_random == 0) ? Seconds(1.0 / m_frequency)
-                                                      : Seconds(m_random->GetValue()),
-                                      &Consumer::SendPacket, this);
+    m_sendEvent = Simulator::Schedule(GetNextInterval(), &ConsumerCbr::SendBatch, this);
+}
+
+void
+ConsumerCbr::SendBatch()
+{
+  m_isSendingBatch = true;
+
+  Time offset;
+  for (uint32_t nSent = 0; m_active; ) {
+    m_isNextPacketRequested = false;
+    SendPacket();
+    nSent++;
+
+    if (!m_isNextPacketRequested)
+      break; // nothing more to send until ScheduleNextPacket is called again
+
+    offset += GetNextInterval();
+    if (nSent >= m_batchSize || offset > m_batchWindow) {
+      NS_LOG_DEBUG("Sent " << nSent << " Interests, next batch in " << offset);
+      m_sendEvent = Simulator::Schedule(offset, &ConsumerCbr::SendBatch, this);
+      break;
+    }
+  }
+
+  m_isSendingBatch = false;
+}
+
+Time
+ConsumerCbr::GetNextInterval()
+{
+  if (m_random == 0)
+    return Seconds(1.0 / GetRate());
+
+  if (m_hasSchedule) {
+    if (m_nextInterval >= m_intervals.size()) {
+      CompactSchedule();
+      m_scheduleTime += AppendScheduleEntry();
+    }
+  }
+  else if (m_nextInterval >= m_intervals.size()) {
+    m_intervals.resize(m_batchSize);
+    for (double& interval : m_intervals) {
+      interval = m_random->GetValue();
+    }
+    m_nextInterval = 0;
+  }
+
+  return Seconds(m_intervals[m_nextInterval++]);
+}
+
+double
+ConsumerCbr::GetRate() const
+{
+  return m_frequency;
 }
 
 void
 ConsumerCbr::SetRandomize(const std::string& value)
+{
+  m_randomType = value;
+  UpdateRandom();
+
+  // gaps drawn from the previous variable are no longer valid
+  m_intervals.clear();
+  m_nextInterval = 0;
+}
+
+void
+ConsumerCbr::UpdateRandom()
 {
   if (m_random)
     delete m_random;
 
-  if (value == "uniform") {
-    m_random = new UniformVariable(0.0, 2 * 1.0 / m_frequency);
+  double mean = 1.0 / GetRate();
+  if (m_randomType == "uniform") {
+    m_random = new UniformVariable(0.0, 2 * mean);
   }
-  else if (value == "exponential") {
-    m_random = new ExponentialVariable(1.0 / m_frequency, 50 * 1.0 / m_frequency);
+  else if (m_randomType == "exponential") {
+    m_random = new ExponentialVariable(mean, 50 * mean);
   }
   else
     m_random = 0;
-
-  m_randomType = value;
 }
 
 void
@@ -140,17 +369,10 @@ ConsumerCbr::SendPacket()
     seq = m_seq++;
   }
 
-  //
-  shared_ptr<Name> nameWithSequence = make_shared<Name>(m_interestName);
-  nameWithSequence->appendSequenceNumber(seq);
-  //
-
-  // shared_ptr<Interest> interest = make_shared<Interest> ();
-  shared_ptr<Interest> interest = make_shared<Interest>();
-  interest->setNonce(m_rand.GetValue());
-  interest->setName(*nameWithSequence);
   time::milliseconds interestLifeTime(m_interestLifeTime.GetMilliSeconds());
-  interest->setInterestLifetime(interestLifeTime);
+  m_interestFactory.SetInterestLifetime(interestLifeTime);
+  shared_ptr<Interest> interest =
+    m_interestFactory.Create(m_interestName, seq, static_cast<uint32_t>(m_rand.GetValue()));
 
   // NS_LOG_INFO ("Requesting Interest: \n" << *interest);
   NS_LOG_INFO("> Interest for " << seq);
@@ -169,6 +391,14 @@ ConsumerCbr::OnData(shared_ptr<const Data> data)
   Consumer::OnData(data);
 }
 
+TableMemoryUsage
+ConsumerCbr::GetMemoryUsage() const
+{
+  TableMemoryUsage usage = Consumer::GetMemoryUsage();
+  usage += ndn::GetMemoryUsage(rtts);
+  return usage;
+}
+
 std::string
 ConsumerCbr::GetRandomize() const
 {
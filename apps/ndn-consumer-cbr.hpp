@@ -24,7 +24,16 @@
 
 #include "ndn-consumer.hpp"
 
-static const char alphanum[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+#include "ns3/ndnSIM/utils/ndn-name-interner.hpp"
+#include "ns3/ndnSIM/utils/ndn-name-suffix-generator.hpp"
+
+#include <boost/functional/hash.hpp>
+#include <boost/noncopyable.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+#include <vector>
 
 namespace ns3 {
 namespace ndn {
@@ -32,21 +41,189 @@ namespace ndn {
 class NameTime {
 
 public:
-  NameTime(Name _name, Time _time, Time _eventTime)
-    : name(_name), rtt(_time), eventTime(_eventTime)
+  /**
+   * @param prefixLength number of leading components shared by many names (e.g., the prefix of
+   *        the consumer); only these are interned, the rest of the name is kept as wire bytes
+   */
+  NameTime(const Name& _name, Time _time, Time _eventTime, size_t prefixLength = 0)
+    : rtt(_time), eventTime(_eventTime), next(nullptr)
+  {
+    prefixLength = std::min(prefixLength, _name.size());
+    for (size_t i = 0; i < prefixLength; i++) {
+      prefix.append(_name[i]);
+    }
+    for (size_t i = prefixLength; i < _name.size(); i++) {
+      suffix.insert(suffix.end(), _name[i].begin(), _name[i].end());
+    }
+  }
+
+  /**
+   * @brief Check if the entry is for the same name as other
+   *
+   * Both entries must be created with the same prefixLength.  Prefixes are compared by IDs of
+   * the interned components, only the suffix is compared bytewise.
+   */
+  bool
+  HasSameName(const NameTime& other) const
+  {
+    return prefix == other.prefix && suffix == other.suffix;
+  }
+
+  /**
+   * @brief Get hash of the name, consistent with HasSameName
+   */
+  size_t
+  GetNameHash() const
   {
+    size_t seed = InternedName::Hash()(prefix);
+    boost::hash_range(seed, suffix.begin(), suffix.end());
+    return seed;
   }
 
-  Name name;
+  InternedName prefix;         ///< \brief interned, so it is stored once for all entries
+  std::vector<uint8_t> suffix; ///< \brief wire encoding of the remaining (unique) components
   Time rtt;
   Time eventTime;
+  NameTime* next; ///< \brief next entry with the same name hash in NameTimeIndex
+
+  /**
+   * @brief Estimated memory used by a heap-allocated NameTime referenced from a vector
+   */
+  size_t
+  GetMemoryUsage() const
+  {
+    return sizeof(NameTime*) + sizeof(NameTime) + prefix.size() * sizeof(InternedName::Id)
+           + suffix.capacity();
+  }
+};
+
+/**
+ * @brief Get number of entries and estimated bytes of a NameTime collection
+ */
+inline TableMemoryUsage
+GetMemoryUsage(const std::vector<NameTime*>& nameTimes)
+{
+  TableMemoryUsage usage(nameTimes.size(), 0);
+  for (const NameTime* nt : nameTimes) {
+    usage.nBytes += nt->GetMemoryUsage();
+  }
+  return usage;
+}
+
+/**
+ * @brief Collection of NameTime entries looked up by name
+ *
+ * Entries are chained by hash of the name in the order they were inserted, so the oldest entry
+ * for a name is found without scanning entries of other names.  The collection owns the entries
+ * it holds.
+ */
+class NameTimeIndex : boost::noncopyable {
+public:
+  NameTimeIndex()
+    : m_nEntries(0)
+  {
+  }
+
+  ~NameTimeIndex()
+  {
+    for (const auto& chain : m_chains) {
+      for (NameTime* entry = chain.second.first; entry != nullptr;) {
+        NameTime* next = entry->next;
+        delete entry;
+        entry = next;
+      }
+    }
+  }
+
+  /**
+   * @brief Add the entry, taking ownership of it
+   */
+  void
+  Insert(NameTime* entry)
+  {
+    entry->next = nullptr;
+
+    Chain& chain = m_chains[entry->GetNameHash()];
+    if (chain.last == nullptr)
+      chain.first = entry;
+    else
+      chain.last->next = entry;
+    chain.last = entry;
+
+    m_nEntries++;
+  }
+
+  /**
+   * @brief Remove the oldest entry for the name of the key
+   * @return the entry, owned by the caller from now on, or nullptr if there is none
+   */
+  NameTime*
+  Take(const NameTime& key)
+  {
+    auto chain = m_chains.find(key.GetNameHash());
+    if (chain == m_chains.end())
+      return nullptr;
+
+    NameTime* previous = nullptr;
+    for (NameTime* entry = chain->second.first; entry != nullptr; entry = entry->next) {
+      if (!entry->HasSameName(key)) {
+        previous = entry;
+        continue;
+      }
+
+      if (previous == nullptr)
+        chain->second.first = entry->next;
+      else
+        previous->next = entry->next;
+      if (chain->second.last == entry)
+        chain->second.last = previous;
+      if (chain->second.first == nullptr)
+        m_chains.erase(chain);
+
+      entry->next = nullptr;
+      m_nEntries--;
+      return entry;
+    }
+    return nullptr;
+  }
+
+  size_t
+  GetN() const
+  {
+    return m_nEntries;
+  }
 
-  NameTime& operator=(const NameTime& other) {
-      name = other.name;
-      rtt = other.rtt;
-      eventTime = other.eventTime;
-      return *this;
+  /**
+   * @brief Get number of entries and estimated bytes, including the hash table
+   */
+  TableMemoryUsage
+  GetMemoryUsage() const
+  {
+    TableMemoryUsage usage(m_nEntries, 0);
+    for (const auto& chain : m_chains) {
+      usage.nBytes += sizeof(chain) + sizeof(void*); // hash table node
+      for (NameTime* entry = chain.second.first; entry != nullptr; entry = entry->next) {
+        usage.nBytes += entry->GetMemoryUsage();
+      }
+    }
+    usage.nBytes += m_chains.bucket_count() * sizeof(void*);
+    return usage;
   }
+
+private:
+  struct Chain {
+    Chain()
+      : first(nullptr)
+      , last(nullptr)
+    {
+    }
+
+    NameTime* first;
+    NameTime* last;
+  };
+
+  std::unordered_map<size_t, Chain> m_chains;
+  size_t m_nEntries;
 };
 
 /**
@@ -67,7 +244,60 @@ public:
 
   std::vector<NameTime*> rtts;
 
+  // From App
+  virtual TableMemoryUsage
+  GetMemoryUsage() const;
+
+  /**
+   * @brief Assign a fixed random stream number to the name suffix generator of the application
+   *
+   * If not called, stream is derived from the node ID and the index of the application on the
+   * node when the application starts, which is deterministic for a given scenario.  Such default
+   * streams are taken from a range reserved for them, so they never collide with assigned ones.
+   *
+   * @param stream first stream index to use (the next one is used for the precomputed schedule),
+   *        must be non-negative
+   * @return the number of stream indices assigned by this application
+   */
+  int64_t
+  AssignStreams(int64_t stream);
+
+  /**
+   * @brief Prepare job precomputing the next chunk of the send schedule up to the time
+   *
+   * Must be called from the simulator thread after the application is installed and configured;
+   * the first call must be made before the application starts.  The returned job touches only
+   * state of this application and draws from the application's own generator, so it can be run
+   * from any thread (see ConsumerScheduleHelper) and the schedule does not depend on the number
+   * of threads.
+   *
+   * Randomized gaps are precomputed for Interests sent before the time (or StopTime of the
+   * application, if earlier), but at most chunkSize of them are kept at once: values already
+   * used are discarded and the job only tops the buffer up.  Whenever the buffer runs empty
+   * during the simulation, the next values are drawn in place from the same generator, so the
+   * schedule does not depend on the chunk size or on how often the buffer is refilled either.
+   *
+   * @return job to run, or empty function if there is nothing to precompute (gaps are not
+   *         randomized, the time is reached, or the buffer is still at least half full)
+   */
+  std::function<void()>
+  PrepareSchedule(const Time& until, size_t chunkSize);
+
 protected:
+  // from App
+  virtual void
+  StartApplication();
+
+  /**
+   * @brief Construct Interest name /<Prefix>/<random suffix>
+   *
+   * The name is copied from the cached binary prefix and the suffix is appended as a single
+   * binary component of suffixLength characters, so no URI formatting or parsing is involved.
+   * Callers can append further components (e.g., sequence number) to the returned name.
+   */
+  shared_ptr<Name>
+  MakeRandomSuffixName(size_t suffixLength);
+
   /**
    * \brief Constructs the Interest packet and sends it using a callback to the underlying NDN
    * protocol
@@ -78,16 +308,95 @@ protected:
   virtual void
   SendPacket();
 
+  /**
+   * @brief Send out Interests that are due within the batch window in a single event
+   *
+   * SendPacket is called repeatedly while it requests the next packet (calls ScheduleNextPacket)
+   * and the send time of the next packet, counted from the time of the event, does not exceed
+   * BatchWindow (at most BatchSize Interests per event).  Only then the next event is scheduled
+   * in the simulator, at the exact send time of the first Interest that did not fit.
+   */
+  void
+  SendBatch();
+
+  /**
+   * @brief Get the gap until the next Interest
+   *
+   * Randomized gaps are drawn BatchSize at a time from the same random variable, so the sequence
+   * of gaps does not depend on the batch size.  With a precomputed schedule, they are taken from
+   * the schedule (see PrepareSchedule).
+   */
+  Time
+  GetNextInterval();
+
   virtual void
   OnData(shared_ptr<const Data> data);
 
+  /**
+   * @brief Check if the application has per-Interest values to precompute
+   *
+   * Randomized gaps, unless a subclass precomputes other values too
+   */
+  virtual bool
+  HasScheduleValues() const;
+
+  /**
+   * @brief Draw values of the next Interest of the precomputed schedule
+   *
+   * Appends the randomized gap after the Interest to m_intervals; subclasses append their own
+   * per-Interest values.  Called by workers when a chunk is precomputed and by the simulator
+   * thread when precomputed values are used up.
+   *
+   * @return the gap (in seconds)
+   */
+  virtual double
+  AppendScheduleEntry();
+
+  /**
+   * @brief Get number of precomputed Interests that are not sent yet
+   */
+  virtual size_t
+  GetNScheduleEntries() const;
+
+  /**
+   * @brief Discard precomputed values that were already used
+   */
+  virtual void
+  CompactSchedule();
+
+  /**
+   * @brief Precompute values of at most count Interests sent within the schedule horizon
+   *
+   * Runs in a worker thread; only plain values of this application are accessed
+   */
+  void
+  FillSchedule(size_t count);
+
+  /**
+   * @brief Get rate of Interests sent by the application (in hertz)
+   *
+   * Frequency, unless a subclass models several request processes
+   */
+  virtual double
+  GetRate() const;
+
   /**
    * @brief Set type of frequency randomization
    * @param value Either 'none', 'uniform', or 'exponential'
+   *
+   * Randomized gaps that were drawn (or precomputed) for the previous type are discarded
    */
   void
   SetRandomize(const std::string& value);
 
+  /**
+   * @brief Re-create random variable of the current randomization type for the current rate
+   *
+   * Unlike SetRandomize, gaps that were already drawn or precomputed are kept
+   */
+  void
+  UpdateRandom();
+
   /**
    * @brief Get type of frequency randomization
    * @returns either 'none', 'uniform', or 'exponential'
@@ -100,6 +409,20 @@ protected:
   bool m_firstTime;
   RandomVariable* m_random;
   std::string m_randomType;
+
+  uint32_t m_batchSize; ///< \brief maximum number of Interests sent out by a single event
+  Time m_batchWindow;   ///< \brief maximum shift of an Interest's send time to join the batch
+  std::vector<double> m_intervals; ///< \brief pre-drawn randomized gaps (in seconds)
+  size_t m_nextInterval;
+  bool m_isSendingBatch;
+  bool m_isNextPacketRequested;
+
+  NameSuffixGenerator m_suffixGenerator; ///< \brief per-application generator of random name suffixes
+  bool m_isStreamAssigned;
+  NameSuffixGenerator m_scheduleGenerator; ///< \brief generator of the precomputed schedule
+  bool m_hasSchedule;       ///< \brief values are taken from the schedule generator
+  double m_scheduleHorizon; ///< \brief period (in seconds) covered by the precomputed schedule
+  double m_scheduleTime;    ///< \brief send time (in seconds) of the next Interest to precompute
 };
 
 } // namespace ndn
@@ -27,6 +27,10 @@
 #include "ns3/uinteger.h"
 #include "ns3/double.h"
 
+#include <algorithm>
+#include <limits>
+#include <vector>
+
 NS_LOG_COMPONENT_DEFINE("ndn.ConsumerWindow");
 
 namespace ns3 {
@@ -175,6 +179,52 @@ ConsumerWindow::ScheduleNextPacket()
   }
 }
 
+void
+ConsumerWindow::SendPacket()
+{
+  if (!m_active)
+    return;
+
+  if (!m_retxSeqs.empty() || m_inFlight >= m_window) {
+    Consumer::SendPacket();
+    return;
+  }
+
+  NS_LOG_FUNCTION_NOARGS();
+
+  uint32_t count = m_window - m_inFlight;
+  if (m_seqMax != std::numeric_limits<uint32_t>::max()) {
+    if (m_seq >= m_seqMax) {
+      return; // we are totally done
+    }
+    count = std::min(count, m_seqMax - m_seq);
+  }
+
+  uint32_t firstSeq = m_seq;
+  m_seq += count;
+
+  time::milliseconds interestLifeTime(m_interestLifeTime.GetMilliSeconds());
+  m_interestFactory.SetInterestLifetime(interestLifeTime);
+
+  std::vector<shared_ptr<Interest>> interests;
+  interests.reserve(count);
+  for (uint32_t i = 0; i < count; i++) {
+    interests.push_back(m_interestFactory.Create(m_interestName, firstSeq + i,
+                                                 static_cast<uint32_t>(m_rand.GetValue())));
+  }
+
+  NS_LOG_INFO("> Interests for " << firstSeq << ".." << firstSeq + count - 1);
+
+  WillSendOutInterests(firstSeq, count);
+
+  for (const shared_ptr<Interest>& interest : interests) {
+    m_transmittedInterests(interest, this, m_face);
+    m_face->onReceiveInterest(*interest);
+  }
+
+  ScheduleNextPacket();
+}
+
 ///////////////////////////////////////////////////
 //          Process incoming packets             //
 ///////////////////////////////////////////////////
@@ -215,5 +265,12 @@ ConsumerWindow::WillSendOutInterest(uint32_t sequenceNumber)
   Consumer::WillSendOutInterest(sequenceNumber);
 }
 
+void
+ConsumerWindow::WillSendOutInterests(uint32_t sequenceNumber, uint32_t count)
+{
+  m_inFlight = m_inFlight + count;
+  Consumer::WillSendOutInterests(sequenceNumber, count);
+}
+
 } // namespace ndn
 } // namespace ns3
@@ -56,6 +56,19 @@ public:
   virtual void
   WillSendOutInterest(uint32_t sequenceNumber);
 
+  virtual void
+  WillSendOutInterests(uint32_t sequenceNumber, uint32_t count);
+
+  /**
+   * \brief Send out Interests for all free slots of the window at once
+   *
+   * Retransmissions (and the probe sent while the window is closed) are sent one by one as in
+   * Consumer; new Interests filling the window get consecutive sequence numbers and are reported
+   * to the RTT estimator in one block
+   */
+  virtual void
+  SendPacket();
+
 protected:
   /**
    * \brief Constructs the Interest packet and sends it using a callback to the underlying NDN
@@ -25,6 +25,7 @@
 #include "utils/ndn-fw-hop-count-tag.hpp"
 
 #include <math.h>
+#include <algorithm>
 
 NS_LOG_COMPONENT_DEFINE("ndn.ConsumerZipfMandelbrot");
 
@@ -65,6 +66,7 @@ ConsumerZipfMandelbrot::ConsumerZipfMandelbrot()
   , m_q(0.7)
   , m_s(0.7)
   , m_SeqRng(0.0, 1.0)
+  , m_nextContent(0)
 {
   // SetNumberOfContents is called by NS-3 object system during the initialization
 }
@@ -179,28 +181,64 @@ ConsumerZipfMandelbrot::SendPacket()
 
   // NS_LOG_INFO ("Requesting Interest: \n" << *interest);
   NS_LOG_INFO("> Interest for " << seq << ", Total: " << m_seq << ", face: " << m_face->getId());
-  NS_LOG_DEBUG("Trying to add " << seq << " with " << Simulator::Now() << ". already "
-                                << m_seqTimeouts.size() << " items");
+  Consumer::WillSendOutInterest(seq);
 
-  m_seqTimeouts.insert(SeqTimeout(seq, Simulator::Now()));
-  m_seqFullDelay.insert(SeqTimeout(seq, Simulator::Now()));
+  m_transmittedInterests(interest, this, m_face);
+  m_face->onReceiveInterest(*interest);
 
-  m_seqLastDelay.erase(seq);
-  m_seqLastDelay.insert(SeqTimeout(seq, Simulator::Now()));
+  ScheduleNextPacket();
+}
 
-  m_seqRetxCounts[seq]++;
+bool
+ConsumerZipfMandelbrot::HasScheduleValues() const
+{
+  return true;
+}
+
+double
+ConsumerZipfMandelbrot::AppendScheduleEntry()
+{
+  double interval = ConsumerCbr::AppendScheduleEntry();
+  m_contents.push_back(GetContentIndex(m_scheduleGenerator.NextDouble()));
+  return interval;
+}
 
-  m_rtt->SentSeq(SequenceNumber32(seq), 1);
+size_t
+ConsumerZipfMandelbrot::GetNScheduleEntries() const
+{
+  return m_contents.size() - m_nextContent;
+}
 
-  m_transmittedInterests(interest, this, m_face);
-  m_face->onReceiveInterest(*interest);
+void
+ConsumerZipfMandelbrot::CompactSchedule()
+{
+  ConsumerCbr::CompactSchedule();
 
-  ConsumerZipfMandelbrot::ScheduleNextPacket();
+  m_contents.erase(m_contents.begin(), m_contents.begin() + m_nextContent);
+  m_nextContent = 0;
+}
+
+uint32_t
+ConsumerZipfMandelbrot::GetContentIndex(double p) const
+{
+  // first i in [1, m_N] with p <= m_Pcum[i], same as the linear search in GetNextSeq
+  auto i = std::lower_bound(m_Pcum.begin() + 1, m_Pcum.end(), p);
+  if (i == m_Pcum.end())
+    return 1;
+  return static_cast<uint32_t>(i - m_Pcum.begin());
 }
 
 uint32_t
 ConsumerZipfMandelbrot::GetNextSeq()
 {
+  if (m_hasSchedule) {
+    if (m_nextContent >= m_contents.size()) {
+      CompactSchedule();
+      m_scheduleTime += AppendScheduleEntry();
+    }
+    return m_contents[m_nextContent++];
+  }
+
   uint32_t content_index = 1; //[1, m_N]
   double p_sum = 0;
 
@@ -223,19 +261,5 @@ ConsumerZipfMandelbrot::GetNextSeq()
   return content_index;
 }
 
-void
-ConsumerZipfMandelbrot::ScheduleNextPacket()
-{
-
-  if (m_firstTime) {
-    m_sendEvent = Simulator::Schedule(Seconds(0.0), &ConsumerZipfMandelbrot::SendPacket, this);
-    m_firstTime = false;
-  }
-  else if (!m_sendEvent.IsRunning())
-    m_sendEvent = Simulator::Schedule((m_random == 0) ? Seconds(1.0 / m_frequency)
-                                                      : Seconds(m_random->GetValue()),
-                                      &ConsumerZipfMandelbrot::SendPacket, this);
-}
-
 } /* namespace ndn */
 } /* namespace ns3 */
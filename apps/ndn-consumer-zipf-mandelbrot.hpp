@@ -67,8 +67,23 @@ public:
   GetNextSeq();
 
 protected:
+  /**
+   * @brief Requested contents are precomputed whether or not gaps are randomized
+   */
+  virtual bool
+  HasScheduleValues() const;
+
+  /**
+   * @brief Draw the gap and then the requested content of the next Interest
+   */
+  virtual double
+  AppendScheduleEntry();
+
+  virtual size_t
+  GetNScheduleEntries() const;
+
   virtual void
-  ScheduleNextPacket();
+  CompactSchedule();
 
 private:
   void
@@ -89,6 +104,12 @@ private:
   double
   GetS() const;
 
+  /**
+   * @brief Get content index for the value drawn uniformly from (0, 1]
+   */
+  uint32_t
+  GetContentIndex(double p) const;
+
 private:
   uint32_t m_N;               // number of the contents
   double m_q;                 // q in (k+q)^s
@@ -96,6 +117,9 @@ private:
   std::vector<double> m_Pcum; // cumulative probability
 
   UniformVariable m_SeqRng; // RNG
+
+  std::vector<uint32_t> m_contents; // precomputed content indices
+  size_t m_nextContent;
 };
 
 } /* namespace ndn */
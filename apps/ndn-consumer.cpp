@@ -33,6 +33,8 @@
 #include "model/ndn-app-face.hpp"
 #include "utils/ndn-rtt-mean-deviation.hpp"
 
+#include <algorithm>
+
 #include <boost/lexical_cast.hpp>
 #include <boost/ref.hpp>
 
@@ -59,7 +61,8 @@ Consumer::GetTypeId(void)
                     MakeTimeAccessor(&Consumer::m_interestLifeTime), MakeTimeChecker())
 
       .AddAttribute("RetxTimer",
-                    "Timeout defining how frequent retransmission timeouts should be checked",
+                    "Minimum interval between two checks of retransmission timeouts "
+                    "(checks are scheduled only while timeouts are armed)",
                     StringValue("50ms"),
                     MakeTimeAccessor(&Consumer::GetRetxTimer, &Consumer::SetRetxTimer),
                     MakeTimeChecker())
@@ -79,6 +82,7 @@ Consumer::Consumer()
   : m_rand(0, std::numeric_limits<uint32_t>::max())
   , m_seq(0)
   , m_seqMax(0) // don't request anything
+  , m_retxTimerId(0)
 {
   NS_LOG_FUNCTION_NOARGS();
 
@@ -89,13 +93,13 @@ void
 Consumer::SetRetxTimer(Time retxTimer)
 {
   m_retxTimer = retxTimer;
-  if (m_retxEvent.IsRunning()) {
-    // m_retxEvent.Cancel (); // cancel any scheduled cleanup events
-    Simulator::Remove(m_retxEvent); // slower, but better for memory
-  }
 
-  // schedule even with new timeout
-  m_retxEvent = Simulator::Schedule(m_retxTimer, &Consumer::CheckRetxTimeout, this);
+  // the pending check may now be due earlier or later
+  if (m_timerWheel != 0 && m_retxTimerId != 0) {
+    m_timerWheel->Cancel(m_retxTimerId);
+    m_retxTimerId = 0;
+    ScheduleRetxCheck();
+  }
 }
 
 Time
@@ -107,25 +111,46 @@ Consumer::GetRetxTimer() const
 void
 Consumer::CheckRetxTimeout()
 {
+  m_retxTimerId = 0;
+
   Time now = Simulator::Now();
+  m_lastRetxCheck = now;
 
   Time rto = m_rtt->RetransmitTimeout();
   // NS_LOG_DEBUG ("Current RTO: " << rto.ToDouble (Time::S) << "s");
 
-  while (!m_seqTimeouts.empty()) {
-    SeqTimeoutsContainer::index<i_timestamp>::type::iterator entry =
-      m_seqTimeouts.get<i_timestamp>().begin();
-    if (entry->time + rto <= now) // timeout expired?
-    {
-      uint32_t seqNo = entry->seq;
-      m_seqTimeouts.get<i_timestamp>().erase(entry);
-      OnTimeout(seqNo);
+  while (!m_timeoutQueue.empty()) {
+    std::pair<Time, uint32_t> timeout = m_timeoutQueue.front();
+
+    // skip if Interest has been satisfied or its timeout re-armed since
+    OutstandingInterest* entry = m_outstanding.Find(timeout.second);
+    if (entry == 0 || !entry->isTimeoutPending || entry->timeoutBase != timeout.first) {
+      m_timeoutQueue.pop_front();
+      continue;
     }
-    else
+
+    if (timeout.first + rto > now)
       break; // nothing else to do. All later packets need not be retransmitted
+
+    m_timeoutQueue.pop_front();
+    entry->isTimeoutPending = false;
+    OnTimeout(timeout.second);
   }
 
-  m_retxEvent = Simulator::Schedule(m_retxTimer, &Consumer::CheckRetxTimeout, this);
+  ScheduleRetxCheck();
+}
+
+void
+Consumer::ScheduleRetxCheck()
+{
+  if (m_timerWheel == 0 || m_retxTimerId != 0 || m_timeoutQueue.empty())
+    return;
+
+  Time now = Simulator::Now();
+  Time deadline = std::max(m_timeoutQueue.front().first + m_rtt->RetransmitTimeout(),
+                           m_lastRetxCheck + m_retxTimer);
+  m_retxTimerId = m_timerWheel->Schedule(deadline > now ? deadline - now : Time(0),
+                                         MakeCallback(&Consumer::CheckRetxTimeout, this));
 }
 
 // Application Methods
@@ -137,6 +162,9 @@ Consumer::StartApplication() // Called at time specified by Start
   // do base stuff
   App::StartApplication();
 
+  m_timerWheel = TimerWheel::GetTimerWheel(GetNode());
+  ScheduleRetxCheck();
+
   ScheduleNextPacket();
 }
 
@@ -148,6 +176,13 @@ Consumer::StopApplication() // Called at time specified by Stop
   // cancel periodic packet generation
   Simulator::Cancel(m_sendEvent);
 
+  // cancel retransmission checks
+  if (m_timerWheel != 0) {
+    m_timerWheel->Cancel(m_retxTimerId);
+    m_retxTimerId = 0;
+    m_timerWheel = 0;
+  }
+
   // cleanup base stuff
   App::StopApplication();
 }
@@ -178,17 +213,10 @@ Consumer::SendPacket()
     seq = m_seq++;
   }
 
-  //
-  shared_ptr<Name> nameWithSequence = make_shared<Name>(m_interestName);
-  nameWithSequence->appendSequenceNumber(seq);
-  //
-
-  // shared_ptr<Interest> interest = make_shared<Interest> ();
-  shared_ptr<Interest> interest = make_shared<Interest>();
-  interest->setNonce(m_rand.GetValue());
-  interest->setName(*nameWithSequence);
   time::milliseconds interestLifeTime(m_interestLifeTime.GetMilliSeconds());
-  interest->setInterestLifetime(interestLifeTime);
+  m_interestFactory.SetInterestLifetime(interestLifeTime);
+  shared_ptr<Interest> interest =
+    m_interestFactory.Create(m_interestName, seq, static_cast<uint32_t>(m_rand.GetValue()));
 
   // NS_LOG_INFO ("Requesting Interest: \n" << *interest);
   NS_LOG_INFO("> Interest for " << seq);
@@ -224,28 +252,18 @@ Consumer::OnData(shared_ptr<const Data> data)
   int hopCount = -1;
   auto ns3PacketTag = data->getTag<Ns3PacketTag>();
   if (ns3PacketTag != nullptr) {
-    FwHopCountTag hopCountTag;
-    if (ns3PacketTag->getPacket()->PeekPacketTag(hopCountTag)) {
-      hopCount = hopCountTag.Get();
-      NS_LOG_DEBUG("Hop count: " << hopCount);
-    }
+    hopCount = ns3PacketTag->getHopCount();
+    NS_LOG_DEBUG("Hop count: " << hopCount);
   }
 
-  SeqTimeoutsContainer::iterator entry = m_seqLastDelay.find(seq);
-  if (entry != m_seqLastDelay.end()) {
-    m_lastRetransmittedInterestDataDelay(this, seq, Simulator::Now() - entry->time, hopCount);
+  OutstandingInterest* entry = m_outstanding.Find(seq);
+  if (entry != 0) {
+    m_lastRetransmittedInterestDataDelay(this, seq, Simulator::Now() - entry->lastSent, hopCount);
+    m_firstInterestDataDelay(this, seq, Simulator::Now() - entry->firstSent, entry->retxCount,
+                             hopCount);
+    m_outstanding.Erase(seq);
   }
 
-  entry = m_seqFullDelay.find(seq);
-  if (entry != m_seqFullDelay.end()) {
-    m_firstInterestDataDelay(this, seq, Simulator::Now() - entry->time, m_seqRetxCounts[seq], hopCount);
-  }
-
-  m_seqRetxCounts.erase(seq);
-  m_seqFullDelay.erase(seq);
-  m_seqLastDelay.erase(seq);
-
-  m_seqTimeouts.erase(seq);
   m_retxSeqs.erase(seq);
 
   m_rtt->AckSeq(SequenceNumber32(seq));
@@ -265,21 +283,54 @@ Consumer::OnTimeout(uint32_t sequenceNumber)
   ScheduleNextPacket();
 }
 
+TableMemoryUsage
+Consumer::GetMemoryUsage() const
+{
+  static const size_t setNodeSize = sizeof(uint32_t) + 3 * sizeof(void*);
+
+  return TableMemoryUsage(m_outstanding.GetSize() + m_retxSeqs.size() + m_timeoutQueue.size(),
+                          m_outstanding.GetMemoryUsage() + m_retxSeqs.size() * setNodeSize
+                            + m_timeoutQueue.size() * sizeof(std::pair<Time, uint32_t>));
+}
+
 void
 Consumer::WillSendOutInterest(uint32_t sequenceNumber)
+{
+  TrackOutstanding(sequenceNumber);
+  m_rtt->SentSeq(SequenceNumber32(sequenceNumber), 1);
+}
+
+void
+Consumer::WillSendOutInterests(uint32_t sequenceNumber, uint32_t count)
+{
+  for (uint32_t i = 0; i < count; i++) {
+    TrackOutstanding(sequenceNumber + i);
+  }
+  m_rtt->SentSeqs(SequenceNumber32(sequenceNumber), count);
+}
+
+void
+Consumer::TrackOutstanding(uint32_t sequenceNumber)
 {
   NS_LOG_DEBUG("Trying to add " << sequenceNumber << " with " << Simulator::Now() << ". already "
-                                << m_seqTimeouts.size() << " items");
+                                << m_outstanding.GetSize() << " items");
 
-  m_seqTimeouts.insert(SeqTimeout(sequenceNumber, Simulator::Now()));
-  m_seqFullDelay.insert(SeqTimeout(sequenceNumber, Simulator::Now()));
+  Time now = Simulator::Now();
 
-  m_seqLastDelay.erase(sequenceNumber);
-  m_seqLastDelay.insert(SeqTimeout(sequenceNumber, Simulator::Now()));
+  OutstandingInterest* entry = m_outstanding.Insert(sequenceNumber);
 
-  m_seqRetxCounts[sequenceNumber]++;
+  if (entry->retxCount == 0)
+    entry->firstSent = now;
+  entry->lastSent = now;
+  entry->retxCount++;
 
-  m_rtt->SentSeq(SequenceNumber32(sequenceNumber), 1);
+  // timeout is counted from the first transmission after the previous timeout
+  if (!entry->isTimeoutPending) {
+    entry->isTimeoutPending = true;
+    entry->timeoutBase = now;
+    m_timeoutQueue.push_back(std::make_pair(now, sequenceNumber));
+    ScheduleRetxCheck();
+  }
 }
 
 } // namespace ndn
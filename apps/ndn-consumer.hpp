@@ -31,14 +31,12 @@
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 #include "ns3/ndnSIM/utils/ndn-rtt-estimator.hpp"
 #include "ns3/ndnSIM/utils/ndn-fw-hop-count-tag.hpp"
+#include "ns3/ndnSIM/utils/ndn-outstanding-interest-table.hpp"
+#include "ns3/ndnSIM/utils/ndn-timer-wheel.hpp"
+#include "ns3/ndnSIM/utils/ndn-interest-factory.hpp"
 
 #include <set>
-#include <map>
-
-#include <boost/multi_index_container.hpp>
-#include <boost/multi_index/tag.hpp>
-#include <boost/multi_index/ordered_index.hpp>
-#include <boost/multi_index/member.hpp>
+#include <deque>
 
 namespace ns3 {
 namespace ndn {
@@ -89,6 +87,23 @@ public:
   virtual void
   WillSendOutInterest(uint32_t sequenceNumber);
 
+  /**
+   * @brief An event that is fired just before a block of Interests with consecutive sequence
+   *        numbers is sent out
+   *
+   * Same as WillSendOutInterest for every sequence number, but the RTT estimator is updated by a
+   * single SentSeqs call
+   *
+   * @param sequenceNumber first sequence number of the block
+   * @param count number of Interests
+   */
+  virtual void
+  WillSendOutInterests(uint32_t sequenceNumber, uint32_t count);
+
+  // From App
+  virtual TableMemoryUsage
+  GetMemoryUsage() const;
+
 protected:
   // from App
   virtual void
@@ -106,12 +121,31 @@ protected:
 
   /**
    * \brief Checks if the packet need to be retransmitted becuase of retransmission timer expiration
+   *
+   * Called from the timer wheel shared by all applications on the node, when the oldest armed
+   * timeout is due
    */
   void
   CheckRetxTimeout();
 
   /**
-   * \brief Modifies the frequency of checking the retransmission timeouts
+   * \brief Schedule CheckRetxTimeout for the deadline of the oldest armed timeout
+   *
+   * Nothing is scheduled while no timeout is armed.  Checks are at least RetxTimer apart, so
+   * timeouts expiring close to each other are handled by one check.  The deadline uses the current
+   * RTO; a check that finds nothing expired (RTO grew since) schedules the next one.
+   */
+  void
+  ScheduleRetxCheck();
+
+  /**
+   * \brief Add the Interest to the outstanding Interest table and arm its retransmission timeout
+   */
+  void
+  TrackOutstanding(uint32_t sequenceNumber);
+
+  /**
+   * \brief Modifies the minimum interval between checks of the retransmission timeouts
    * \param retxTimer Timeout defining how frequent retransmission timeouts should be checked
    */
   void
@@ -131,13 +165,17 @@ protected:
   uint32_t m_seqMax;   ///< @brief maximum number of sequence number
   EventId m_sendEvent; ///< @brief EventId of pending "send packet" event
   Time m_retxTimer;    ///< @brief Currently estimated retransmission timer
-  EventId m_retxEvent; ///< @brief Event to check whether or not retransmission should be performed
+
+  Ptr<TimerWheel> m_timerWheel; ///< @brief Node's timer wheel that drives retransmission checks
+  TimerWheel::TimerId m_retxTimerId; ///< @brief Pending retransmission check, 0 if none
+  Time m_lastRetxCheck;              ///< @brief Time of the last retransmission check
 
   Ptr<RttEstimator> m_rtt; ///< @brief RTT estimator
 
   Time m_offTime;          ///< \brief Time interval between packets
   Name m_interestName;     ///< \brief NDN Name of the Interest (use Name)
   Time m_interestLifeTime; ///< \brief LifeTime for interest packet
+  InterestFactory m_interestFactory; ///< \brief Builder of /<m_interestName>/<seq> Interests
 
   /// @cond include_hidden
   /**
@@ -148,54 +186,15 @@ protected:
 
   RetxSeqsContainer m_retxSeqs; ///< \brief ordered set of sequence numbers to be retransmitted
 
-  /**
-   * \struct This struct contains a pair of packet sequence number and its timeout
-   */
-  struct SeqTimeout {
-    SeqTimeout(uint32_t _seq, Time _time)
-      : seq(_seq)
-      , time(_time)
-    {
-    }
-
-    uint32_t seq;
-    Time time;
-  };
-  /// @endcond
+  OutstandingInterestTable m_outstanding; ///< \brief send times and retx counts of Interests
 
-  /// @cond include_hidden
-  class i_seq {
-  };
-  class i_timestamp {
-  };
-  /// @endcond
-
-  /// @cond include_hidden
   /**
-   * \struct This struct contains a multi-index for the set of SeqTimeout structs
+   * \brief Armed retransmission timeouts (base time, seq) in order of arming
+   *
+   * Items are validated against m_outstanding when they expire, so an Interest satisfied before
+   * its timeout does not need to be removed from the queue
    */
-  struct SeqTimeoutsContainer
-    : public boost::multi_index::
-        multi_index_container<SeqTimeout,
-                              boost::multi_index::
-                                indexed_by<boost::multi_index::
-                                             ordered_unique<boost::multi_index::tag<i_seq>,
-                                                            boost::multi_index::
-                                                              member<SeqTimeout, uint32_t,
-                                                                     &SeqTimeout::seq>>,
-                                           boost::multi_index::
-                                             ordered_non_unique<boost::multi_index::
-                                                                  tag<i_timestamp>,
-                                                                boost::multi_index::
-                                                                  member<SeqTimeout, Time,
-                                                                         &SeqTimeout::time>>>> {
-  };
-
-  SeqTimeoutsContainer m_seqTimeouts; ///< \brief multi-index for the set of SeqTimeout structs
-
-  SeqTimeoutsContainer m_seqLastDelay;
-  SeqTimeoutsContainer m_seqFullDelay;
-  std::map<uint32_t, uint32_t> m_seqRetxCounts;
+  std::deque<std::pair<Time, uint32_t>> m_timeoutQueue;
 
   TracedCallback<Ptr<App> /* app */, uint32_t /* seqno */, Time /* delay */, int32_t /*hop count*/>
     m_lastRetransmittedInterestDataDelay;
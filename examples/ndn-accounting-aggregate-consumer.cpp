@@ -0,0 +1,132 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-accounting-aggregate-consumer.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/apps/accounting-aggregate-consumer.hpp"
+
+#include <iostream>
+
+namespace ns3 {
+
+/**
+ * This scenario simulates GROUP_SIZE accounting consumers attached to each of two edge
+ * routers, as in the ATT/DFN scenarios, but every group is modeled by one
+ * AccountingAggregateConsumer installed on a single node:
+ *
+ *   +-------------+      +--------+
+ *   | consumers 0 | <--> | edge 0 | <--+
+ *   +-------------+      +--------+    |    +------+      +----------+
+ *                                      +--> | core | <--> | producer |
+ *   +-------------+      +--------+    |    +------+      +----------+
+ *   | consumers 1 | <--> | edge 1 | <--+
+ *   +-------------+      +--------+
+ *
+ * Every logical consumer requests content 10 times a second on average (Poisson process).  At the
+ * end of the simulation, the per-consumer statistics are printed.
+ *
+ * To run scenario and see what is happening, use the following command:
+ *
+ *     ./waf --run=ndn-accounting-aggregate-consumer
+ */
+
+static const uint32_t GROUP_SIZE = 80;
+
+int
+main(int argc, char* argv[])
+{
+  // setting default parameters for PointToPoint links and channels
+  Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("1000Mbps"));
+  Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+  Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("4294967295"));
+
+  // Read optional command-line parameters (e.g., enable visualizer with ./waf --run=<> --visualize
+  CommandLine cmd;
+  cmd.Parse(argc, argv);
+
+  // Creating nodes: 2 consumer groups, 2 edge routers, core router, producer
+  NodeContainer nodes;
+  nodes.Create(6);
+
+  PointToPointHelper p2p;
+  p2p.Install(nodes.Get(0), nodes.Get(2));
+  p2p.Install(nodes.Get(1), nodes.Get(3));
+  p2p.Install(nodes.Get(2), nodes.Get(4));
+  p2p.Install(nodes.Get(3), nodes.Get(4));
+  p2p.Install(nodes.Get(4), nodes.Get(5));
+
+  // Install NDN stack on all nodes
+  ndn::StackHelper ndnHelper;
+  ndnHelper.SetDefaultRoutes(true);
+  ndnHelper.InstallAll();
+
+  // Installing applications
+
+  // Consumer groups
+  ndn::AppHelper consumerHelper("ns3::ndn::AccountingAggregateConsumer");
+  consumerHelper.SetPrefix("/prefix/A/");
+  consumerHelper.SetAttribute("Frequency", StringValue("10")); // per logical consumer
+  consumerHelper.SetAttribute("Randomize", StringValue("exponential"));
+  consumerHelper.SetAttribute("NConsumers", UintegerValue(GROUP_SIZE));
+
+  ApplicationContainer consumers;
+  for (uint32_t group = 0; group < 2; group++) {
+    consumerHelper.SetAttribute("FirstConsumerID", IntegerValue(group * GROUP_SIZE));
+    consumers.Add(consumerHelper.Install(nodes.Get(group)));
+  }
+
+  // Producer
+  ndn::AppHelper producerHelper("ns3::ndn::AccountingProducer");
+  producerHelper.SetPrefix("/prefix/A");
+  producerHelper.SetAttribute("PayloadSize", StringValue("1024"));
+  producerHelper.Install(nodes.Get(5));
+
+  Simulator::Stop(Seconds(20.0));
+
+  Simulator::Run();
+
+  // <consumer ID> \t <sent> \t <satisfied> \t <timed out> \t <mean delay> \t <max delay>
+  for (ApplicationContainer::Iterator app = consumers.Begin(); app != consumers.End(); ++app) {
+    Ptr<ndn::AccountingAggregateConsumer> group =
+      DynamicCast<ndn::AccountingAggregateConsumer>(*app);
+    for (uint32_t i = 0; i < group->GetNConsumers(); i++) {
+      std::cout << group->GetConsumerID(i) << "\t" << group->GetNSent(i) << "\t"
+                << group->GetNSatisfied(i) << "\t" << group->GetNTimedOut(i) << "\t"
+                << group->GetMeanRtt(i).ToDouble(Time::S) << "\t"
+                << group->GetMaxRtt(i).ToDouble(Time::S) << std::endl;
+    }
+  }
+
+  Simulator::Destroy();
+
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::main(argc, argv);
+}
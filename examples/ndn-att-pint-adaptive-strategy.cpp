@@ -0,0 +1,208 @@
+// ndn-att-pint-adaptive-strategy.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+#include <fstream>
+#include <chrono>
+
+#define GROUP_SIZE 10
+#define NUM_OF_GROUPS 16
+#define NUM_OF_ROUTERS 42
+#define USE_PINT true
+
+using namespace std;
+using namespace std::chrono;
+
+#define LATENCY_OUTPUT_FILE_NAME "att-pint-adaptive-strategy-latency-"
+#define DELAY_OUTPUT_FILE_NAME "att-pint-adaptive-strategy-delay-"
+#define RATE_OUTPUT_FILE_NAME "att-pint-adaptive-strategy-rate-"
+#define SIMULATION_DURATION 1000.0
+
+#include "../apps/accounting-consumer.hpp"
+#include "../apps/ndn-consumer-cbr.hpp"
+
+std::vector<ns3::ndn::NameTime*> rtts;
+
+// Strategy under test, also used as suffix of output file names:
+//  - best-route: /localhost/nfd/strategy/best-route
+//  - pint-adaptive: /localhost/nfd/strategy/pint-adaptive
+std::string strategy = "pint-adaptive";
+
+// Precompute send schedules of consumers using this many threads (0: no precomputation).
+// AccountingConsumer requests a fixed name, so only its randomized gaps are precomputed.  The
+// schedule does not depend on the number of threads; this is not a speedup (see
+// ConsumerScheduleHelper).
+uint32_t precomputeThreads = 0;
+
+// Interests (regular and PINT) that reached the producer, i.e., the upstream load
+uint64_t producerInterests = 0;
+
+void
+ReceivedMeaningfulContent(ns3::Ptr<ns3::ndn::AccountingConsumer> consumer)
+{
+    rtts.push_back(consumer->rtts.back());
+}
+
+namespace ns3 {
+  ofstream delayFile;
+
+  void
+  ProducerReceivedInterest(shared_ptr<const ndn::Interest>, Ptr<ndn::App>, shared_ptr<ndn::Face>)
+  {
+    producerInterests++;
+  }
+
+  void
+  ForwardingDelay(ns3::Time eventTime, float delay)
+  {
+    delayFile << eventTime.GetNanoSeconds() << "\t" << delay * 1000000000 << "\n";
+  }
+
+  int
+  run(int argc, char* argv[])
+  {
+    // Read optional command-line parameters (e.g., enable visualizer with ./waf --run=<> --visualize
+    CommandLine cmd;
+    cmd.AddValue("strategy", "Forwarding strategy on routers (best-route or pint-adaptive)", strategy);
+    cmd.AddValue("precompute-threads", "Threads precomputing consumer schedules (0: disabled)",
+                 precomputeThreads);
+    cmd.Parse(argc, argv);
+
+    if (strategy != "best-route" && strategy != "pint-adaptive") {
+      std::cerr << "Unknown strategy " << strategy << std::endl;
+      return 1;
+    }
+
+    delayFile.open(DELAY_OUTPUT_FILE_NAME + strategy);
+
+    // Reading the ATT topology: consumer groups C<g>-<i>, routers R<k>, and producer P0
+    AnnotatedTopologyReader topologyReader("", 25);
+    topologyReader.SetFileName("src/ndnSIM/examples/topologies/topo-att-pint.txt");
+    topologyReader.Read();
+
+    NodeContainer consumers;
+    NodeContainer routers;
+    for (int g = 0; g < NUM_OF_GROUPS; g++) {
+      for (int i = 0; i < GROUP_SIZE; i++) {
+        std::ostringstream name;
+        name << "C" << g << "-" << i;
+        consumers.Add(Names::Find<Node>(name.str()));
+      }
+    }
+    for (int k = 0; k < NUM_OF_ROUTERS; k++) {
+      std::ostringstream name;
+      name << "R" << k;
+      routers.Add(Names::Find<Node>(name.str()));
+    }
+    Ptr<Node> producer = Names::Find<Node>("P0");
+
+    // Install NDN stack without cache
+    ndn::StackHelper ndnHelperNoCache;
+    ndnHelperNoCache.SetDefaultRoutes(true);
+    ndnHelperNoCache.SetOldContentStore("ns3::ndn::cs::Nocache"); // no cache
+    // Install on consumers and producer
+    ndnHelperNoCache.Install(consumers);
+    ndnHelperNoCache.Install(producer);
+
+
+    // Install NDN stack with cache
+    ndn::StackHelper ndnHelperWithCache;
+    ndnHelperWithCache.SetDefaultRoutes(true);
+    ndnHelperWithCache.SetOldContentStore("ns3::ndn::cs::Freshness::Lru", "MaxSize", "0");
+    // Install on routers
+    for (int k = 0; k < NUM_OF_ROUTERS; k++) {
+      ndnHelperWithCache.InstallWithCallback(routers.Get(k), (size_t)&ForwardingDelay,
+                                             routers.Get(k)->GetId(), USE_PINT);
+    }
+
+    // Forwarding strategy for the content namespace
+    ndn::StrategyChoiceHelper::InstallAll("/prefix", "/localhost/nfd/strategy/" + strategy);
+
+    // Multipath routes towards the producer, so the strategy has a choice of upstreams
+    ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+    ndnGlobalRoutingHelper.InstallAll();
+
+    // Consumers
+    ndn::AppHelper consumerHelperHonest("ns3::ndn::AccountingConsumer");
+    consumerHelperHonest.SetAttribute("Frequency", StringValue("10")); // 10 interests a second
+    consumerHelperHonest.SetAttribute("Randomize", StringValue("uniform"));
+    consumerHelperHonest.SetAttribute("StartSeq", IntegerValue(0));
+    consumerHelperHonest.SetPrefix("/prefix/A/");
+    for(uint32_t i=0; i < consumers.GetN(); i++) {
+      consumerHelperHonest.SetAttribute("ConsumerID", IntegerValue(i));
+      ApplicationContainer consumer = consumerHelperHonest.Install(consumers.Get(i));
+      consumer.Start(Seconds(0));
+
+      std::ostringstream node_id;
+      node_id << consumers.Get(i)->GetId();
+      Config::ConnectWithoutContext("/NodeList/" + node_id.str() + "/ApplicationList/0/ReceivedMeaningfulContent", MakeCallback(ReceivedMeaningfulContent));
+    }
+
+    // Producer
+    // Producer will reply to all requests starting with /prefix/A
+    ndn::AppHelper producerHelper("ns3::ndn::AccountingProducer");
+    producerHelper.SetPrefix("/prefix/A");
+    producerHelper.SetAttribute("PayloadSize", StringValue("1024"));
+    producerHelper.Install(producer);
+    producer->GetApplication(0)->TraceConnectWithoutContext("ReceivedInterests",
+                                                            MakeCallback(ProducerReceivedInterest));
+
+    ndnGlobalRoutingHelper.AddOrigins("/prefix/A", producer);
+    ndn::GlobalRoutingHelper::CalculateAllPossibleRoutes();
+
+    // Traces
+    // upstream load: compare InInterests on the producer and its access router
+    ndn::L3RateTracer::InstallAll(RATE_OUTPUT_FILE_NAME + strategy, Seconds(1.0));
+
+    steady_clock::time_point precomputeStart = steady_clock::now();
+    if (precomputeThreads > 0) {
+      ndn::ConsumerScheduleHelper scheduleHelper;
+      scheduleHelper.SetNThreads(precomputeThreads);
+      scheduleHelper.PrecomputeAll(Seconds(SIMULATION_DURATION));
+    }
+    steady_clock::time_point runStart = steady_clock::now();
+
+    Simulator::Stop(Seconds(SIMULATION_DURATION));
+
+    Simulator::Run();
+    Simulator::Destroy();
+
+    std::cout << "Wall-clock time: precompute "
+              << duration_cast<duration<double>>(runStart - precomputeStart).count() << "s, run "
+              << duration_cast<duration<double>>(steady_clock::now() - runStart).count() << "s"
+              << std::endl;
+
+    delayFile.close();
+    return 0;
+  }
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  int status = ns3::run(argc, argv);
+  if (status != 0)
+    return status;
+
+  // <event time> \t <RTT>
+  ofstream latencyFile;
+  latencyFile.open(LATENCY_OUTPUT_FILE_NAME + strategy);
+  for(std::vector<ns3::ndn::NameTime*>::iterator it = rtts.begin(); it != rtts.end(); ++it) {
+      ns3::ndn::NameTime *nt = *it;
+      latencyFile << nt->eventTime << "\t" << nt->rtt << std::endl;
+  }
+  latencyFile.close();
+
+  // summary for comparison of strategies: run with --strategy=best-route and --strategy=pint-adaptive
+  double totalRtt = 0;
+  for (std::vector<ns3::ndn::NameTime*>::iterator it = rtts.begin(); it != rtts.end(); ++it) {
+    totalRtt += (*it)->rtt.GetSeconds();
+  }
+  std::cout << "Strategy " << strategy << ": " << rtts.size() << " Data received, mean RTT "
+            << (rtts.empty() ? 0.0 : totalRtt / rtts.size() * 1000.0) << "ms, "
+            << producerInterests << " Interests at producer" << std::endl;
+  return 0;
+}
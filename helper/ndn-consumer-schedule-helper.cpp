@@ -0,0 +1,141 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-consumer-schedule-helper.hpp"
+
+#include "ns3/log.h"
+#include "ns3/node-list.h"
+#include "ns3/node.h"
+#include "ns3/simulator.h"
+
+#include "apps/ndn-consumer-cbr.hpp"
+#include "utils/ndn-work-stealing-pool.hpp"
+
+NS_LOG_COMPONENT_DEFINE("ndn.ConsumerScheduleHelper");
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @brief Consumers with precomputed schedules, kept by the pending refill event
+ */
+struct ScheduleRefill {
+  explicit ScheduleRefill(uint32_t nThreads)
+    : pool(nThreads)
+  {
+  }
+
+  WorkStealingPool pool;
+  std::vector<Ptr<ConsumerCbr>> consumers;
+  Time until;
+  size_t chunkSize;
+  Time interval;
+};
+
+static void
+refillSchedules(shared_ptr<ScheduleRefill> refill)
+{
+  std::vector<WorkStealingPool::Job> jobs;
+  for (const Ptr<ConsumerCbr>& consumer : refill->consumers) {
+    WorkStealingPool::Job job = consumer->PrepareSchedule(refill->until, refill->chunkSize);
+    if (job)
+      jobs.push_back(job);
+  }
+
+  NS_LOG_DEBUG("Refilling schedules of " << jobs.size() << " consumers");
+  refill->pool.Run(jobs);
+
+  if (Simulator::Now() + refill->interval < refill->until)
+    Simulator::Schedule(refill->interval, &refillSchedules, refill);
+}
+
+ConsumerScheduleHelper::ConsumerScheduleHelper()
+  : m_nThreads(0)
+  , m_chunkSize(4096)
+  , m_refillInterval(Seconds(1.0))
+{
+}
+
+void
+ConsumerScheduleHelper::SetNThreads(uint32_t nThreads)
+{
+  m_nThreads = nThreads;
+}
+
+void
+ConsumerScheduleHelper::SetChunkSize(size_t chunkSize)
+{
+  NS_ASSERT_MSG(chunkSize > 0, "Chunk size must be positive");
+  m_chunkSize = chunkSize;
+}
+
+void
+ConsumerScheduleHelper::SetRefillInterval(const Time& interval)
+{
+  NS_ASSERT_MSG(interval.IsStrictlyPositive(), "Refill interval must be positive");
+  m_refillInterval = interval;
+}
+
+uint32_t
+ConsumerScheduleHelper::Precompute(const ApplicationContainer& apps, const Time& until) const
+{
+  shared_ptr<ScheduleRefill> refill = make_shared<ScheduleRefill>(m_nThreads);
+  refill->until = until;
+  refill->chunkSize = m_chunkSize;
+  refill->interval = m_refillInterval;
+
+  std::vector<WorkStealingPool::Job> jobs;
+  for (ApplicationContainer::Iterator i = apps.Begin(); i != apps.End(); ++i) {
+    Ptr<ConsumerCbr> consumer = DynamicCast<ConsumerCbr>(*i);
+    if (consumer == 0)
+      continue;
+
+    WorkStealingPool::Job job = consumer->PrepareSchedule(until, m_chunkSize);
+    if (job) {
+      jobs.push_back(job);
+      refill->consumers.push_back(consumer);
+    }
+  }
+
+  NS_LOG_INFO("Precomputing schedules of " << jobs.size() << " consumers using "
+                                           << refill->pool.GetNThreads() << " threads");
+  refill->pool.Run(jobs);
+
+  // the next chunks are precomputed as the run proceeds
+  if (!jobs.empty() && refill->interval < until)
+    Simulator::Schedule(refill->interval, &refillSchedules, refill);
+
+  return jobs.size();
+}
+
+uint32_t
+ConsumerScheduleHelper::PrecomputeAll(const Time& until) const
+{
+  ApplicationContainer apps;
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); ++node) {
+    for (uint32_t i = 0; i < (*node)->GetNApplications(); ++i) {
+      apps.Add((*node)->GetApplication(i));
+    }
+  }
+
+  return Precompute(apps, until);
+}
+
+} // namespace ndn
+} // namespace ns3
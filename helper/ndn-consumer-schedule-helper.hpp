@@ -0,0 +1,117 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_CONSUMER_SCHEDULE_HELPER_H
+#define NDN_CONSUMER_SCHEDULE_HELPER_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/application-container.h"
+#include "ns3/nstime.h"
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Helper to precompute send schedules of consumer applications in parallel
+ *
+ * Per-consumer work that does not depend on the network (randomized gaps between Interests and,
+ * for ConsumerZipfMandelbrot, requested contents) is generated by a pool of worker threads, one
+ * job per consumer.  During the simulation consumers take the precomputed values in order from
+ * the single-threaded event loop.
+ *
+ * Values of at most ChunkSize Interests are kept per consumer.  The first chunk is precomputed
+ * before the simulation; every RefillInterval of simulation time, consumers that used up at
+ * least half of their chunk are topped up by the pool again.  A consumer that runs out between
+ * two refills draws the next values itself from the same generator, so the schedule does not
+ * depend on the chunk size or the refill interval.
+ *
+ * Each consumer draws from its own generator bound to a stream derived from the node ID and the
+ * index of the application on the node (or assigned with ConsumerCbr::AssignStreams), so the
+ * simulation results depend only on (RngSeed, RngRun) and not on the number of threads.  They
+ * differ, however, from a run without precomputation, which draws gaps from ns-3 random
+ * variables.
+ *
+ * This mode is not a speedup: only random draws are moved to the workers, and they are cheap
+ * compared to processing of simulator events.  Its purpose is a per-consumer schedule that is
+ * reproducible regardless of the number of threads.
+ *
+ * \code
+ *   ndn::ConsumerScheduleHelper scheduleHelper;
+ *   scheduleHelper.SetNThreads(16);
+ *   scheduleHelper.PrecomputeAll(Seconds(1000.0));
+ *
+ *   Simulator::Stop(Seconds(1000.0));
+ *   Simulator::Run();
+ * \endcode
+ */
+class ConsumerScheduleHelper {
+public:
+  ConsumerScheduleHelper();
+
+  /**
+   * @brief Set number of worker threads (0, the default, uses all hardware threads)
+   */
+  void
+  SetNThreads(uint32_t nThreads);
+
+  /**
+   * @brief Set maximum number of Interests precomputed per consumer at a time (default 4096)
+   */
+  void
+  SetChunkSize(size_t chunkSize);
+
+  /**
+   * @brief Set interval of simulation time between refills of the chunks (default 1 second)
+   *
+   * Should be shorter than the time a consumer takes to send half of a chunk, otherwise the
+   * consumer draws the rest of the values itself
+   */
+  void
+  SetRefillInterval(const Time& interval);
+
+  /**
+   * @brief Precompute schedules of consumers in the container up to the time
+   *
+   * Must be called before Simulator::Run, after the applications are configured.  Applications
+   * that are not ConsumerCbr (or subclasses of it) are skipped.  Schedules an event refilling
+   * the chunks until the time.
+   *
+   * @return number of consumers with precomputed schedules
+   */
+  uint32_t
+  Precompute(const ApplicationContainer& apps, const Time& until) const;
+
+  /**
+   * @brief Precompute schedules of consumers on all nodes up to the time
+   */
+  uint32_t
+  PrecomputeAll(const Time& until) const;
+
+private:
+  uint32_t m_nThreads;
+  size_t m_chunkSize;
+  Time m_refillInterval;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_CONSUMER_SCHEDULE_HELPER_H
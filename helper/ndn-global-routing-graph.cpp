@@ -0,0 +1,319 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-global-routing-graph.hpp"
+
+#include "model/ndn-global-router.hpp"
+
+#include "ns3/node-list.h"
+#include "ns3/channel-list.h"
+#include "ns3/node.h"
+#include "ns3/channel.h"
+#include "ns3/assert.h"
+
+#include <functional>
+#include <queue>
+
+namespace ns3 {
+namespace ndn {
+
+const uint32_t GlobalRoutingGraph::INVALID;
+const uint32_t GlobalRoutingGraph::METRIC_INF;
+
+GlobalRoutingGraph::GlobalRoutingGraph()
+{
+}
+
+GlobalRoutingGraph
+GlobalRoutingGraph::CreateFromGlobalRouters()
+{
+  GlobalRoutingGraph graph;
+
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    Ptr<GlobalRouter> gr = (*node)->GetObject<GlobalRouter>();
+    if (gr != 0)
+      graph.AddVertex(gr);
+  }
+
+  for (ChannelList::Iterator channel = ChannelList::Begin(); channel != ChannelList::End();
+       channel++) {
+    Ptr<GlobalRouter> gr = (*channel)->GetObject<GlobalRouter>();
+    if (gr != 0)
+      graph.AddVertex(gr);
+  }
+
+  for (uint32_t vertex = 0; vertex < graph.GetNVertices(); vertex++) {
+    for (const GlobalRouter::Incidency& incidency : graph.m_routers[vertex]->GetIncidencies()) {
+      const shared_ptr<Face>& face = std::get<1>(incidency);
+      uint32_t target = graph.FindVertex(std::get<2>(incidency));
+      NS_ASSERT_MSG(target != INVALID, "GlobalRouter is not installed on a node or channel");
+
+      graph.AddEdge(vertex, target, face == nullptr ? 0 : static_cast<uint16_t>(face->getMetric()),
+                    face);
+    }
+  }
+
+  graph.Finalize();
+  return graph;
+}
+
+uint32_t
+GlobalRoutingGraph::AddVertex(Ptr<GlobalRouter> router)
+{
+  uint32_t vertex = m_routers.size();
+  m_routers.push_back(router);
+  if (router != 0)
+    m_vertexOfRouter[PeekPointer(router)] = vertex;
+  return vertex;
+}
+
+void
+GlobalRoutingGraph::AddEdge(uint32_t from, uint32_t to, uint32_t metric, shared_ptr<Face> face)
+{
+  NS_ASSERT(from < GetNVertices() && to < GetNVertices());
+
+  PendingEdge edge = {from, to, metric};
+  m_pendingEdges.push_back(edge);
+  m_pendingFaces.push_back(face);
+}
+
+void
+GlobalRoutingGraph::Finalize()
+{
+  uint32_t nVertices = GetNVertices();
+
+  // counting sort of edges by source vertex, keeping the order of addition
+  m_edgesBegin.assign(nVertices + 1, 0);
+  for (const PendingEdge& edge : m_pendingEdges) {
+    m_edgesBegin[edge.from + 1]++;
+  }
+  for (uint32_t vertex = 0; vertex < nVertices; vertex++) {
+    m_edgesBegin[vertex + 1] += m_edgesBegin[vertex];
+  }
+
+  m_edges.resize(m_pendingEdges.size());
+  m_faces.resize(m_pendingEdges.size());
+
+  std::vector<uint32_t> position(m_edgesBegin.begin(), m_edgesBegin.end() - 1);
+  for (size_t i = 0; i < m_pendingEdges.size(); i++) {
+    const PendingEdge& pending = m_pendingEdges[i];
+    uint32_t edge = position[pending.from]++;
+
+    m_edges[edge].target = pending.to;
+    m_edges[edge].metric = pending.metric;
+    m_faces[edge] = m_pendingFaces[i];
+  }
+
+  // reversed edges, for paths towards a destination and undirected traversal
+  m_inEdgesBegin.assign(nVertices + 1, 0);
+  for (const PendingEdge& edge : m_pendingEdges) {
+    m_inEdgesBegin[edge.to + 1]++;
+  }
+  for (uint32_t vertex = 0; vertex < nVertices; vertex++) {
+    m_inEdgesBegin[vertex + 1] += m_inEdgesBegin[vertex];
+  }
+
+  m_inEdges.resize(m_pendingEdges.size());
+  position.assign(m_inEdgesBegin.begin(), m_inEdgesBegin.end() - 1);
+  for (const PendingEdge& pending : m_pendingEdges) {
+    InEdge& edge = m_inEdges[position[pending.to]++];
+    edge.source = pending.from;
+    edge.metric = pending.metric;
+  }
+
+  std::vector<PendingEdge>().swap(m_pendingEdges);
+  std::vector<shared_ptr<Face>>().swap(m_pendingFaces);
+}
+
+shared_ptr<Face>
+GlobalRoutingGraph::GetFace(uint32_t edge) const
+{
+  return m_faces[edge];
+}
+
+Ptr<GlobalRouter>
+GlobalRoutingGraph::GetRouter(uint32_t vertex) const
+{
+  return m_routers[vertex];
+}
+
+uint32_t
+GlobalRoutingGraph::FindVertex(Ptr<GlobalRouter> router) const
+{
+  auto vertex = m_vertexOfRouter.find(PeekPointer(router));
+  if (vertex == m_vertexOfRouter.end())
+    return INVALID;
+  else
+    return vertex->second;
+}
+
+void
+GlobalRoutingGraph::ShortestPaths(uint32_t source, std::vector<Distance>& distances,
+                                  uint32_t onlyFirstEdge) const
+{
+  NS_ASSERT(source < GetNVertices());
+
+  Distance unreachable = {METRIC_INF, INVALID};
+  distances.assign(GetNVertices(), unreachable);
+  distances[source].metric = 0;
+
+  // (metric, vertex), smallest first
+  typedef std::pair<uint32_t, uint32_t> QueueItem;
+  std::priority_queue<QueueItem, std::vector<QueueItem>, std::greater<QueueItem>> queue;
+  queue.push(QueueItem(0, source));
+
+  std::vector<bool> isDone(GetNVertices(), false);
+
+  while (!queue.empty()) {
+    QueueItem item = queue.top();
+    queue.pop();
+
+    uint32_t vertex = item.second;
+    if (isDone[vertex])
+      continue; // stale queue item
+    isDone[vertex] = true;
+
+    uint32_t begin = m_edgesBegin[vertex];
+    uint32_t end = m_edgesBegin[vertex + 1];
+    if (vertex == source && onlyFirstEdge != INVALID) {
+      NS_ASSERT(onlyFirstEdge >= begin && onlyFirstEdge < end);
+      begin = onlyFirstEdge;
+      end = onlyFirstEdge + 1;
+    }
+
+    for (uint32_t edge = begin; edge < end; edge++) {
+      const Edge& e = m_edges[edge];
+      uint32_t metric = item.first + e.metric;
+      if (isDone[e.target] || metric >= distances[e.target].metric)
+        continue;
+
+      distances[e.target].metric = metric;
+      distances[e.target].firstEdge = (vertex == source) ? edge : distances[vertex].firstEdge;
+      queue.push(QueueItem(metric, e.target));
+    }
+  }
+}
+
+void
+GlobalRoutingGraph::ShortestPathsTo(uint32_t destination, std::vector<uint32_t>& metrics,
+                                    std::vector<uint32_t>* hops) const
+{
+  NS_ASSERT(destination < GetNVertices());
+
+  metrics.assign(GetNVertices(), METRIC_INF);
+  metrics[destination] = 0;
+
+  std::vector<uint32_t> localHops;
+  std::vector<uint32_t>& nHops = (hops != nullptr) ? *hops : localHops;
+  nHops.assign(GetNVertices(), INVALID);
+  nHops[destination] = 0;
+
+  // ((metric, hops), vertex), smallest first; hops break ties between equal-metric paths
+  typedef std::pair<std::pair<uint32_t, uint32_t>, uint32_t> QueueItem;
+  std::priority_queue<QueueItem, std::vector<QueueItem>, std::greater<QueueItem>> queue;
+  queue.push(QueueItem(std::make_pair(0, 0), destination));
+
+  while (!queue.empty()) {
+    QueueItem item = queue.top();
+    queue.pop();
+
+    uint32_t vertex = item.second;
+    if (item.first != std::make_pair(metrics[vertex], nHops[vertex]))
+      continue; // stale queue item
+
+    for (uint32_t i = m_inEdgesBegin[vertex]; i < m_inEdgesBegin[vertex + 1]; i++) {
+      const InEdge& edge = m_inEdges[i];
+      std::pair<uint32_t, uint32_t> key(item.first.first + edge.metric, item.first.second + 1);
+      if (key < std::make_pair(metrics[edge.source], nHops[edge.source])) {
+        metrics[edge.source] = key.first;
+        nHops[edge.source] = key.second;
+        queue.push(QueueItem(key, edge.source));
+      }
+    }
+  }
+}
+
+void
+GlobalRoutingGraph::LoopFreeNextHops(uint32_t vertex, const std::vector<uint32_t>& metrics,
+                                     const std::vector<uint32_t>& hops,
+                                     std::vector<std::pair<uint32_t, uint32_t>>& nextHops) const
+{
+  nextHops.clear();
+  if (metrics[vertex] == METRIC_INF)
+    return;
+
+  for (uint32_t edge = m_edgesBegin[vertex]; edge < m_edgesBegin[vertex + 1]; edge++) {
+    const Edge& e = m_edges[edge];
+    if (metrics[e.target] == METRIC_INF)
+      continue;
+
+    uint64_t cost = static_cast<uint64_t>(e.metric) + metrics[e.target];
+    if (cost >= METRIC_INF)
+      continue;
+
+    // (metric, hops) to the destination strictly decreases along every selected edge, so
+    // next hops of all vertices together cannot form a loop
+    bool isDownstream = metrics[e.target] < metrics[vertex];
+    bool isShortest = cost == metrics[vertex] && hops[e.target] < hops[vertex];
+    if (isDownstream || isShortest)
+      nextHops.push_back(std::make_pair(static_cast<uint32_t>(cost), edge));
+  }
+}
+
+uint32_t
+GlobalRoutingGraph::ConnectedComponents(std::vector<uint32_t>& components) const
+{
+  uint32_t nVertices = GetNVertices();
+
+  components.assign(nVertices, INVALID);
+  uint32_t nComponents = 0;
+  std::vector<uint32_t> stack;
+  for (uint32_t start = 0; start < nVertices; start++) {
+    if (components[start] != INVALID)
+      continue;
+
+    components[start] = nComponents;
+    stack.push_back(start);
+    while (!stack.empty()) {
+      uint32_t vertex = stack.back();
+      stack.pop_back();
+
+      for (uint32_t edge = m_edgesBegin[vertex]; edge < m_edgesBegin[vertex + 1]; edge++) {
+        uint32_t other = m_edges[edge].target;
+        if (components[other] == INVALID) {
+          components[other] = nComponents;
+          stack.push_back(other);
+        }
+      }
+      for (uint32_t edge = m_inEdgesBegin[vertex]; edge < m_inEdgesBegin[vertex + 1]; edge++) {
+        uint32_t other = m_inEdges[edge].source;
+        if (components[other] == INVALID) {
+          components[other] = nComponents;
+          stack.push_back(other);
+        }
+      }
+    }
+    nComponents++;
+  }
+
+  return nComponents;
+}
+
+} // namespace ndn
+} // namespace ns3
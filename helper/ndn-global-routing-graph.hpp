@@ -0,0 +1,242 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_GLOBAL_ROUTING_GRAPH_H
+#define NDN_GLOBAL_ROUTING_GRAPH_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/model/ndn-face.hpp"
+
+#include "ns3/ptr.h"
+
+#include <vector>
+#include <unordered_map>
+#include <limits>
+
+namespace ns3 {
+namespace ndn {
+
+class GlobalRouter;
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Compressed sparse row (CSR) snapshot of the NDN topology for routing computations
+ *
+ * Vertices are numbered densely from 0, and outgoing edges of every vertex are stored
+ * contiguously as plain (target, metric) records.  Faces and GlobalRouter objects are kept in
+ * side arrays indexed by edge and vertex, so graph algorithms do not touch any reference-counted
+ * objects.
+ *
+ * The graph can be built from GlobalRouter objects installed on nodes and channels (see
+ * GlobalRoutingHelper), or manually with AddVertex/AddEdge followed by Finalize (e.g., by
+ * topology readers).  Face metrics are read when the snapshot is created.
+ */
+class GlobalRoutingGraph {
+public:
+  /**
+   * @brief Outgoing edge
+   */
+  struct Edge {
+    uint32_t target;
+    uint32_t metric;
+  };
+
+  /**
+   * @brief Result of the shortest path computation for a single vertex
+   */
+  struct Distance {
+    uint32_t metric;    ///< @brief total metric of the path, METRIC_INF if unreachable
+    uint32_t firstEdge; ///< @brief first edge of the path from the source, INVALID if unreachable
+  };
+
+  static const uint32_t INVALID = std::numeric_limits<uint32_t>::max();
+  static const uint32_t METRIC_INF = std::numeric_limits<uint32_t>::max();
+
+  /**
+   * @brief Create an empty graph
+   */
+  GlobalRoutingGraph();
+
+  /**
+   * @brief Create snapshot of GlobalRouter objects installed on all nodes and channels
+   */
+  static GlobalRoutingGraph
+  CreateFromGlobalRouters();
+
+  /**
+   * @brief Add vertex to the graph being built
+   * @return index of the vertex
+   */
+  uint32_t
+  AddVertex(Ptr<GlobalRouter> router = 0);
+
+  /**
+   * @brief Add directed edge to the graph being built
+   */
+  void
+  AddEdge(uint32_t from, uint32_t to, uint32_t metric, shared_ptr<Face> face = nullptr);
+
+  /**
+   * @brief Convert added edges to CSR form
+   *
+   * Must be called after the last AddEdge and before the graph is used.  Outgoing edges of every
+   * vertex keep the order in which they were added.
+   */
+  void
+  Finalize();
+
+  uint32_t
+  GetNVertices() const
+  {
+    return m_routers.size();
+  }
+
+  uint32_t
+  GetNEdges() const
+  {
+    return m_edges.size();
+  }
+
+  /**
+   * @brief Get index of the first outgoing edge of the vertex
+   */
+  uint32_t
+  GetEdgesBegin(uint32_t vertex) const
+  {
+    return m_edgesBegin[vertex];
+  }
+
+  /**
+   * @brief Get index past the last outgoing edge of the vertex
+   */
+  uint32_t
+  GetEdgesEnd(uint32_t vertex) const
+  {
+    return m_edgesBegin[vertex + 1];
+  }
+
+  const Edge&
+  GetEdge(uint32_t edge) const
+  {
+    return m_edges[edge];
+  }
+
+  /**
+   * @brief Get face of the edge (nullptr for edges from channels to nodes)
+   */
+  shared_ptr<Face>
+  GetFace(uint32_t edge) const;
+
+  /**
+   * @brief Get GlobalRouter the vertex was created for (0 for manually added vertices)
+   */
+  Ptr<GlobalRouter>
+  GetRouter(uint32_t vertex) const;
+
+  /**
+   * @brief Get vertex of the GlobalRouter, INVALID if the router is not in the graph
+   */
+  uint32_t
+  FindVertex(Ptr<GlobalRouter> router) const;
+
+  /**
+   * @brief Calculate shortest paths (Dijkstra) from the source to all vertices
+   * @param source source vertex
+   * @param[out] distances metric and first edge of the shortest path for every vertex
+   * @param onlyFirstEdge if not INVALID, paths are allowed to leave the source only through this
+   *                      edge
+   *
+   * Among paths with equal metric, the one found first (via the vertex with the smaller index) is
+   * used.
+   */
+  void
+  ShortestPaths(uint32_t source, std::vector<Distance>& distances,
+                uint32_t onlyFirstEdge = INVALID) const;
+
+  /**
+   * @brief Calculate metrics of shortest paths from all vertices to the destination
+   *
+   * Dijkstra over reversed edges.  Together with edge metrics, this gives cost of the best path
+   * through every neighbor of a vertex, which is used to rank alternative next hops.
+   *
+   * @param destination destination vertex
+   * @param[out] metrics total metric of the shortest path for every vertex, METRIC_INF if the
+   *                     destination is not reachable
+   * @param[out] hops if not nullptr, number of edges on the shortest path for every vertex (the
+   *                  smallest among paths with equal metric)
+   */
+  void
+  ShortestPathsTo(uint32_t destination, std::vector<uint32_t>& metrics,
+                  std::vector<uint32_t>* hops = nullptr) const;
+
+  /**
+   * @brief Select outgoing edges of the vertex that are loop-free next hops to the destination
+   *
+   * Edge S->N is selected if N is a downstream neighbor, dist(N, D) < dist(S, D), or if it is on
+   * a shortest path of S and N has fewer hops to D (ties on zero-metric edges).  The selection is
+   * loop-free even when all vertices use all their selected next hops at the same time.
+   *
+   * @param vertex source vertex S
+   * @param metrics result of ShortestPathsTo for the destination D
+   * @param hops hops result of ShortestPathsTo for the destination D
+   * @param[out] nextHops (metric of the best path through the edge, edge) for every selected edge
+   */
+  void
+  LoopFreeNextHops(uint32_t vertex, const std::vector<uint32_t>& metrics,
+                   const std::vector<uint32_t>& hops,
+                   std::vector<std::pair<uint32_t, uint32_t>>& nextHops) const;
+
+  /**
+   * @brief Assign every vertex to a (weakly) connected component
+   * @param[out] components index of the component for every vertex
+   * @return number of components
+   */
+  uint32_t
+  ConnectedComponents(std::vector<uint32_t>& components) const;
+
+private:
+  struct PendingEdge {
+    uint32_t from;
+    uint32_t to;
+    uint32_t metric;
+  };
+
+  struct InEdge {
+    uint32_t source;
+    uint32_t metric;
+  };
+
+  std::vector<uint32_t> m_edgesBegin; ///< @brief CSR row offsets, GetNVertices () + 1 elements
+  std::vector<Edge> m_edges;
+
+  std::vector<uint32_t> m_inEdgesBegin; ///< @brief same as m_edgesBegin for reversed edges
+  std::vector<InEdge> m_inEdges;
+
+  std::vector<Ptr<GlobalRouter>> m_routers;
+  std::unordered_map<const GlobalRouter*, uint32_t> m_vertexOfRouter;
+  std::vector<shared_ptr<Face>> m_faces; ///< @brief in CSR order
+
+  std::vector<PendingEdge> m_pendingEdges;
+  std::vector<shared_ptr<Face>> m_pendingFaces;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_GLOBAL_ROUTING_GRAPH_H
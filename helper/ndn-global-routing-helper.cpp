@@ -48,13 +48,10 @@
 #include "ns3/object-factory.h"
 
 #include <boost/lexical_cast.hpp>
-#include <boost/foreach.hpp>
-#include <boost/concept/assert.hpp>
-#include <boost/graph/dijkstra_shortest_paths.hpp>
 
-#include <unordered_map>
+#include "ndn-global-routing-graph.hpp"
 
-#include "boost-graph-ndn-global-routing-helper.hpp"
+#include <algorithm>
 
 #include <math.h>
 
@@ -80,13 +77,7 @@ GlobalRoutingHelper::Install(Ptr<Node> node)
   gr = CreateObject<GlobalRouter>();
   node->AggregateObject(gr);
 
-  for (auto& i : ndn->getForwarder()->getFaceTable()) {
-    shared_ptr<NetDeviceFace> face = std::dynamic_pointer_cast<NetDeviceFace>(i);
-    if (face == 0) {
-      NS_LOG_DEBUG("Skipping non-netdevice face");
-      continue;
-    }
-
+  for (const shared_ptr<NetDeviceFace>& face : ndn->getNetDeviceFaces()) {
     Ptr<NetDevice> nd = face->GetNetDevice();
     if (nd == 0) {
       NS_LOG_DEBUG("Not a NetDevice associated with NetDeviceFace");
@@ -217,21 +208,10 @@ GlobalRoutingHelper::AddOriginsForAll()
 void
 GlobalRoutingHelper::CalculateRoutes()
 {
-  /**
-   * Implementation of route calculation is heavily based on Boost Graph Library
-   * See http://www.boost.org/doc/libs/1_49_0/libs/graph/doc/table_of_contents.html for more details
-   */
-
-  BOOST_CONCEPT_ASSERT((boost::VertexListGraphConcept<boost::NdnGlobalRouterGraph>));
-  BOOST_CONCEPT_ASSERT((boost::IncidenceGraphConcept<boost::NdnGlobalRouterGraph>));
-
-  boost::NdnGlobalRouterGraph graph;
-  // typedef graph_traits < NdnGlobalRouterGraph >::vertex_descriptor vertex_descriptor;
+  GlobalRoutingGraph graph = GlobalRoutingGraph::CreateFromGlobalRouters();
+  std::vector<GlobalRoutingGraph::Distance> distances;
 
   // For now we doing Dijkstra for every node.  Can be replaced with Bellman-Ford or Floyd-Warshall.
-  // Other algorithms should be faster, but they need additional EdgeListGraph concept provided by
-  // the graph, which
-  // is not obviously how implement in an efficient manner
   for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
     Ptr<GlobalRouter> source = (*node)->GetObject<GlobalRouter>();
     if (source == 0) {
@@ -239,64 +219,22 @@ GlobalRoutingHelper::CalculateRoutes()
       continue;
     }
 
-    boost::DistancesMap distances;
-
-    dijkstra_shortest_paths(graph, source,
-                            // predecessor_map (boost::ref(predecessors))
-                            // .
-                            distance_map(boost::ref(distances))
-                              .distance_inf(boost::WeightInf)
-                              .distance_zero(boost::WeightZero)
-                              .distance_compare(boost::WeightCompare())
-                              .distance_combine(boost::WeightCombine()));
-
-    // NS_LOG_DEBUG (predecessors.size () << ", " << distances.size ());
-
-    Ptr<L3Protocol> L3protocol = (*node)->GetObject<L3Protocol>();
-    shared_ptr<nfd::Forwarder> forwarder = L3protocol->getForwarder();
+    uint32_t sourceVertex = graph.FindVertex(source);
+    graph.ShortestPaths(sourceVertex, distances);
 
     NS_LOG_DEBUG("Reachability from Node: " << source->GetObject<Node>()->GetId());
-    for (const auto& dist : distances) {
-      if (dist.first == source)
-        continue;
-      else {
-        // cout << "  Node " << dist.first->GetObject<Node> ()->GetId ();
-        if (std::get<0>(dist.second) == 0) {
-          // cout << " is unreachable" << endl;
-        }
-        else {
-          for (const auto& prefix : dist.first->GetLocalPrefixes()) {
-            NS_LOG_DEBUG(" prefix " << prefix << " reachable via face " << *std::get<0>(dist.second)
-                         << " with distance " << std::get<1>(dist.second) << " with delay "
-                         << std::get<2>(dist.second));
-
-            FibHelper::AddRoute(*node, *prefix, std::get<0>(dist.second),
-                                std::get<1>(dist.second));
-          }
-        }
-      }
-    }
+    InstallRoutes(*node, graph, sourceVertex, distances);
   }
 }
 
 void
 GlobalRoutingHelper::CalculateAllPossibleRoutes()
 {
-  /**
-   * Implementation of route calculation is heavily based on Boost Graph Library
-   * See http://www.boost.org/doc/libs/1_49_0/libs/graph/doc/table_of_contents.html for more details
-   */
-
-  BOOST_CONCEPT_ASSERT((boost::VertexListGraphConcept<boost::NdnGlobalRouterGraph>));
-  BOOST_CONCEPT_ASSERT((boost::IncidenceGraphConcept<boost::NdnGlobalRouterGraph>));
-
-  boost::NdnGlobalRouterGraph graph;
-  // typedef graph_traits < NdnGlobalRouterGraph >::vertex_descriptor vertex_descriptor;
+  GlobalRoutingGraph graph = GlobalRoutingGraph::CreateFromGlobalRouters();
+  std::vector<GlobalRoutingGraph::Distance> distances;
 
-  // For now we doing Dijkstra for every node.  Can be replaced with Bellman-Ford or Floyd-Warshall.
-  // Other algorithms should be faster, but they need additional EdgeListGraph concept provided by
-  // the graph, which
-  // is not obviously how implement in an efficient manner
+  // For every face of every node, calculate shortest paths that leave the node only through this
+  // face, and install routes via this face
   for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
     Ptr<GlobalRouter> source = (*node)->GetObject<GlobalRouter>();
     if (source == 0) {
@@ -304,84 +242,93 @@ GlobalRoutingHelper::CalculateAllPossibleRoutes()
       continue;
     }
 
-    Ptr<L3Protocol> L3protocol = (*node)->GetObject<L3Protocol>();
-    shared_ptr<nfd::Forwarder> forwarder = L3protocol->getForwarder();
-
     NS_LOG_DEBUG("Reachability from Node: " << source->GetObject<Node>()->GetId() << " ("
                                             << Names::FindName(source->GetObject<Node>()) << ")");
 
     Ptr<L3Protocol> l3 = source->GetObject<L3Protocol>();
     NS_ASSERT(l3 != 0);
 
-    // remember interface statuses
-    std::list<nfd::FaceId> faceIds;
-    std::unordered_map<nfd::FaceId, uint16_t> originalMetrics;
-    for (auto& i : l3->getForwarder()->getFaceTable()) {
-      shared_ptr<Face> nfdFace = std::dynamic_pointer_cast<Face>(i);
-      faceIds.push_back(nfdFace->getId());
-      originalMetrics[nfdFace->getId()] = nfdFace->getMetric();
-      nfdFace->setMetric(std::numeric_limits<uint16_t>::max() - 1);
-      // value std::numeric_limits<uint16_t>::max () MUST NOT be used (reserved)
-    }
+    uint32_t sourceVertex = graph.FindVertex(source);
+    for (const shared_ptr<NetDeviceFace>& face : l3->getNetDeviceFaces()) {
+      for (uint32_t edge = graph.GetEdgesBegin(sourceVertex);
+           edge < graph.GetEdgesEnd(sourceVertex); edge++) {
+        if (graph.GetFace(edge) != face)
+          continue;
 
-    for (auto& faceId : faceIds) {
-      shared_ptr<Face> k = l3->getForwarder()->getFaceTable().get(faceId);
-      shared_ptr<NetDeviceFace> face = std::dynamic_pointer_cast<NetDeviceFace>(k);
-      if (face == 0) {
-        NS_LOG_DEBUG("Skipping non-netdevice face");
-        continue;
+        NS_LOG_DEBUG("-----------");
+
+        graph.ShortestPaths(sourceVertex, distances, edge);
+        InstallRoutes(*node, graph, sourceVertex, distances);
       }
+    }
+  }
+}
 
-      // enabling only faceId
-      face->setMetric(originalMetrics[faceId]);
+void
+GlobalRoutingHelper::CalculateMultipathRoutes(uint32_t k)
+{
+  GlobalRoutingGraph graph = GlobalRoutingGraph::CreateFromGlobalRouters();
 
-      boost::DistancesMap distances;
+  std::vector<std::pair<Ptr<Node>, uint32_t>> sources;
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    Ptr<GlobalRouter> source = (*node)->GetObject<GlobalRouter>();
+    if (source == 0) {
+      NS_LOG_DEBUG("Node " << (*node)->GetId() << " does not export GlobalRouter interface");
+      continue;
+    }
+    sources.push_back(std::make_pair(*node, graph.FindVertex(source)));
+  }
 
-      NS_LOG_DEBUG("-----------");
+  // (cost, edge)
+  std::vector<std::pair<uint32_t, uint32_t>> nextHops;
+  std::vector<uint32_t> metrics;
+  std::vector<uint32_t> hops;
 
-      dijkstra_shortest_paths(graph, source,
-                              // predecessor_map (boost::ref(predecessors))
-                              // .
-                              distance_map(boost::ref(distances))
-                                .distance_inf(boost::WeightInf)
-                                .distance_zero(boost::WeightZero)
-                                .distance_compare(boost::WeightCompare())
-                                .distance_combine(boost::WeightCombine()));
+  for (uint32_t origin = 0; origin < graph.GetNVertices(); origin++) {
+    const GlobalRouter::LocalPrefixList& prefixes = graph.GetRouter(origin)->GetLocalPrefixes();
+    if (prefixes.empty())
+      continue;
 
-      // NS_LOG_DEBUG (predecessors.size () << ", " << distances.size ());
+    graph.ShortestPathsTo(origin, metrics, &hops);
 
-      for (const auto& dist : distances) {
-        if (dist.first == source)
-          continue;
-        else {
-          // cout << "  Node " << dist.first->GetObject<Node> ()->GetId ();
-          if (std::get<0>(dist.second) == 0) {
-            // cout << " is unreachable" << endl;
-          }
-          else {
-            for (const auto& prefix : dist.first->GetLocalPrefixes()) {
-              NS_LOG_DEBUG(" prefix " << *prefix << " reachable via face "
-                           << *std::get<0>(dist.second)
-                           << " with distance " << std::get<1>(dist.second)
-                           << " with delay " << std::get<2>(dist.second));
-
-              if (std::get<0>(dist.second)->getMetric() == std::numeric_limits<uint16_t>::max() - 1)
-                continue;
-
-              FibHelper::AddRoute(*node, *prefix, std::get<0>(dist.second),
-                                  std::get<1>(dist.second));
-            }
-          }
+    for (const auto& source : sources) {
+      uint32_t vertex = source.second;
+      if (vertex == origin)
+        continue;
+
+      graph.LoopFreeNextHops(vertex, metrics, hops, nextHops);
+
+      size_t nNextHops = std::min<size_t>(k, nextHops.size());
+      std::partial_sort(nextHops.begin(), nextHops.begin() + nNextHops, nextHops.end());
+
+      for (size_t i = 0; i < nNextHops; i++) {
+        shared_ptr<Face> face = graph.GetFace(nextHops[i].second);
+        for (const auto& prefix : prefixes) {
+          NS_LOG_DEBUG("Node " << source.first->GetId() << ": prefix " << *prefix << " via face "
+                               << *face << " with cost " << nextHops[i].first);
+
+          FibHelper::AddRoute(source.first, *prefix, face, nextHops[i].first);
         }
       }
-
-      // disabling the face again
-      face->setMetric(std::numeric_limits<uint16_t>::max() - 1);
     }
+  }
+}
+
+void
+GlobalRoutingHelper::InstallRoutes(Ptr<Node> node, const GlobalRoutingGraph& graph,
+                                   uint32_t sourceVertex,
+                                   const std::vector<GlobalRoutingGraph::Distance>& distances)
+{
+  for (uint32_t vertex = 0; vertex < graph.GetNVertices(); vertex++) {
+    if (vertex == sourceVertex || distances[vertex].firstEdge == GlobalRoutingGraph::INVALID)
+      continue;
+
+    shared_ptr<Face> face = graph.GetFace(distances[vertex].firstEdge);
+    for (const auto& prefix : graph.GetRouter(vertex)->GetLocalPrefixes()) {
+      NS_LOG_DEBUG(" prefix " << *prefix << " reachable via face " << *face << " with distance "
+                              << distances[vertex].metric);
 
-    // recover original interface statuses
-    for (auto& i : originalMetrics) {
-      l3->getForwarder()->getFaceTable().get(i.first)->setMetric(i.second);
+      FibHelper::AddRoute(node, *prefix, face, distances[vertex].metric);
     }
   }
 }
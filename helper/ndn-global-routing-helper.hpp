@@ -21,6 +21,7 @@
 #define NDN_GLOBAL_ROUTING_HELPER_H
 
 #include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/helper/ndn-global-routing-graph.hpp"
 
 #include "ns3/ptr.h"
 
@@ -111,9 +112,35 @@ public:
   static void
   CalculateAllPossibleRoutes();
 
+  /**
+   * @brief Calculate for every node up to k ranked loop-free next hops towards every prefix origin
+   *
+   * For every origin, shortest path metrics from all nodes to the origin are calculated once.  A
+   * neighbor is used as a next hop if it is strictly closer to the origin than the node itself
+   * (downstream neighbor, so packets cannot loop even when every node uses all its next hops), or
+   * if it is on the shortest path and has fewer hops to the origin (see
+   * GlobalRoutingGraph::LoopFreeNextHops).  Next hops are ranked by the metric of the best path
+   * through them, and the k best are installed into the FIB with this metric as the cost (e.g., for
+   * NccStrategy or BestRouteStrategy2 to choose from).
+   *
+   * Compared to CalculateAllPossibleRoutes, the cost is one Dijkstra run per origin instead of one
+   * per face of every node.
+   *
+   * @param k maximum number of next hops per prefix on every node
+   */
+  static void
+  CalculateMultipathRoutes(uint32_t k);
+
 private:
   void
   Install(Ptr<Channel> channel);
+
+  /**
+   * @brief Install routes to prefixes of all vertices reachable from the source
+   */
+  static void
+  InstallRoutes(Ptr<Node> node, const GlobalRoutingGraph& graph, uint32_t sourceVertex,
+                const std::vector<GlobalRoutingGraph::Distance>& distances);
 };
 
 } // namespace ndn
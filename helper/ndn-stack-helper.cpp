@@ -23,6 +23,8 @@
 #include "ns3/names.h"
 #include "ns3/string.h"
 #include "ns3/point-to-point-net-device.h"
+#include "ns3/channel.h"
+#include "ns3/data-rate.h"
 
 #include "model/ndn-l3-protocol.hpp"
 #include "model/ndn-net-device-face.hpp"
@@ -30,6 +32,8 @@
 #include "utils/dummy-keychain.hpp"
 #include "model/cs/ndn-content-store.hpp"
 
+#include "daemon/fw/forwarder.hpp"
+
 #include <limits>
 #include <map>
 #include <boost/lexical_cast.hpp>
@@ -42,6 +46,13 @@ namespace ndn {
 StackHelper::StackHelper()
   : m_needSetDefaultRoutes(false)
   , m_maxCsSize(100)
+  , m_needInterestShaping(false)
+  , m_expectedDataSize(1100)
+  , m_shapingBurst(10)
+  , m_maxInterestBacklog(100)
+  , m_needPintFilter(false)
+  , m_pintFilterWindow(Seconds(1))
+  , m_pintFilterBits(65536)
 {
   setCustomNdnCxxClocks();
 
@@ -79,6 +90,30 @@ StackHelper::SetDefaultRoutes(bool needSet)
   m_needSetDefaultRoutes = needSet;
 }
 
+void
+StackHelper::SetInterestShaping(bool needSet, uint32_t expectedDataSize, uint32_t burst,
+                                uint32_t maxBacklog)
+{
+  NS_LOG_FUNCTION(this << needSet << expectedDataSize << burst << maxBacklog);
+  NS_ASSERT_MSG(expectedDataSize > 0, "Expected Data size must be positive");
+
+  m_needInterestShaping = needSet;
+  m_expectedDataSize = expectedDataSize;
+  m_shapingBurst = burst;
+  m_maxInterestBacklog = maxBacklog;
+}
+
+void
+StackHelper::SetPintFilter(bool needSet, const Time& window, uint32_t nBits)
+{
+  NS_LOG_FUNCTION(this << needSet << window << nBits);
+  NS_ASSERT_MSG(window.IsStrictlyPositive(), "PINT filter window must be positive");
+
+  m_needPintFilter = needSet;
+  m_pintFilterWindow = window;
+  m_pintFilterBits = nBits;
+}
+
 void
 StackHelper::SetStackAttributes(const std::string& attr1, const std::string& value1,
                                 const std::string& attr2, const std::string& value2,
@@ -155,6 +190,11 @@ StackHelper::Install(Ptr<Node> node) const
   // NFD initialization
   ndn->initialize();
 
+  if (m_needPintFilter) {
+    ::ndn::time::nanoseconds window(m_pintFilterWindow.GetNanoSeconds());
+    ndn->getForwarder()->setPintFilter(make_shared<nfd::PintFilter>(window, m_pintFilterBits));
+  }
+
   // Create and aggregate content store if NFD's contest store has been disabled
   if (m_maxCsSize == 0) {
     ndn->AggregateObject(m_contentStoreFactory.Create<ContentStore>());
@@ -327,6 +367,28 @@ StackHelper::createAndRegisterFace(Ptr<Node> node, Ptr<L3Protocol> ndn, Ptr<NetD
     face = DefaultNetDeviceCallback(node, ndn, device);
   }
 
+  if (m_needInterestShaping) {
+    // Data for our Interests come back over the peer's device
+    Ptr<NetDevice> returnDevice = device;
+    Ptr<Channel> channel = device->GetChannel();
+    if (channel != nullptr && channel->GetNDevices() == 2) {
+      returnDevice = channel->GetDevice(channel->GetDevice(0) == device ? 1 : 0);
+    }
+
+    DataRateValue dataRate;
+    if (returnDevice->GetAttributeFailSafe("DataRate", dataRate) ||
+        device->GetAttributeFailSafe("DataRate", dataRate)) {
+      double interestRate = dataRate.Get().GetBitRate() / (8.0 * m_expectedDataSize);
+      face->SetInterestShaping(interestRate, m_shapingBurst, m_maxInterestBacklog);
+      NS_LOG_LOGIC("Node " << node->GetId() << ": shaping Interests on face "
+                           << face->getLocalUri() << " at " << interestRate << " Interests/s");
+    }
+    else {
+      NS_LOG_WARN("Node " << node->GetId() << ": cannot shape Interests on "
+                          << device->GetInstanceTypeId().GetName() << ", no DataRate");
+    }
+  }
+
   if (m_needSetDefaultRoutes) {
     // default route with lowest priority possible
     FibHelper::AddRoute(node, "/", face, std::numeric_limits<int32_t>::max());
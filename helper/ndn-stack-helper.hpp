@@ -23,6 +23,7 @@
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 
 #include "ns3/ptr.h"
+#include "ns3/nstime.h"
 #include "ns3/object-factory.h"
 #include "ns3/node.h"
 #include "ns3/node-container.h"
@@ -185,6 +186,38 @@ public:
   void
   SetDefaultRoutes(bool needSet);
 
+  /**
+   * \brief Set flag indicating necessity to shape Interests on NetDevice faces
+   *
+   * Each NetDeviceFace paces outgoing Interests with a token bucket, so that the Data they
+   * bring back do not exceed the DataRate of the reverse direction of the link (the DataRate
+   * attribute of the peer NetDevice, or of the local one if the peer is unknown).  Faces on
+   * devices without DataRate attribute are not shaped.
+   *
+   * \param needSet enable or disable shaping for faces created afterwards
+   * \param expectedDataSize expected size of Data packets (bytes)
+   * \param burst token bucket depth (Interests)
+   * \param maxBacklog maximum number of Interests queued in the face, the rest are dropped
+   */
+  void
+  SetInterestShaping(bool needSet, uint32_t expectedDataSize = 1100, uint32_t burst = 10,
+                     uint32_t maxBacklog = 100);
+
+  /**
+   * \brief Set flag indicating necessity to forward PINTs without PIT state
+   *
+   * Forwarders aggregate PINTs for the same name with a Bloom filter per time window instead of
+   * PIT entries (see nfd::PintFilter), so PINTs, including Interests turned into PINTs by a
+   * cache hit, do not create PIT entries and timers.  PINTs go to the lowest-cost next hop, and
+   * forwarding strategies are informed of them through nfd::fw::Strategy::afterForwardPint.
+   *
+   * \param needSet enable or disable the filter for stacks installed afterwards
+   * \param window PINTs for the same name are aggregated for one to two windows
+   * \param nBits size of the Bloom filter of each window (bits)
+   */
+  void
+  SetPintFilter(bool needSet, const Time& window = Seconds(1), uint32_t nBits = 65536);
+
   static KeyChain&
   getKeyChain();
 
@@ -239,6 +272,15 @@ private:
   bool m_needSetDefaultRoutes;
   size_t m_maxCsSize;
 
+  bool m_needInterestShaping;
+  uint32_t m_expectedDataSize;
+  uint32_t m_shapingBurst;
+  uint32_t m_maxInterestBacklog;
+
+  bool m_needPintFilter;
+  Time m_pintFilterWindow;
+  uint32_t m_pintFilterBits;
+
   typedef std::list<std::pair<TypeId, NetDeviceFaceCreateCallback>> NetDeviceCallbackList;
   NetDeviceCallbackList m_netDeviceCallbacks;
 };
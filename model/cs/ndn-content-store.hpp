@@ -206,13 +206,14 @@ ContentStore::GetContentStore(Ptr<Object> node)
 } // namespace ndn
 } // namespace ns3
 
-#include <boost/functional/hash.hpp>
+#include "ns3/ndnSIM/NFD/daemon/table/name-tree-hash.hpp"
 namespace boost {
 inline std::size_t
-hash_value(const ::ndn::name::Component component)
+hash_value(const ::ndn::name::Component& component)
 {
-  return boost::hash_range(component.wireEncode().wire(),
-                           component.wireEncode().wire() + component.wireEncode().size());
+  // same per-component hash as used by NameTree
+  const ::ndn::Block& wire = component.wireEncode();
+  return nfd::name_tree::computeComponentHash(wire.wire(), wire.size());
 }
 }
 
@@ -81,10 +81,24 @@ L3Protocol::GetTypeId(void)
 
       ////////////////////////////////////////////////////////////////////
 
+      .AddTraceSource("ShapedInterests", "Interests queued by NetDeviceFace Interest shaper",
+                      MakeTraceSourceAccessor(&L3Protocol::m_shapedInterests))
+      .AddTraceSource("DroppedInterests", "Interests dropped by NetDeviceFace Interest shaper",
+                      MakeTraceSourceAccessor(&L3Protocol::m_droppedInterests))
+
+      ////////////////////////////////////////////////////////////////////
+
       .AddTraceSource("SatisfiedInterests", "SatisfiedInterests",
                       MakeTraceSourceAccessor(&L3Protocol::m_satisfiedInterests))
       .AddTraceSource("TimedOutInterests", "TimedOutInterests",
                       MakeTraceSourceAccessor(&L3Protocol::m_timedOutInterests))
+
+      ////////////////////////////////////////////////////////////////////
+
+      .AddTraceSource("CsHits", "Interests satisfied by the content store (NFD or ndnSIM)",
+                      MakeTraceSourceAccessor(&L3Protocol::m_csHits))
+      .AddTraceSource("CsMisses", "Interests not satisfied by the content store (NFD or ndnSIM)",
+                      MakeTraceSourceAccessor(&L3Protocol::m_csMisses))
     ;
   return tid;
 }
@@ -159,6 +173,9 @@ private:
   nfd::ConfigSection m_config;
 
   Ptr<ContentStore> m_csFromNdnSim;
+
+  // NetDeviceFaces indexed by NetDevice::GetIfIndex()
+  NetDeviceFaceVector m_netDeviceFaces;
 };
 
 L3Protocol::L3Protocol()
@@ -181,8 +198,22 @@ L3Protocol::initialize()
 
   m_impl->m_forwarder->getFaceTable().addReserved(make_shared<nfd::NullFace>(), nfd::FACEID_NULL);
 
+  m_impl->m_forwarder->getFaceTable().onRemove.connect([this] (shared_ptr<Face> face) {
+      shared_ptr<NetDeviceFace> netDeviceFace = std::dynamic_pointer_cast<NetDeviceFace>(face);
+      if (netDeviceFace == nullptr)
+        return;
+
+      uint32_t ifIndex = netDeviceFace->GetNetDevice()->GetIfIndex();
+      if (ifIndex < m_impl->m_netDeviceFaces.size() &&
+          m_impl->m_netDeviceFaces[ifIndex] == netDeviceFace) {
+        m_impl->m_netDeviceFaces[ifIndex].reset();
+      }
+    });
+
   m_impl->m_forwarder->beforeSatisfyInterest.connect(std::ref(m_satisfiedInterests));
   m_impl->m_forwarder->beforeExpirePendingInterest.connect(std::ref(m_timedOutInterests));
+  m_impl->m_forwarder->afterCsHit.connect(std::ref(m_csHits));
+  m_impl->m_forwarder->afterCsMiss.connect(std::ref(m_csMisses));
 }
 
 class IgnoreSections
@@ -319,6 +350,15 @@ L3Protocol::addFace(shared_ptr<Face> face)
 
   m_impl->m_forwarder->addFace(face);
 
+  shared_ptr<NetDeviceFace> netDeviceFace = std::dynamic_pointer_cast<NetDeviceFace>(face);
+  if (netDeviceFace != nullptr) {
+    uint32_t ifIndex = netDeviceFace->GetNetDevice()->GetIfIndex();
+    if (ifIndex >= m_impl->m_netDeviceFaces.size()) {
+      m_impl->m_netDeviceFaces.resize(ifIndex + 1);
+    }
+    m_impl->m_netDeviceFaces[ifIndex] = netDeviceFace;
+  }
+
   // Connect Signals to TraceSource
   face->onReceiveInterest +=
     [this, face](const Interest& interest) { this->m_inInterests(interest, *face); };
@@ -330,6 +370,14 @@ L3Protocol::addFace(shared_ptr<Face> face)
 
   face->onSendData += [this, face](const Data& data) { this->m_outData(data, *face); };
 
+  if (netDeviceFace != nullptr) {
+    netDeviceFace->onShapeInterest +=
+      [this, face](const Interest& interest) { this->m_shapedInterests(interest, *face); };
+
+    netDeviceFace->onDropInterest +=
+      [this, face](const Interest& interest) { this->m_droppedInterests(interest, *face); };
+  }
+
   return face->getId();
 }
 
@@ -348,15 +396,22 @@ L3Protocol::getFaceById(nfd::FaceId id) const
 shared_ptr<Face>
 L3Protocol::getFaceByNetDevice(Ptr<NetDevice> netDevice) const
 {
-  for (const auto& i : m_impl->m_forwarder->getFaceTable()) {
-    shared_ptr<NetDeviceFace> netDeviceFace = std::dynamic_pointer_cast<NetDeviceFace>(i);
-    if (netDeviceFace == nullptr)
-      continue;
+  uint32_t ifIndex = netDevice->GetIfIndex();
+  if (ifIndex >= m_impl->m_netDeviceFaces.size())
+    return nullptr;
 
-    if (netDeviceFace->GetNetDevice() == netDevice)
-      return i;
-  }
-  return nullptr;
+  const shared_ptr<NetDeviceFace>& netDeviceFace = m_impl->m_netDeviceFaces[ifIndex];
+  // NetDevice may belong to a different node and just share the interface index
+  if (netDeviceFace == nullptr || netDeviceFace->GetNetDevice() != netDevice)
+    return nullptr;
+
+  return netDeviceFace;
+}
+
+L3Protocol::NetDeviceFaceRange
+L3Protocol::getNetDeviceFaces() const
+{
+  return m_impl->m_netDeviceFaces | boost::adaptors::filtered(IsNetDeviceFacePresent());
 }
 
 Ptr<L3Protocol>
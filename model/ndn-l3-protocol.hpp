@@ -32,6 +32,7 @@
 #include "ns3/traced-callback.h"
 
 #include <boost/property_tree/ptree_fwd.hpp>
+#include <boost/range/adaptor/filtered.hpp>
 
 namespace nfd {
 class Forwarder;
@@ -51,6 +52,8 @@ class Header;
 
 namespace ndn {
 
+class NetDeviceFace;
+
 /**
  * \defgroup ndn ndnSIM: NDN simulation module
  *
@@ -144,10 +147,35 @@ public:
 
   /**
    * \brief Get face for NetDevice
+   *
+   * Lookup uses the NetDevice's interface index and does not scan the face table
    */
   shared_ptr<Face>
   getFaceByNetDevice(Ptr<NetDevice> netDevice) const;
 
+public: // enumeration of NetDeviceFaces
+  typedef std::vector<shared_ptr<NetDeviceFace>> NetDeviceFaceVector;
+
+  struct IsNetDeviceFacePresent
+  {
+    bool
+    operator()(const shared_ptr<NetDeviceFace>& face) const
+    {
+      return face != nullptr;
+    }
+  };
+
+  typedef boost::filtered_range<IsNetDeviceFacePresent, const NetDeviceFaceVector>
+    NetDeviceFaceRange;
+
+  /**
+   * \brief Get range of all NetDeviceFaces on the node, ordered by NetDevice interface index
+   *
+   * Unlike iteration over nfd::FaceTable, no dynamic_pointer_cast is necessary
+   */
+  NetDeviceFaceRange
+  getNetDeviceFaces() const;
+
   /**
    * \brief Get NFD config (boost::property_tree)
    */
@@ -190,8 +218,16 @@ private:
   TracedCallback<const Data&, const Face&> m_outData; ///< @brief trace of outgoing Data
   TracedCallback<const Data&, const Face&> m_inData;  ///< @brief trace of incoming Data
 
+  TracedCallback<const Interest&, const Face&>
+    m_shapedInterests; ///< @brief trace of Interests queued by NetDeviceFace shaper
+  TracedCallback<const Interest&, const Face&>
+    m_droppedInterests; ///< @brief trace of Interests dropped by NetDeviceFace shaper
+
   TracedCallback<const nfd::pit::Entry&, const Face&/*in face*/, const Data&> m_satisfiedInterests;
   TracedCallback<const nfd::pit::Entry&> m_timedOutInterests;
+
+  TracedCallback<const Interest&, const Data&> m_csHits; ///< @brief trace of CS hits
+  TracedCallback<const Interest&> m_csMisses;            ///< @brief trace of CS misses
 };
 
 } // namespace ndn
@@ -27,13 +27,12 @@
 #include "ns3/packet.h"
 #include "ns3/node.h"
 #include "ns3/pointer.h"
+#include "ns3/simulator.h"
 
 // #include "ns3/address.h"
 #include "ns3/point-to-point-net-device.h"
 #include "ns3/channel.h"
 
-#include "../utils/ndn-fw-hop-count-tag.hpp"
-
 NS_LOG_COMPONENT_DEFINE("ndn.NetDeviceFace");
 
 namespace ns3 {
@@ -43,6 +42,11 @@ NetDeviceFace::NetDeviceFace(Ptr<Node> node, const Ptr<NetDevice>& netDevice)
   : Face(FaceUri("netDeviceFace://"), FaceUri("netDeviceFace://"))
   , m_node(node)
   , m_netDevice(netDevice)
+  , m_interestRate(0.0)
+  , m_bucketDepth(0.0)
+  , m_tokens(0.0)
+  , m_maxInterestBacklog(0)
+  , m_interestBacklogBytes(0)
 {
   NS_LOG_FUNCTION(this << netDevice);
 
@@ -65,6 +69,9 @@ void
 NetDeviceFace::close()
 {
   m_node->UnregisterProtocolHandler(MakeCallback(&NetDeviceFace::receiveFromNetDevice, this));
+  Simulator::Cancel(m_interestBacklogEvent);
+  m_interestBacklog.clear();
+  m_interestBacklogBytes = 0;
   this->fail("Close connection");
 }
 
@@ -74,6 +81,83 @@ NetDeviceFace::GetNetDevice() const
   return m_netDevice;
 }
 
+void
+NetDeviceFace::SetInterestShaping(double interestRate, uint32_t burst, uint32_t maxBacklog)
+{
+  NS_LOG_FUNCTION(this << interestRate << burst << maxBacklog);
+
+  m_interestRate = interestRate;
+  m_bucketDepth = std::max<uint32_t>(burst, 1);
+  m_tokens = m_bucketDepth;
+  m_lastRefill = Simulator::Now();
+  m_maxInterestBacklog = maxBacklog;
+
+  if (!IsInterestShapingEnabled()) {
+    // flush whatever has been queued while shaping was on
+    Simulator::Cancel(m_interestBacklogEvent);
+    while (!m_interestBacklog.empty()) {
+      sendInterestPacket(*m_interestBacklog.front().first, m_interestBacklog.front().second);
+      m_interestBacklog.pop_front();
+    }
+    m_interestBacklogBytes = 0;
+  }
+}
+
+bool
+NetDeviceFace::IsInterestShapingEnabled() const
+{
+  return m_interestRate > 0.0;
+}
+
+uint32_t
+NetDeviceFace::GetInterestBacklog() const
+{
+  return m_interestBacklog.size();
+}
+
+uint32_t
+NetDeviceFace::GetInterestBacklogBytes() const
+{
+  return m_interestBacklogBytes;
+}
+
+void
+NetDeviceFace::refillTokens()
+{
+  Time now = Simulator::Now();
+  m_tokens = std::min(m_bucketDepth,
+                      m_tokens + (now - m_lastRefill).ToDouble(Time::S) * m_interestRate);
+  m_lastRefill = now;
+}
+
+void
+NetDeviceFace::sendInterestBacklog()
+{
+  refillTokens();
+
+  // the event is scheduled for the moment the next token is complete; tolerate rounding
+  while (!m_interestBacklog.empty() && m_tokens >= 1.0 - 1e-9) {
+    std::pair<shared_ptr<const Interest>, Ptr<Packet>> queued = m_interestBacklog.front();
+    m_interestBacklog.pop_front();
+    m_interestBacklogBytes -= queued.second->GetSize();
+    m_tokens = std::max(0.0, m_tokens - 1.0);
+
+    sendInterestPacket(*queued.first, queued.second);
+  }
+
+  scheduleInterestBacklog();
+}
+
+void
+NetDeviceFace::scheduleInterestBacklog()
+{
+  if (m_interestBacklog.empty() || m_interestBacklogEvent.IsRunning())
+    return;
+
+  Time delay = Seconds(std::max(0.0, 1.0 - m_tokens) / m_interestRate);
+  m_interestBacklogEvent = Simulator::Schedule(delay, &NetDeviceFace::sendInterestBacklog, this);
+}
+
 void
 NetDeviceFace::send(Ptr<Packet> packet)
 {
@@ -81,24 +165,46 @@ NetDeviceFace::send(Ptr<Packet> packet)
                 "Packet size " << packet->GetSize() << " exceeds device MTU "
                                << m_netDevice->GetMtu());
 
-  FwHopCountTag tag;
-  packet->RemovePacketTag(tag);
-  tag.Increment();
-  packet->AddPacketTag(tag);
-
   m_netDevice->Send(packet, m_netDevice->GetBroadcast(), L3Protocol::ETHERNET_FRAME_TYPE);
 }
 
+void
+NetDeviceFace::sendInterestPacket(const Interest& interest, Ptr<Packet> packet)
+{
+  this->onSendInterest(interest);
+  send(packet);
+}
+
 void
 NetDeviceFace::sendInterest(const Interest& interest)
 {
   NS_LOG_FUNCTION(this << &interest);
 
   // std::cout << "!!!!>>>>> sending FROM NET FACE" << std::endl;
-  this->onSendInterest(interest);
-
   Ptr<Packet> packet = Convert::ToPacket(interest);
-  send(packet);
+  if (!IsInterestShapingEnabled()) {
+    sendInterestPacket(interest, packet);
+    return;
+  }
+
+  refillTokens();
+  if (m_interestBacklog.empty() && m_tokens >= 1.0) {
+    m_tokens -= 1.0;
+    sendInterestPacket(interest, packet);
+    return;
+  }
+
+  if (m_interestBacklog.size() >= m_maxInterestBacklog) {
+    NS_LOG_DEBUG("Interest backlog is full, dropping " << interest.getName());
+    this->onDropInterest(interest);
+    return;
+  }
+
+  this->onShapeInterest(interest);
+  // the caller may reuse its Interest after this call returns
+  m_interestBacklog.push_back(std::make_pair(make_shared<Interest>(interest), packet));
+  m_interestBacklogBytes += packet->GetSize();
+  scheduleInterestBacklog();
 }
 
 void
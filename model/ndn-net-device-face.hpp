@@ -24,6 +24,10 @@
 #include "ns3/ndnSIM/model/ndn-face.hpp"
 
 #include "ns3/net-device.h"
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+
+#include <deque>
 
 namespace ns3 {
 namespace ndn {
@@ -74,10 +78,63 @@ public:
   Ptr<NetDevice>
   GetNetDevice() const;
 
+  /**
+   * \brief Enable hop-by-hop token-bucket shaping of outgoing Interests
+   *
+   * Interests are paced at interestRate (the rate at which the link can return Data for them).
+   * Interests that cannot be sent immediately are queued in the face; Interests arriving when
+   * maxBacklog Interests are already queued are dropped.  Data packets are never shaped.
+   * onSendInterest fires when an Interest is handed to the NetDevice, i.e., after it leaves
+   * the queue, and never for dropped Interests.
+   *
+   * @param interestRate token refill rate (Interests per second), 0 disables shaping
+   * @param burst token bucket depth (Interests)
+   * @param maxBacklog maximum number of queued Interests
+   */
+  void
+  SetInterestShaping(double interestRate, uint32_t burst, uint32_t maxBacklog);
+
+  bool
+  IsInterestShapingEnabled() const;
+
+  /**
+   * \brief Get number of Interests currently queued by the shaper
+   */
+  uint32_t
+  GetInterestBacklog() const;
+
+  /**
+   * \brief Get total size (bytes) of Interests currently queued by the shaper
+   */
+  uint32_t
+  GetInterestBacklogBytes() const;
+
+public:
+  /// fires when an Interest is queued by the shaper
+  ::ndn::util::EventEmitter<Interest> onShapeInterest;
+
+  /// fires when an Interest is dropped because the shaper backlog is full
+  ::ndn::util::EventEmitter<Interest> onDropInterest;
+
 private:
   void
   send(Ptr<Packet> packet);
 
+  /// \brief fire onSendInterest and hand the Interest to the NetDevice
+  void
+  sendInterestPacket(const Interest& interest, Ptr<Packet> packet);
+
+  /// \brief add tokens accumulated since the last refill
+  void
+  refillTokens();
+
+  /// \brief send queued Interests for which tokens are available
+  void
+  sendInterestBacklog();
+
+  void
+  scheduleInterestBacklog();
+
   /// \brief callback from lower layers
   void
   receiveFromNetDevice(Ptr<NetDevice> device, Ptr<const Packet> p, uint16_t protocol,
@@ -86,6 +143,16 @@ private:
 private:
   Ptr<Node> m_node;
   Ptr<NetDevice> m_netDevice; ///< \brief Smart pointer to NetDevice
+
+  double m_interestRate; ///< \brief token refill rate (Interests per second), 0 if disabled
+  double m_bucketDepth;
+  double m_tokens;
+  Time m_lastRefill;
+  uint32_t m_maxInterestBacklog;
+  /// queued Interests with their packets, the Interest is kept for onSendInterest
+  std::deque<std::pair<shared_ptr<const Interest>, Ptr<Packet>>> m_interestBacklog;
+  uint32_t m_interestBacklogBytes;
+  EventId m_interestBacklogEvent;
 };
 
 } // namespace ndn
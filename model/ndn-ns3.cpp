@@ -25,6 +25,7 @@
 
 #include "ndn-header.hpp"
 #include "../utils/ndn-ns3-packet-tag.hpp"
+#include "../utils/ndn-fw-hop-count-tag.hpp"
 
 namespace ns3 {
 namespace ndn {
@@ -36,8 +37,12 @@ Convert::FromPacket(Ptr<Packet> packet)
   PacketHeader<T> header;
   packet->RemoveHeader(header);
 
+  // Peek does not modify (and so does not copy) the PacketTagList
+  FwHopCountTag hopCountTag;
+  packet->PeekPacketTag(hopCountTag);
+
   auto pkt = header.getPacket();
-  pkt->setTag(make_shared<Ns3PacketTag>(packet));
+  pkt->setTag(make_shared<Ns3PacketTag>(packet, hopCountTag.Get()));
 
   return pkt;
 }
@@ -54,17 +59,17 @@ Convert::ToPacket(const T& pkt)
 {
   PacketHeader<T> header(pkt);
 
-  Ptr<Packet> packet;
-
+  uint32_t hopCount = 0;
   auto tag = pkt.template getTag<Ns3PacketTag>();
   if (tag != nullptr) {
-    packet = tag->getPacket()->Copy();
-  }
-  else {
-    packet = Create<Packet>();
+    hopCount = tag->getHopCount();
   }
 
+  // The original ns-3 packet is not copied: the only metadata it carries is the hop count,
+  // which is stamped once on the new packet instead of being removed and re-added per hop
+  Ptr<Packet> packet = Create<Packet>();
   packet->AddHeader(header);
+  packet->AddPacketTag(FwHopCountTag(hopCount + 1));
   return packet;
 }
 
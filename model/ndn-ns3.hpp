@@ -29,10 +29,22 @@ namespace ndn {
 
 class Convert {
 public:
+  /**
+   * @brief Decode NDN packet from ns-3 packet
+   *
+   * The returned packet is tagged with Ns3PacketTag, which references the ns-3 packet and
+   * carries hop count from its FwHopCountTag (0 if none)
+   */
   template<class T>
   static std::shared_ptr<const T>
   FromPacket(Ptr<Packet> packet);
 
+  /**
+   * @brief Encode NDN packet into a new ns-3 packet to be sent over one hop
+   *
+   * The returned packet has FwHopCountTag set to the hop count from Ns3PacketTag of pkt
+   * (0 if none) plus one
+   */
   template<class T>
   static Ptr<Packet>
   ToPacket(const T& pkt);
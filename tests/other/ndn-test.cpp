@@ -68,6 +68,7 @@ private:
   double m_interestRate;
   bool m_shouldEvaluatePit;
   std::string m_strategy;
+  std::string m_memTraceFile;
   double m_initialOverhead;
   Time m_simulationTime;
 };
@@ -175,6 +176,7 @@ Tester::run(int argc, char* argv[])
                            "/localhost/nfd/strategy/best-route, ...) ",
                m_strategy);
   cmd.AddValue("sim-time", "Simulation time", m_simulationTime);
+  cmd.AddValue("mem-trace", "File to write per-table memory usage trace to", m_memTraceFile);
   cmd.Parse(argc, argv);
 
   // Creating nodes
@@ -228,6 +230,9 @@ Tester::run(int argc, char* argv[])
                       m_simulationTime / 200, beginRealTime);
 
   L2RateTracer::InstallAll("drop-trace2.txt", Seconds(0.5));
+  if (!m_memTraceFile.empty()) {
+    ndn::MemTracer::InstallAll(m_memTraceFile, m_simulationTime / 200);
+  }
   Simulator::Run();
   Simulator::Destroy();
 
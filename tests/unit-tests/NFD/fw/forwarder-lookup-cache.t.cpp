@@ -0,0 +1,175 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "fw/forwarder.hpp"
+#include "fw/strategy.hpp"
+
+#include "model/ndn-l3-protocol.hpp"
+#include "helper/ndn-stack-helper.hpp"
+
+#include "ns3/node.h"
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+/// face that drops everything sent to it
+class LookupCacheTestFace : public nfd::Face
+{
+public:
+  LookupCacheTestFace()
+    : Face(nfd::FaceUri("dummy://"), nfd::FaceUri("dummy://"))
+  {
+  }
+
+  virtual void
+  sendInterest(const Interest& interest)
+  {
+  }
+
+  virtual void
+  sendData(const Data& data)
+  {
+  }
+
+  virtual void
+  close()
+  {
+  }
+};
+
+/// strategy recording prefixes of the FIB entries it is given
+class LookupCacheTestStrategy : public nfd::fw::Strategy
+{
+public:
+  LookupCacheTestStrategy(nfd::Forwarder& forwarder, const Name& name)
+    : Strategy(forwarder, name)
+  {
+  }
+
+  virtual void
+  afterReceiveInterest(const nfd::Face& inFace, const Interest& interest,
+                       shared_ptr<nfd::fib::Entry> fibEntry,
+                       shared_ptr<nfd::pit::Entry> pitEntry)
+  {
+    fibPrefixes.push_back(fibEntry->getPrefix());
+  }
+
+public:
+  std::vector<Name> fibPrefixes;
+};
+
+class ForwarderLookupCacheFixture : public CleanupFixture
+{
+public:
+  ForwarderLookupCacheFixture()
+  {
+    Ptr<Node> node = CreateObject<Node>();
+    StackHelper ndnHelper;
+    ndnHelper.Install(node);
+    forwarder = node->GetObject<L3Protocol>()->getForwarder();
+
+    upstream1 = addFace();
+    upstream2 = addFace();
+
+    strategyA = make_shared<LookupCacheTestStrategy>(*forwarder,
+                                                     "/localhost/nfd/strategy/lookup-cache-a");
+    strategyB = make_shared<LookupCacheTestStrategy>(*forwarder,
+                                                     "/localhost/nfd/strategy/lookup-cache-b");
+    forwarder->getStrategyChoice().install(strategyA);
+    forwarder->getStrategyChoice().install(strategyB);
+  }
+
+  shared_ptr<LookupCacheTestFace>
+  addFace()
+  {
+    shared_ptr<LookupCacheTestFace> face = make_shared<LookupCacheTestFace>();
+    forwarder->addFace(face);
+    return face;
+  }
+
+  /**
+   * @brief Send the Interest from a new downstream face, so it joins the existing PIT entry
+   */
+  void
+  receiveInterest(const Name& name)
+  {
+    shared_ptr<Interest> interest = make_shared<Interest>(name);
+    interest->setNonce(++nonce);
+    forwarder->onInterest(*addFace(), *interest);
+  }
+
+public:
+  shared_ptr<nfd::Forwarder> forwarder;
+  shared_ptr<LookupCacheTestFace> upstream1;
+  shared_ptr<LookupCacheTestFace> upstream2;
+  shared_ptr<LookupCacheTestStrategy> strategyA;
+  shared_ptr<LookupCacheTestStrategy> strategyB;
+  uint32_t nonce = 0;
+};
+
+BOOST_FIXTURE_TEST_SUITE(NfdFwForwarderLookupCache, ForwarderLookupCacheFixture)
+
+BOOST_AUTO_TEST_CASE(TablesChange)
+{
+  forwarder->getFib().insert("/prefix").first->addNextHop(upstream1, 10);
+  forwarder->getStrategyChoice().insert("/prefix", strategyA->getName());
+
+  // the PIT entry caches strategy A and FIB entry /prefix
+  receiveInterest("/prefix/A/1");
+  BOOST_CHECK_EQUAL(forwarder->getPit().size(), 1);
+  BOOST_REQUIRE_EQUAL(strategyA->fibPrefixes.size(), 1);
+  BOOST_CHECK_EQUAL(strategyA->fibPrefixes.back(), "/prefix");
+
+  receiveInterest("/prefix/A/1");
+  BOOST_REQUIRE_EQUAL(strategyA->fibPrefixes.size(), 2);
+  BOOST_CHECK_EQUAL(strategyA->fibPrefixes.back(), "/prefix");
+
+  // longer FIB prefix and a strategy choice for it
+  forwarder->getFib().insert("/prefix/A").first->addNextHop(upstream2, 10);
+  forwarder->getStrategyChoice().insert("/prefix/A", strategyB->getName());
+
+  receiveInterest("/prefix/A/1");
+  BOOST_CHECK_EQUAL(forwarder->getPit().size(), 1);
+  BOOST_CHECK_EQUAL(strategyA->fibPrefixes.size(), 2);
+  BOOST_REQUIRE_EQUAL(strategyB->fibPrefixes.size(), 1);
+  BOOST_CHECK_EQUAL(strategyB->fibPrefixes.back(), "/prefix/A");
+
+  // strategy of an existing entry is changed
+  forwarder->getStrategyChoice().insert("/prefix/A", strategyA->getName());
+
+  receiveInterest("/prefix/A/1");
+  BOOST_CHECK_EQUAL(strategyB->fibPrefixes.size(), 1);
+  BOOST_REQUIRE_EQUAL(strategyA->fibPrefixes.size(), 3);
+  BOOST_CHECK_EQUAL(strategyA->fibPrefixes.back(), "/prefix/A");
+
+  // /prefix/A loses its only next hop and is erased
+  forwarder->getFib().removeNextHopFromAllEntries(upstream2);
+  BOOST_CHECK(forwarder->getFib().findExactMatch("/prefix/A") == nullptr);
+
+  receiveInterest("/prefix/A/1");
+  BOOST_REQUIRE_EQUAL(strategyA->fibPrefixes.size(), 4);
+  BOOST_CHECK_EQUAL(strategyA->fibPrefixes.back(), "/prefix");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
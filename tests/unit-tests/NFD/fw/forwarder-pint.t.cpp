@@ -0,0 +1,204 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "fw/forwarder.hpp"
+#include "fw/strategy.hpp"
+#include "table/pint-filter.hpp"
+
+#include "model/ndn-l3-protocol.hpp"
+#include "helper/ndn-stack-helper.hpp"
+
+#include "ns3/node.h"
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+/// face recording Interests sent to it
+class PintTestFace : public nfd::Face
+{
+public:
+  explicit
+  PintTestFace(bool isLocal = false)
+    : Face(nfd::FaceUri("dummy://"), nfd::FaceUri("dummy://"), isLocal)
+  {
+  }
+
+  virtual void
+  sendInterest(const Interest& interest)
+  {
+    sentInterests.push_back(interest);
+  }
+
+  virtual void
+  sendData(const Data& data)
+  {
+  }
+
+  virtual void
+  close()
+  {
+  }
+
+public:
+  std::vector<Interest> sentInterests;
+};
+
+/// strategy recording afterForwardPint triggers
+class PintTestStrategy : public nfd::fw::Strategy
+{
+public:
+  explicit
+  PintTestStrategy(nfd::Forwarder& forwarder)
+    : Strategy(forwarder, "/localhost/nfd/strategy/pint-test")
+  {
+  }
+
+  virtual void
+  afterReceiveInterest(const nfd::Face& inFace, const Interest& interest,
+                       shared_ptr<nfd::fib::Entry> fibEntry,
+                       shared_ptr<nfd::pit::Entry> pitEntry)
+  {
+    ++nAfterReceiveInterest;
+  }
+
+  virtual void
+  afterForwardPint(const nfd::Face& inFace, const Interest& interest,
+                   shared_ptr<nfd::fib::Entry> fibEntry, const nfd::Face& outFace,
+                   bool isFromContentStore)
+  {
+    forwardedPints.push_back(std::make_pair(outFace.getId(), isFromContentStore));
+  }
+
+public:
+  int nAfterReceiveInterest = 0;
+  std::vector<std::pair<nfd::FaceId, bool>> forwardedPints;
+};
+
+class ForwarderPintFixture : public CleanupFixture
+{
+public:
+  ForwarderPintFixture()
+  {
+    Ptr<Node> node = CreateObject<Node>();
+    StackHelper ndnHelper;
+    ndnHelper.Install(node);
+    forwarder = node->GetObject<L3Protocol>()->getForwarder();
+    forwarder->setPintFilter(make_shared<nfd::PintFilter>());
+  }
+
+  shared_ptr<PintTestFace>
+  addFace(bool isLocal = false)
+  {
+    shared_ptr<PintTestFace> face = make_shared<PintTestFace>(isLocal);
+    forwarder->addFace(face);
+    return face;
+  }
+
+  void
+  receivePint(nfd::Face& face, const Name& name)
+  {
+    shared_ptr<Interest> interest = make_shared<Interest>(name);
+    interest->setIsPint(1);
+    forwarder->onInterest(face, *interest);
+  }
+
+public:
+  shared_ptr<nfd::Forwarder> forwarder;
+};
+
+BOOST_FIXTURE_TEST_SUITE(NfdFwForwarderPint, ForwarderPintFixture)
+
+BOOST_AUTO_TEST_CASE(BypassPit)
+{
+  shared_ptr<PintTestFace> downstream = addFace();
+  shared_ptr<PintTestFace> upstream1 = addFace();
+  shared_ptr<PintTestFace> upstream2 = addFace();
+  shared_ptr<nfd::fib::Entry> fibEntry = forwarder->getFib().insert("/prefix").first;
+  fibEntry->addNextHop(upstream1, 10);
+  fibEntry->addNextHop(upstream2, 20);
+
+  shared_ptr<PintTestStrategy> strategy = make_shared<PintTestStrategy>(*forwarder);
+  forwarder->getStrategyChoice().install(strategy);
+  forwarder->getStrategyChoice().insert("/prefix", strategy->getName());
+
+  // PINT goes to the lowest-cost nexthop without PIT entry, and the strategy is informed
+  receivePint(*downstream, "/prefix/A/1");
+  BOOST_REQUIRE_EQUAL(upstream1->sentInterests.size(), 1);
+  BOOST_CHECK_EQUAL(upstream1->sentInterests[0].getName(), "/prefix/A/1");
+  BOOST_CHECK_EQUAL(upstream1->sentInterests[0].getIsPint(), 1);
+  BOOST_CHECK_EQUAL(upstream2->sentInterests.size(), 0);
+  BOOST_CHECK_EQUAL(forwarder->getPit().size(), 0);
+  BOOST_CHECK_EQUAL(strategy->nAfterReceiveInterest, 0);
+  BOOST_REQUIRE_EQUAL(strategy->forwardedPints.size(), 1);
+  BOOST_CHECK_EQUAL(strategy->forwardedPints[0].first, upstream1->getId());
+  BOOST_CHECK_EQUAL(strategy->forwardedPints[0].second, false);
+
+  // the same PINT is aggregated
+  receivePint(*downstream, "/prefix/A/1");
+  BOOST_CHECK_EQUAL(upstream1->sentInterests.size(), 1);
+  BOOST_CHECK_EQUAL(forwarder->getPintFilter()->getNAggregated(), 1);
+  BOOST_CHECK_EQUAL(strategy->forwardedPints.size(), 1);
+
+  // PINT is not sent back to its incoming face
+  receivePint(*upstream1, "/prefix/A/2");
+  BOOST_CHECK_EQUAL(upstream1->sentInterests.size(), 1);
+  BOOST_REQUIRE_EQUAL(upstream2->sentInterests.size(), 1);
+  BOOST_CHECK_EQUAL(upstream2->sentInterests[0].getName(), "/prefix/A/2");
+  BOOST_CHECK_EQUAL(forwarder->getPit().size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Scope)
+{
+  shared_ptr<PintTestFace> nonLocal = addFace();
+  shared_ptr<PintTestFace> local = addFace(true);
+  shared_ptr<PintTestFace> nonLocalUpstream = addFace();
+  forwarder->getFib().insert("/localhop").first->addNextHop(nonLocalUpstream, 10);
+  forwarder->getFib().insert("/localhost/A").first->addNextHop(nonLocalUpstream, 10);
+  forwarder->getFib().insert("/localhost/B").first->addNextHop(local, 10);
+
+  // /localhop PINT from a non-local face cannot go to a non-local face
+  receivePint(*nonLocal, "/localhop/1");
+  BOOST_CHECK_EQUAL(nonLocalUpstream->sentInterests.size(), 0);
+
+  // /localhop PINT from a local face can
+  receivePint(*local, "/localhop/2");
+  BOOST_CHECK_EQUAL(nonLocalUpstream->sentInterests.size(), 1);
+
+  // /localhost PINT cannot go to a non-local face, even from a local face
+  receivePint(*local, "/localhost/A/1");
+  BOOST_CHECK_EQUAL(nonLocalUpstream->sentInterests.size(), 1);
+
+  // /localhost PINT from a non-local face is dropped
+  receivePint(*nonLocal, "/localhost/B/1");
+  BOOST_CHECK_EQUAL(local->sentInterests.size(), 0);
+
+  // /localhost PINT from a local face can go to a local face
+  shared_ptr<PintTestFace> local2 = addFace(true);
+  receivePint(*local2, "/localhost/B/2");
+  BOOST_REQUIRE_EQUAL(local->sentInterests.size(), 1);
+  BOOST_CHECK_EQUAL(local->sentInterests[0].getName(), "/localhost/B/2");
+  BOOST_CHECK_EQUAL(forwarder->getPit().size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
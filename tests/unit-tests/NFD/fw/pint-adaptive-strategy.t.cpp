@@ -0,0 +1,109 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "fw/pint-adaptive-strategy.hpp"
+#include "face/null-face.hpp"
+
+#include "model/ndn-l3-protocol.hpp"
+#include "helper/ndn-stack-helper.hpp"
+
+#include "ns3/node.h"
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class PintAdaptiveStrategyTester : public nfd::fw::PintAdaptiveStrategy
+{
+public:
+  using PintAdaptiveStrategy::MeasurementsEntryInfo;
+  using PintAdaptiveStrategy::pickNextHop;
+};
+
+static bool
+isAnyEligible(const nfd::fib::NextHop&)
+{
+  return true;
+}
+
+BOOST_FIXTURE_TEST_SUITE(NfdFwPintAdaptiveStrategy, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(FaceRanking)
+{
+  Ptr<Node> node = CreateObject<Node>();
+  StackHelper ndnHelper;
+  ndnHelper.Install(node);
+  Ptr<L3Protocol> l3 = node->GetObject<L3Protocol>();
+
+  shared_ptr<nfd::Face> face1 = make_shared<nfd::NullFace>();
+  shared_ptr<nfd::Face> face2 = make_shared<nfd::NullFace>();
+  shared_ptr<nfd::Face> face3 = make_shared<nfd::NullFace>();
+  l3->addFace(face1);
+  l3->addFace(face2);
+  l3->addFace(face3);
+
+  nfd::fib::Entry fibEntry("/prefix");
+  fibEntry.addNextHop(face1, 10);
+  fibEntry.addNextHop(face2, 20);
+  fibEntry.addNextHop(face3, 30);
+  const nfd::fib::NextHopList& nexthops = fibEntry.getNextHops();
+
+  // without measurements, the lowest-cost nexthop is picked
+  BOOST_CHECK_EQUAL(PintAdaptiveStrategyTester::pickNextHop(nexthops, nullptr,
+                                                            &isAnyEligible)->getFace(), face1);
+
+  PintAdaptiveStrategyTester::MeasurementsEntryInfo info;
+  for (int i = 0; i < 10; i++) {
+    info.recordHit(face1->getId(), false);
+    info.recordHit(face2->getId(), true);
+    info.recordHit(face3->getId(), true);
+    info.recordDelivery(face2->getId(), false);
+  }
+  BOOST_CHECK_EQUAL(info.getScore(face1->getId()), 0.0);
+  BOOST_CHECK_GT(info.getScore(face3->getId()), info.getScore(face2->getId()));
+  BOOST_CHECK_EQUAL(info.getScore(1000), 0.0);
+
+  // face3 has the highest hit rate * delivery rate
+  BOOST_CHECK_EQUAL(PintAdaptiveStrategyTester::pickNextHop(nexthops, &info,
+                                                            &isAnyEligible)->getFace(), face3);
+
+  // ineligible nexthops are skipped
+  nfd::FaceId face3Id = face3->getId();
+  auto isNotFace3 = [face3Id] (const nfd::fib::NextHop& nexthop) {
+    return nexthop.getFace()->getId() != face3Id;
+  };
+  BOOST_CHECK_EQUAL(PintAdaptiveStrategyTester::pickNextHop(nexthops, &info,
+                                                            isNotFace3)->getFace(), face2);
+
+  // scores below MIN_SCORE fall back to the lowest cost
+  for (int i = 0; i < 20; i++) {
+    info.recordDelivery(face2->getId(), false);
+  }
+  BOOST_CHECK_EQUAL(PintAdaptiveStrategyTester::pickNextHop(nexthops, &info,
+                                                            isNotFace3)->getFace(), face1);
+
+  auto isNone = [] (const nfd::fib::NextHop&) { return false; };
+  BOOST_CHECK(PintAdaptiveStrategyTester::pickNextHop(nexthops, &info, isNone) == nexthops.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
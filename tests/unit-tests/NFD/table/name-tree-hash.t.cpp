@@ -0,0 +1,92 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "table/name-tree-hash.hpp"
+#include "core/city-hash.hpp"
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(NfdTableNameTreeHash, CleanupFixture)
+
+/**
+ * \brief Hash of every prefix, computed as before the one-pass kernel: over the wire encoding of
+ *        every parsed component
+ */
+static std::vector<size_t>
+computeReferenceHashSet(const Name& prefix)
+{
+  prefix.wireEncode();
+
+  size_t hashValue = 0;
+  std::vector<size_t> hashValueSet;
+  hashValueSet.push_back(hashValue);
+
+  for (Name::const_iterator it = prefix.begin(); it != prefix.end(); it++) {
+    const char* wireFormat = reinterpret_cast<const char*>(it->wire());
+    if (sizeof(size_t) >= 8)
+      hashValue ^= static_cast<size_t>(CityHash64(wireFormat, it->size()));
+    else
+      hashValue ^= static_cast<size_t>(CityHash32(wireFormat, it->size()));
+    hashValueSet.push_back(hashValue);
+  }
+
+  return hashValueSet;
+}
+
+BOOST_AUTO_TEST_CASE(MatchesPreviousImplementation)
+{
+  std::vector<uint8_t> longValue(300, 0x5a);  // 3-octet TLV-LENGTH
+  std::vector<uint8_t> hugeValue(70000, 0xa5); // 5-octet TLV-LENGTH
+
+  std::vector<Name> names;
+  names.push_back(Name());
+  names.push_back(Name("/"));
+  names.push_back(Name("/a"));
+  names.push_back(Name("/hello/world/%00%01%FF/"));
+  names.push_back(Name("/prefix").appendSegment(42).appendNumber(0xFFFFFFFFFFFFULL));
+  names.push_back(Name("/long").append(longValue.data(), longValue.size()).append("x"));
+  names.push_back(Name("/huge").append(hugeValue.data(), hugeValue.size()).append(""));
+
+  std::vector<size_t> hashSet;
+  for (const Name& name : names) {
+    std::vector<size_t> expected = computeReferenceHashSet(name);
+
+    BOOST_CHECK_EQUAL(nfd::name_tree::computeHash(name), expected.back());
+
+    std::vector<size_t> actual = nfd::name_tree::computeHashSet(name);
+    BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+
+    // storage is reused, values do not depend on the previous contents
+    nfd::name_tree::computeHashSet(name, hashSet);
+    BOOST_CHECK_EQUAL_COLLECTIONS(hashSet.begin(), hashSet.end(), expected.begin(),
+                                  expected.end());
+
+    for (size_t i = 0; i <= name.size(); i++) {
+      BOOST_CHECK_EQUAL(nfd::name_tree::computeHash(name.getPrefix(i)), expected[i]);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,127 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "table/pint-filter.hpp"
+
+#include "helper/ndn-stack-helper.hpp"
+
+#include "ns3/simulator.h"
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(NfdTablePintFilter, CleanupFixture)
+
+static void
+AdvanceTo(const Time& time)
+{
+  Simulator::Stop(time - Simulator::Now());
+  Simulator::Run();
+}
+
+BOOST_AUTO_TEST_CASE(Construct)
+{
+  StackHelper ndnHelper; // ndn-cxx clocks follow the simulator
+
+  BOOST_CHECK_THROW(nfd::PintFilter(::ndn::time::nanoseconds::zero()), std::invalid_argument);
+
+  nfd::PintFilter filter(::ndn::time::seconds(2), 100);
+  BOOST_CHECK(filter.getWindow() == ::ndn::time::seconds(2));
+  BOOST_CHECK_EQUAL(filter.getNBits(), 128);
+  BOOST_CHECK_EQUAL(nfd::PintFilter(::ndn::time::seconds(1), 10).getNBits(), 64);
+  BOOST_CHECK_EQUAL(filter.getNAggregated(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Aggregation)
+{
+  StackHelper ndnHelper;
+  nfd::PintFilter filter(::ndn::time::seconds(1), 1 << 16);
+
+  BOOST_CHECK_EQUAL(filter.add("/prefix/A/1"), false);
+  BOOST_CHECK_EQUAL(filter.add("/prefix/A/1"), true);
+  BOOST_CHECK_EQUAL(filter.add("/prefix/A/2"), false);
+  BOOST_CHECK_EQUAL(filter.add("/prefix/A"), false); // prefix is a different name
+  BOOST_CHECK_EQUAL(filter.add("/prefix/A/2"), true);
+  BOOST_CHECK_EQUAL(filter.getNAggregated(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(WindowRotation)
+{
+  StackHelper ndnHelper;
+  nfd::PintFilter filter(::ndn::time::seconds(1), 1 << 16);
+
+  BOOST_CHECK_EQUAL(filter.add("/A"), false); // window [0s, 1s)
+  BOOST_CHECK_EQUAL(filter.add("/B"), false);
+
+  // previous window is still checked
+  AdvanceTo(MilliSeconds(1500)); // window [1s, 2s)
+  BOOST_CHECK_EQUAL(filter.add("/A"), true);
+
+  // /A was recorded again in [1s, 2s), /B only in [0s, 1s)
+  AdvanceTo(MilliSeconds(2500)); // window [2s, 3s)
+  BOOST_CHECK_EQUAL(filter.add("/A"), true);
+  BOOST_CHECK_EQUAL(filter.add("/B"), false);
+
+  // both windows are cleared after more than one window without PINTs
+  AdvanceTo(MilliSeconds(4500)); // window [4s, 5s)
+  BOOST_CHECK_EQUAL(filter.add("/A"), false);
+  BOOST_CHECK_EQUAL(filter.add("/B"), false);
+
+  // windows stay aligned to multiples of the window duration
+  AdvanceTo(MilliSeconds(4999));
+  BOOST_CHECK_EQUAL(filter.add("/C"), false);
+  AdvanceTo(MilliSeconds(6000)); // window [6s, 7s), [5s, 6s) had no PINTs
+  BOOST_CHECK_EQUAL(filter.add("/C"), false);
+  BOOST_CHECK_EQUAL(filter.getNAggregated(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(FalsePositives)
+{
+  StackHelper ndnHelper;
+
+  // 1000 names in a 64-bit filter: almost every name collides
+  nfd::PintFilter small(::ndn::time::seconds(1), 64);
+  // 100 names in a 1 Mbit filter: false positive probability is about 2.7e-11 per name
+  nfd::PintFilter large(::ndn::time::seconds(1), 1 << 20);
+  // 200 names in a 4 Kbit filter: false positive probability grows to about 0.003 per name
+  nfd::PintFilter medium(::ndn::time::seconds(1), 1 << 12);
+
+  for (int i = 0; i < 1000; i++) {
+    Name name("/prefix");
+    name.appendNumber(i);
+    small.add(name);
+    if (i < 100) {
+      large.add(name);
+    }
+    if (i < 200) {
+      medium.add(name);
+    }
+  }
+
+  BOOST_CHECK_GT(small.getNAggregated(), 900);
+  BOOST_CHECK_EQUAL(large.getNAggregated(), 0);
+  BOOST_CHECK_LT(medium.getNAggregated(), 5);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
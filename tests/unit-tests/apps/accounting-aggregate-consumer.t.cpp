@@ -0,0 +1,170 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "apps/accounting-aggregate-consumer.hpp"
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include <algorithm>
+#include <set>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class AccountingAggregateConsumerFixture : public CleanupFixture
+{
+public:
+  AccountingAggregateConsumerFixture()
+    : nDelays(0)
+  {
+    nodes.Create(2);
+
+    PointToPointHelper p2p;
+    p2p.SetDeviceAttribute("DataRate", StringValue("10Mbps"));
+    p2p.SetChannelAttribute("Delay", StringValue("1ms"));
+    p2p.Install(nodes.Get(0), nodes.Get(1));
+
+    StackHelper ndnHelper;
+    ndnHelper.SetDefaultRoutes(true);
+    ndnHelper.InstallAll();
+  }
+
+  Ptr<AccountingAggregateConsumer>
+  InstallConsumer()
+  {
+    AppHelper consumerHelper("ns3::ndn::AccountingAggregateConsumer");
+    consumerHelper.SetPrefix("/prefix");
+    consumerHelper.SetAttribute("NConsumers", UintegerValue(4));
+    consumerHelper.SetAttribute("FirstConsumerID", IntegerValue(10));
+    consumerHelper.SetAttribute("Frequency", StringValue("5")); // 20 Interests a second in total
+    consumerHelper.SetAttribute("LifeTime", StringValue("1s"));
+
+    Ptr<AccountingAggregateConsumer> consumer =
+      DynamicCast<AccountingAggregateConsumer>(consumerHelper.Install(nodes.Get(0)).Get(0));
+    consumer->TraceConnectWithoutContext("TransmittedInterests",
+                                         MakeCallback(&AccountingAggregateConsumerFixture::
+                                                        OnTransmittedInterest,
+                                                      this));
+    consumer->TraceConnectWithoutContext("FirstInterestDataDelay",
+                                         MakeCallback(&AccountingAggregateConsumerFixture::
+                                                        OnFirstInterestDataDelay,
+                                                      this));
+    return consumer;
+  }
+
+  void
+  OnTransmittedInterest(shared_ptr<const Interest> interest, Ptr<App>, shared_ptr<Face>)
+  {
+    sendTimes.push_back(Simulator::Now());
+    seqs.push_back(interest->getName().at(-1).toSequenceNumber());
+  }
+
+  void
+  OnFirstInterestDataDelay(Ptr<App>, uint32_t, Time, uint32_t, int32_t)
+  {
+    nDelays++;
+  }
+
+public:
+  NodeContainer nodes;
+
+  std::vector<Time> sendTimes;
+  std::vector<uint32_t> seqs;
+  size_t nDelays;
+};
+
+BOOST_FIXTURE_TEST_SUITE(AppsAccountingAggregateConsumer, AccountingAggregateConsumerFixture)
+
+BOOST_AUTO_TEST_CASE(PerConsumerNames)
+{
+  Ptr<AccountingAggregateConsumer> consumer = InstallConsumer();
+
+  AppHelper producerHelper("ns3::ndn::Producer");
+  producerHelper.SetPrefix("/prefix");
+  producerHelper.SetAttribute("PayloadSize", StringValue("100"));
+  producerHelper.Install(nodes.Get(1));
+
+  Simulator::Stop(Seconds(4.99));
+  Simulator::Run();
+
+  // Randomize is not set, so the merged process is periodic
+  BOOST_REQUIRE_EQUAL(sendTimes.size(), 100);
+  for (size_t i = 1; i < sendTimes.size(); i++) {
+    BOOST_CHECK_EQUAL(sendTimes[i] - sendTimes[i - 1], MilliSeconds(50));
+  }
+
+  // every logical consumer requests its own name
+  std::set<uint32_t> uniqueSeqs(seqs.begin(), seqs.end());
+  BOOST_CHECK_EQUAL(uniqueSeqs.size(), 4);
+  BOOST_CHECK_EQUAL(*uniqueSeqs.begin(), 10);
+  BOOST_CHECK_EQUAL(*uniqueSeqs.rbegin(), 13);
+
+  uint64_t nSent = 0, nSatisfied = 0;
+  for (uint32_t index = 0; index < consumer->GetNConsumers(); index++) {
+    BOOST_CHECK_EQUAL(consumer->GetNSent(index),
+                      static_cast<uint64_t>(std::count(seqs.begin(), seqs.end(),
+                                                       consumer->GetConsumerID(index))));
+    BOOST_CHECK_EQUAL(consumer->GetNTimedOut(index), 0);
+    nSent += consumer->GetNSent(index);
+    nSatisfied += consumer->GetNSatisfied(index);
+  }
+  BOOST_CHECK_EQUAL(nSent, 100);
+  BOOST_CHECK_GE(nSatisfied, 99); // the last Interest may still be in flight
+
+  // Interests are tracked by the outstanding Interest table
+  BOOST_CHECK_GE(nDelays, 99);
+}
+
+BOOST_AUTO_TEST_CASE(Expiry)
+{
+  Ptr<AccountingAggregateConsumer> consumer = InstallConsumer();
+  consumer->SetAttribute("Randomize", StringValue("exponential"));
+
+  // no producer: requests are retransmitted until they expire
+  Simulator::Stop(Seconds(4.99));
+  Simulator::Run();
+
+  uint64_t nSent = 0, nTimedOut = 0;
+  for (uint32_t index = 0; index < consumer->GetNConsumers(); index++) {
+    BOOST_CHECK_EQUAL(consumer->GetNSatisfied(index), 0);
+    nSent += consumer->GetNSent(index);
+    nTimedOut += consumer->GetNTimedOut(index);
+  }
+
+  BOOST_CHECK_EQUAL(nSent, sendTimes.size());
+  BOOST_CHECK_GT(nTimedOut, 0);
+  BOOST_CHECK_EQUAL(nDelays, 0);
+
+  // exponential gaps are no longer equal
+  std::set<Time> gaps;
+  for (size_t i = 1; i < sendTimes.size(); i++) {
+    gaps.insert(sendTimes[i] - sendTimes[i - 1]);
+  }
+  BOOST_CHECK_GT(gaps.size(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
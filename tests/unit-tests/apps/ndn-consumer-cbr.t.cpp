@@ -0,0 +1,173 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "apps/ndn-consumer-cbr.hpp"
+#include "utils/ndn-timer-wheel.hpp"
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class ConsumerCbrFixture : public CleanupFixture
+{
+public:
+  ConsumerCbrFixture()
+  {
+    nodes.Create(2);
+
+    PointToPointHelper p2p;
+    p2p.Install(nodes.Get(0), nodes.Get(1));
+
+    StackHelper ndnHelper;
+    ndnHelper.SetDefaultRoutes(true);
+    ndnHelper.InstallAll();
+  }
+
+  void
+  Run(uint32_t batchSize, const std::string& batchWindow)
+  {
+    AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
+    consumerHelper.SetPrefix("/prefix");
+    consumerHelper.SetAttribute("Frequency", StringValue("100")); // every 10ms
+    consumerHelper.SetAttribute("BatchSize", UintegerValue(batchSize));
+    consumerHelper.SetAttribute("BatchWindow", StringValue(batchWindow));
+
+    Ptr<Application> consumer = consumerHelper.Install(nodes.Get(0)).Get(0);
+    consumer->TraceConnectWithoutContext("TransmittedInterests",
+                                         MakeCallback(&ConsumerCbrFixture::OnTransmittedInterest,
+                                                      this));
+
+    Simulator::Stop(Seconds(0.995));
+    Simulator::Run();
+  }
+
+  void
+  OnTransmittedInterest(shared_ptr<const Interest> interest, Ptr<App>, shared_ptr<Face>)
+  {
+    sendTimes.push_back(Simulator::Now());
+    seqs.push_back(interest->getName().at(-1).toSequenceNumber());
+  }
+
+public:
+  NodeContainer nodes;
+
+  std::vector<Time> sendTimes;
+  std::vector<uint64_t> seqs;
+};
+
+BOOST_FIXTURE_TEST_SUITE(AppsConsumerCbr, ConsumerCbrFixture)
+
+BOOST_AUTO_TEST_CASE(NoBatchWindow)
+{
+  // BatchSize alone does not move any Interest from its exact send time
+  Run(10, "0s");
+
+  BOOST_REQUIRE_EQUAL(sendTimes.size(), 100);
+  for (size_t i = 0; i < sendTimes.size(); i++) {
+    BOOST_CHECK_EQUAL(seqs[i], i);
+    BOOST_CHECK_EQUAL(sendTimes[i], MilliSeconds(10 * i));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(BatchWindow)
+{
+  // Interests due within 35ms from the send event go out with it: 0, 10, 20, 30ms at 0ms, the
+  // next batch at 40ms, and so on
+  Run(10, "35ms");
+
+  BOOST_REQUIRE_EQUAL(sendTimes.size(), 100);
+  for (size_t i = 0; i < sendTimes.size(); i++) {
+    BOOST_CHECK_EQUAL(seqs[i], i);
+    BOOST_CHECK_EQUAL(sendTimes[i], MilliSeconds(40 * (i / 4)));
+
+    // sent early, but never by more than the window
+    BOOST_CHECK_LE(sendTimes[i], MilliSeconds(10 * i));
+    BOOST_CHECK_LE(MilliSeconds(10 * i) - sendTimes[i], MilliSeconds(35));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(BatchSizeLimitsWindow)
+{
+  // at most 2 Interests per event even though 4 fit into the window
+  Run(2, "35ms");
+
+  BOOST_REQUIRE_EQUAL(sendTimes.size(), 100);
+  for (size_t i = 0; i < sendTimes.size(); i++) {
+    BOOST_CHECK_EQUAL(seqs[i], i);
+    BOOST_CHECK_EQUAL(sendTimes[i], MilliSeconds(20 * (i / 2)));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(RetxCheckOnlyWhileOutstanding)
+{
+  AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
+  consumerHelper.SetPrefix("/prefix");
+  consumerHelper.SetAttribute("Frequency", StringValue("100"));
+  consumerHelper.SetAttribute("MaxSeq", IntegerValue(10));
+  Ptr<Application> consumer = consumerHelper.Install(nodes.Get(0)).Get(0);
+  consumer->TraceConnectWithoutContext("TransmittedInterests",
+                                       MakeCallback(&ConsumerCbrFixture::OnTransmittedInterest,
+                                                    this));
+
+  AppHelper producerHelper("ns3::ndn::Producer");
+  producerHelper.SetPrefix("/prefix");
+  producerHelper.Install(nodes.Get(1));
+
+  // no retransmission check is pending once all Interests are satisfied
+  Simulator::Stop(Seconds(10.0));
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(sendTimes.size(), 10);
+  BOOST_CHECK_EQUAL(TimerWheel::GetTimerWheel(nodes.Get(0))->GetNPending(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(RetxCheckAtDeadline)
+{
+  AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
+  consumerHelper.SetPrefix("/prefix");
+  consumerHelper.SetAttribute("Frequency", StringValue("100"));
+  consumerHelper.SetAttribute("MaxSeq", IntegerValue(1));
+  Ptr<Application> consumer = consumerHelper.Install(nodes.Get(0)).Get(0);
+  consumer->TraceConnectWithoutContext("TransmittedInterests",
+                                       MakeCallback(&ConsumerCbrFixture::OnTransmittedInterest,
+                                                    this));
+
+  // no producer: the single Interest is retransmitted on every timeout
+  Simulator::Stop(Seconds(10.0));
+  Simulator::Run();
+
+  BOOST_REQUIRE_GT(sendTimes.size(), 1);
+  for (uint64_t seq : seqs) {
+    BOOST_CHECK_EQUAL(seq, 0);
+  }
+
+  // one check is armed for the retransmitted Interest, not one per RetxTimer period
+  BOOST_CHECK_EQUAL(TimerWheel::GetTimerWheel(nodes.Get(0))->GetNPending(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
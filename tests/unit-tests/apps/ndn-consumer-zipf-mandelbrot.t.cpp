@@ -0,0 +1,113 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "apps/ndn-consumer-zipf-mandelbrot.hpp"
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include <algorithm>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class ConsumerZipfMandelbrotFixture : public CleanupFixture
+{
+public:
+  ConsumerZipfMandelbrotFixture()
+    : nReceivedDatas(0)
+    , nDelays(0)
+    , maxSeq(0)
+  {
+    nodes.Create(2);
+
+    // long delay keeps many Interests outstanding at the same time
+    PointToPointHelper p2p;
+    p2p.SetDeviceAttribute("DataRate", StringValue("100Mbps"));
+    p2p.SetChannelAttribute("Delay", StringValue("50ms"));
+    p2p.Install(nodes.Get(0), nodes.Get(1));
+
+    StackHelper ndnHelper;
+    ndnHelper.SetDefaultRoutes(true);
+    ndnHelper.InstallAll();
+  }
+
+  void
+  OnReceivedData(shared_ptr<const Data>, Ptr<App>, shared_ptr<Face>)
+  {
+    nReceivedDatas++;
+  }
+
+  void
+  OnFirstInterestDataDelay(Ptr<App>, uint32_t seq, Time, uint32_t, int32_t)
+  {
+    nDelays++;
+    maxSeq = std::max(maxSeq, seq);
+  }
+
+public:
+  NodeContainer nodes;
+
+  size_t nReceivedDatas;
+  size_t nDelays;
+  uint32_t maxSeq;
+};
+
+BOOST_FIXTURE_TEST_SUITE(AppsConsumerZipfMandelbrot, ConsumerZipfMandelbrotFixture)
+
+BOOST_AUTO_TEST_CASE(LargeCatalog)
+{
+  // content indices are drawn from [1, 200000], far beyond the ring window of the outstanding
+  // Interest table (65536 sequence numbers)
+  AppHelper consumerHelper("ns3::ndn::ConsumerZipfMandelbrot");
+  consumerHelper.SetPrefix("/prefix");
+  consumerHelper.SetAttribute("Frequency", StringValue("200"));
+  consumerHelper.SetAttribute("NumberOfContents", StringValue("200000"));
+  Ptr<Application> consumer = consumerHelper.Install(nodes.Get(0)).Get(0);
+  consumer->TraceConnectWithoutContext("ReceivedDatas",
+                                       MakeCallback(&ConsumerZipfMandelbrotFixture::OnReceivedData,
+                                                    this));
+  consumer->TraceConnectWithoutContext("FirstInterestDataDelay",
+                                       MakeCallback(&ConsumerZipfMandelbrotFixture::
+                                                      OnFirstInterestDataDelay,
+                                                    this));
+
+  AppHelper producerHelper("ns3::ndn::Producer");
+  producerHelper.SetPrefix("/prefix");
+  producerHelper.SetAttribute("PayloadSize", StringValue("100"));
+  producerHelper.Install(nodes.Get(1));
+
+  Simulator::Stop(Seconds(2.0));
+  Simulator::Run();
+
+  BOOST_CHECK_GT(nReceivedDatas, 300);
+  BOOST_CHECK_GT(maxSeq, 65536);
+
+  // every Interest stays tracked, so every Data is matched to its send time
+  BOOST_CHECK_EQUAL(nDelays, nReceivedDatas);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
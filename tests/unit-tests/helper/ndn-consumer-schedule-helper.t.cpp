@@ -0,0 +1,141 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "helper/ndn-consumer-schedule-helper.hpp"
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include <utility>
+#include <vector>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class ConsumerScheduleHelperFixture : public CleanupFixture
+{
+public:
+  typedef std::vector<std::pair<Time, Name>> Transmissions;
+
+  /**
+   * @brief Run the scenario with precomputed schedules and get all transmitted Interests
+   */
+  Transmissions
+  Run(uint32_t nThreads, size_t chunkSize, const Time& refillInterval)
+  {
+    transmissions.clear();
+
+    NodeContainer nodes;
+    nodes.Create(3);
+
+    PointToPointHelper p2p;
+    p2p.Install(nodes.Get(0), nodes.Get(2));
+    p2p.Install(nodes.Get(1), nodes.Get(2));
+
+    StackHelper ndnHelper;
+    ndnHelper.SetDefaultRoutes(true);
+    ndnHelper.InstallAll();
+
+    ApplicationContainer consumers;
+
+    AppHelper cbrHelper("ns3::ndn::ConsumerCbr");
+    cbrHelper.SetPrefix("/cbr");
+    cbrHelper.SetAttribute("Frequency", StringValue("100"));
+    cbrHelper.SetAttribute("Randomize", StringValue("exponential"));
+    consumers.Add(cbrHelper.Install(nodes.Get(0)));
+    consumers.Add(cbrHelper.Install(nodes.Get(1)));
+
+    AppHelper zipfHelper("ns3::ndn::ConsumerZipfMandelbrot");
+    zipfHelper.SetPrefix("/zipf");
+    zipfHelper.SetAttribute("Frequency", StringValue("100"));
+    zipfHelper.SetAttribute("Randomize", StringValue("uniform"));
+    zipfHelper.SetAttribute("NumberOfContents", StringValue("1000"));
+    consumers.Add(zipfHelper.Install(nodes.Get(0)));
+    consumers.Add(zipfHelper.Install(nodes.Get(1)));
+
+    for (ApplicationContainer::Iterator i = consumers.Begin(); i != consumers.End(); ++i) {
+      (*i)->TraceConnectWithoutContext("TransmittedInterests",
+                                       MakeCallback(&ConsumerScheduleHelperFixture::
+                                                      OnTransmittedInterest,
+                                                    this));
+    }
+
+    AppHelper producerHelper("ns3::ndn::Producer");
+    producerHelper.SetPrefix("/");
+    producerHelper.SetAttribute("PayloadSize", StringValue("100"));
+    producerHelper.Install(nodes.Get(2));
+
+    ConsumerScheduleHelper scheduleHelper;
+    scheduleHelper.SetNThreads(nThreads);
+    scheduleHelper.SetChunkSize(chunkSize);
+    scheduleHelper.SetRefillInterval(refillInterval);
+    BOOST_CHECK_EQUAL(scheduleHelper.Precompute(consumers, Seconds(5.0)), 4);
+
+    Simulator::Stop(Seconds(5.0));
+    Simulator::Run();
+
+    // node IDs, and so default streams of the consumers, start from zero again in the next run
+    Simulator::Destroy();
+    Names::Clear();
+    GlobalRouter::clear();
+
+    return transmissions;
+  }
+
+  void
+  OnTransmittedInterest(shared_ptr<const Interest> interest, Ptr<App>, shared_ptr<Face>)
+  {
+    transmissions.push_back(std::make_pair(Simulator::Now(), interest->getName()));
+  }
+
+public:
+  Transmissions transmissions;
+};
+
+BOOST_FIXTURE_TEST_SUITE(HelperConsumerScheduleHelper, ConsumerScheduleHelperFixture)
+
+BOOST_AUTO_TEST_CASE(ThreadCountIndependent)
+{
+  Transmissions oneThread = Run(1, 4096, Seconds(1.0));
+  Transmissions fourThreads = Run(4, 4096, Seconds(1.0));
+
+  BOOST_CHECK_GT(oneThread.size(), 1500);
+  BOOST_CHECK(oneThread == fourThreads);
+}
+
+BOOST_AUTO_TEST_CASE(ChunkSizeIndependent)
+{
+  Transmissions oneChunk = Run(4, 4096, Seconds(1.0));
+
+  // consumers use up half of 8 Interests in 40ms on average, so they both get refilled by the
+  // pool and run out between refills
+  Transmissions smallChunks = Run(4, 8, MilliSeconds(50));
+
+  BOOST_CHECK_GT(oneChunk.size(), 1500);
+  BOOST_CHECK(oneChunk == smallChunks);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,127 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "helper/ndn-global-routing-graph.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(HelperGlobalRoutingGraph, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(ShortestPaths)
+{
+  //     1       1
+  //  0 ---> 1 ---> 2
+  //  |             ^
+  //  +-------------+
+  //         5
+  //  3 (disconnected)
+  GlobalRoutingGraph graph;
+  for (int i = 0; i < 4; i++) {
+    graph.AddVertex();
+  }
+  graph.AddEdge(1, 2, 1);
+  graph.AddEdge(0, 2, 5);
+  graph.AddEdge(0, 1, 1);
+  graph.Finalize();
+
+  BOOST_CHECK_EQUAL(graph.GetNVertices(), 4);
+  BOOST_CHECK_EQUAL(graph.GetNEdges(), 3);
+  BOOST_REQUIRE_EQUAL(graph.GetEdgesEnd(0) - graph.GetEdgesBegin(0), 2);
+  uint32_t edge02 = graph.GetEdgesBegin(0);
+  uint32_t edge01 = edge02 + 1;
+  BOOST_CHECK_EQUAL(graph.GetEdge(edge02).target, 2);
+  BOOST_CHECK_EQUAL(graph.GetEdge(edge01).target, 1);
+
+  std::vector<GlobalRoutingGraph::Distance> distances;
+  graph.ShortestPaths(0, distances);
+  BOOST_CHECK_EQUAL(distances[2].metric, 2);
+  BOOST_CHECK_EQUAL(distances[2].firstEdge, edge01);
+  BOOST_CHECK_EQUAL(distances[3].metric, GlobalRoutingGraph::METRIC_INF);
+  BOOST_CHECK_EQUAL(distances[3].firstEdge, GlobalRoutingGraph::INVALID);
+
+  graph.ShortestPaths(0, distances, edge02);
+  BOOST_CHECK_EQUAL(distances[2].metric, 5);
+  BOOST_CHECK_EQUAL(distances[2].firstEdge, edge02);
+  BOOST_CHECK_EQUAL(distances[1].firstEdge, GlobalRoutingGraph::INVALID);
+
+  std::vector<uint32_t> components;
+  BOOST_CHECK_EQUAL(graph.ConnectedComponents(components), 2);
+  BOOST_CHECK_EQUAL(components[0], components[2]);
+  BOOST_CHECK_NE(components[0], components[3]);
+}
+
+BOOST_AUTO_TEST_CASE(LoopFreeNextHopsZeroMetric)
+{
+  //       0        10
+  //  3 ----- 0 ------+
+  //          |       2      (all edges in both directions)
+  //          +-- 1 --+
+  //           0    10
+  //
+  // 0 and 1 are equally far from 2, so neither may use the other as a next hop, while 3 is
+  // connected only through a zero-metric edge and must still be able to reach 2 via 0
+  GlobalRoutingGraph graph;
+  for (int i = 0; i < 4; i++) {
+    graph.AddVertex();
+  }
+  graph.AddEdge(0, 1, 0);
+  graph.AddEdge(0, 2, 10);
+  graph.AddEdge(0, 3, 0);
+  graph.AddEdge(1, 0, 0);
+  graph.AddEdge(1, 2, 10);
+  graph.AddEdge(2, 0, 10);
+  graph.AddEdge(2, 1, 10);
+  graph.AddEdge(3, 0, 0);
+  graph.Finalize();
+
+  std::vector<uint32_t> metrics;
+  std::vector<uint32_t> hops;
+  graph.ShortestPathsTo(2, metrics, &hops);
+  BOOST_CHECK_EQUAL(metrics[0], 10);
+  BOOST_CHECK_EQUAL(metrics[1], 10);
+  BOOST_CHECK_EQUAL(metrics[3], 10);
+  BOOST_CHECK_EQUAL(hops[0], 1);
+  BOOST_CHECK_EQUAL(hops[3], 2);
+
+  std::vector<std::pair<uint32_t, uint32_t>> nextHops;
+  graph.LoopFreeNextHops(0, metrics, hops, nextHops);
+  BOOST_REQUIRE_EQUAL(nextHops.size(), 1);
+  BOOST_CHECK_EQUAL(nextHops[0].first, 10);
+  BOOST_CHECK_EQUAL(nextHops[0].second, graph.GetEdgesBegin(0) + 1);
+
+  graph.LoopFreeNextHops(1, metrics, hops, nextHops);
+  BOOST_REQUIRE_EQUAL(nextHops.size(), 1);
+  BOOST_CHECK_EQUAL(graph.GetEdge(nextHops[0].second).target, 2);
+
+  graph.LoopFreeNextHops(3, metrics, hops, nextHops);
+  BOOST_REQUIRE_EQUAL(nextHops.size(), 1);
+  BOOST_CHECK_EQUAL(nextHops[0].first, 10);
+  BOOST_CHECK_EQUAL(graph.GetEdge(nextHops[0].second).target, 0);
+
+  graph.LoopFreeNextHops(2, metrics, hops, nextHops);
+  BOOST_CHECK_EQUAL(nextHops.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -134,6 +134,123 @@ BOOST_AUTO_TEST_CASE(CalculateRouteCase2)
   Simulator::Run();
 }
 
+BOOST_AUTO_TEST_CASE(CalculateMultipathRoutes)
+{
+  ofstream file1("/tmp/topo3.txt");
+  file1 << "router\n\n"
+        << "#node city  y x mpi-partition\n"
+        << "A3  NA  1 1 1\n"
+        << "B3  NA  80  -40 1\n"
+        << "C3  NA  80  40  1\n\n"
+        << "link\n\n"
+        << "# from  to  capacity  metric  delay queue\n"
+        << "A3      B3  10Mbps    100 1ms 100\n"
+        << "A3      C3  10Mbps    50  1ms 100\n"
+        << "B3      C3  10Mbps    1 1ms 100\n";
+  file1.close();
+
+  AnnotatedTopologyReader topologyReader("");
+  topologyReader.SetFileName("/tmp/topo3.txt");
+  topologyReader.Read();
+
+  // Install NDN stack on all nodes
+  ndn::StackHelper ndnHelper;
+  ndnHelper.InstallAll();
+
+  topologyReader.ApplyOspfMetric();
+
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.InstallAll();
+
+  ndnGlobalRoutingHelper.AddOrigins("/prefix", Names::Find<Node>("C3"));
+  ndn::GlobalRoutingHelper::CalculateMultipathRoutes(2);
+
+  // A3 -> C3 (cost 50) is the best, A3 -> B3 -> C3 (cost 101) is loop-free alternative
+  std::vector<std::pair<std::string, uint64_t>> nextHops;
+  auto ndn = Names::Find<Node>("A3")->GetObject<ndn::L3Protocol>();
+  for (const auto& entry : ndn->getForwarder()->getFib()) {
+    for (auto& nextHop : entry.getNextHops()) {
+      auto face = dynamic_pointer_cast<ndn::NetDeviceFace>(nextHop.getFace());
+      if (face == nullptr)
+        continue;
+      nextHops.push_back(
+        std::make_pair(Names::FindName(face->GetNetDevice()->GetChannel()->GetDevice(1)->GetNode()),
+                       nextHop.getCost()));
+    }
+  }
+
+  BOOST_REQUIRE_EQUAL(nextHops.size(), 2);
+  BOOST_CHECK_EQUAL(nextHops[0].first, "C3");
+  BOOST_CHECK_EQUAL(nextHops[0].second, 50);
+  BOOST_CHECK_EQUAL(nextHops[1].first, "B3");
+  BOOST_CHECK_EQUAL(nextHops[1].second, 101);
+
+  // B3 -> A3 -> C3 is not loop-free (A3 is farther from C3 than B3), so B3 has only one next hop
+  nextHops.clear();
+  ndn = Names::Find<Node>("B3")->GetObject<ndn::L3Protocol>();
+  for (const auto& entry : ndn->getForwarder()->getFib()) {
+    for (auto& nextHop : entry.getNextHops()) {
+      if (dynamic_pointer_cast<ndn::NetDeviceFace>(nextHop.getFace()) != nullptr)
+        nextHops.push_back(std::make_pair("", nextHop.getCost()));
+    }
+  }
+  BOOST_CHECK_EQUAL(nextHops.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(CalculateMultipathRoutesEquidistant)
+{
+  ofstream file1("/tmp/topo4.txt");
+  file1 << "router\n\n"
+        << "#node city  y x mpi-partition\n"
+        << "D4  NA  1 1 1\n"
+        << "S4  NA  80  -40 1\n"
+        << "N4  NA  80  40  1\n\n"
+        << "link\n\n"
+        << "# from  to  capacity  metric  delay queue\n"
+        << "S4      D4  10Mbps    10  1ms 100\n"
+        << "N4      D4  10Mbps    10  1ms 100\n"
+        << "S4      N4  10Mbps    1 1ms 100\n";
+  file1.close();
+
+  AnnotatedTopologyReader topologyReader("");
+  topologyReader.SetFileName("/tmp/topo4.txt");
+  topologyReader.Read();
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.InstallAll();
+
+  topologyReader.ApplyOspfMetric();
+
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.InstallAll();
+
+  ndnGlobalRoutingHelper.AddOrigins("/prefix", Names::Find<Node>("D4"));
+  ndn::GlobalRoutingHelper::CalculateMultipathRoutes(2);
+
+  // S4 and N4 are both 10 away from D4: using each other (cost 11) would let Interests loop
+  // S4 -> N4 -> S4 when both nodes use all their next hops, so neither installs the other
+  for (const std::string& name : {"S4", "N4"}) {
+    std::vector<std::pair<std::string, uint64_t>> nextHops;
+    auto ndn = Names::Find<Node>(name)->GetObject<ndn::L3Protocol>();
+    for (const auto& entry : ndn->getForwarder()->getFib()) {
+      for (auto& nextHop : entry.getNextHops()) {
+        auto face = dynamic_pointer_cast<ndn::NetDeviceFace>(nextHop.getFace());
+        if (face == nullptr)
+          continue;
+        Ptr<Channel> channel = face->GetNetDevice()->GetChannel();
+        Ptr<Node> other = channel->GetDevice(0)->GetNode() == Names::Find<Node>(name)
+                            ? channel->GetDevice(1)->GetNode()
+                            : channel->GetDevice(0)->GetNode();
+        nextHops.push_back(std::make_pair(Names::FindName(other), nextHop.getCost()));
+      }
+    }
+
+    BOOST_REQUIRE_EQUAL(nextHops.size(), 1);
+    BOOST_CHECK_EQUAL(nextHops[0].first, "D4");
+    BOOST_CHECK_EQUAL(nextHops[0].second, 10);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
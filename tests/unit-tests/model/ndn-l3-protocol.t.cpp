@@ -0,0 +1,82 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include "model/ndn-l3-protocol.hpp"
+#include "model/ndn-net-device-face.hpp"
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "daemon/fw/forwarder.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(ModelNdnL3Protocol, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(FaceByNetDevice)
+{
+  NodeContainer nodes;
+  nodes.Create(3);
+
+  PointToPointHelper p2p;
+  NetDeviceContainer link0_1 = p2p.Install(nodes.Get(0), nodes.Get(1));
+  NetDeviceContainer link0_2 = p2p.Install(nodes.Get(0), nodes.Get(2));
+
+  StackHelper ndnHelper;
+  ndnHelper.InstallAll();
+
+  Ptr<L3Protocol> l3 = nodes.Get(0)->GetObject<L3Protocol>();
+
+  shared_ptr<Face> face0_1 = l3->getFaceByNetDevice(link0_1.Get(0));
+  shared_ptr<Face> face0_2 = l3->getFaceByNetDevice(link0_2.Get(0));
+  BOOST_REQUIRE(face0_1 != nullptr);
+  BOOST_REQUIRE(face0_2 != nullptr);
+  BOOST_CHECK(face0_1 != face0_2);
+  BOOST_CHECK_EQUAL(l3->getFaceById(face0_1->getId()), face0_1);
+  BOOST_CHECK_EQUAL(l3->getFaceById(face0_2->getId()), face0_2);
+
+  // device of another node with the same interface index
+  BOOST_CHECK(l3->getFaceByNetDevice(link0_1.Get(1)) == nullptr);
+
+  size_t nNetDeviceFaces = 0;
+  for (const shared_ptr<NetDeviceFace>& face : l3->getNetDeviceFaces()) {
+    BOOST_CHECK(face == face0_1 || face == face0_2);
+    ++nNetDeviceFaces;
+  }
+  BOOST_CHECK_EQUAL(nNetDeviceFaces, 2);
+
+  // NetDeviceFaces plus internal, content store, and null faces
+  BOOST_CHECK_EQUAL(l3->getForwarder()->getFaceTable().size(), 5);
+
+  face0_2->close();
+  BOOST_CHECK(l3->getFaceByNetDevice(link0_2.Get(0)) == nullptr);
+  BOOST_CHECK_EQUAL(l3->getForwarder()->getFaceTable().size(), 4);
+  BOOST_CHECK(l3->getFaceById(nfd::FACEID_RESERVED_MAX + 2) == nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
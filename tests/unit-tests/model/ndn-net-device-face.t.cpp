@@ -133,6 +133,57 @@ BOOST_AUTO_TEST_CASE(SendData)
  Simulator::Destroy();
 }
 
+BOOST_AUTO_TEST_CASE(ShapeInterests)
+{
+  NodeContainer nodes;
+  nodes.Create(2);
+  PointToPointHelper p2p;
+  p2p.SetDeviceAttribute("DataRate", StringValue("88Kbps"));
+  p2p.Install(nodes.Get(0), nodes.Get(1));
+
+  StackHelper ndnHelper;
+  ndnHelper.SetInterestShaping(true, 1100, 5, 20); // 88Kbps / (8 * 1100) = 10 Interests per second
+
+  Ptr<FaceContainer> faceContainer = ndnHelper.InstallAll();
+  auto netDeviceFace = std::dynamic_pointer_cast<NetDeviceFace>(faceContainer->Get(faceContainer->Begin()));
+  BOOST_REQUIRE(netDeviceFace != nullptr);
+  BOOST_CHECK(netDeviceFace->IsInterestShapingEnabled());
+
+  int nShaped = 0;
+  int nDropped = 0;
+  std::vector<Name> sent;
+  netDeviceFace->onShapeInterest += [&nShaped] (const Interest&) { ++nShaped; };
+  netDeviceFace->onDropInterest += [&nDropped] (const Interest&) { ++nDropped; };
+  netDeviceFace->onSendInterest += [&sent] (const Interest& interest) {
+    sent.push_back(interest.getName());
+  };
+
+  for (uint32_t i = 0; i < 50; ++i) {
+    auto interest = std::make_shared<ndn::Interest>(Name("/prefix").appendSequenceNumber(i));
+    interest->setNonce(i);
+    netDeviceFace->sendInterest(*interest);
+  }
+
+  // 5 Interests are sent using the burst, 20 are queued, the rest is dropped
+  BOOST_CHECK_EQUAL(nShaped, 20);
+  BOOST_CHECK_EQUAL(nDropped, 25);
+  BOOST_CHECK_EQUAL(netDeviceFace->GetInterestBacklog(), 20);
+  BOOST_CHECK_GT(netDeviceFace->GetInterestBacklogBytes(), 0);
+  BOOST_CHECK_EQUAL(sent.size(), 5);
+
+  Simulator::Stop(Seconds(1.05));
+  Simulator::Run();
+
+  // one queued Interest is sent every 100ms, onSendInterest fires when it leaves the backlog
+  BOOST_CHECK_EQUAL(netDeviceFace->GetInterestBacklog(), 10);
+  BOOST_REQUIRE_EQUAL(sent.size(), 15);
+  for (uint32_t i = 0; i < sent.size(); ++i) {
+    BOOST_CHECK_EQUAL(sent[i], Name("/prefix").appendSequenceNumber(i));
+  }
+
+  Simulator::Destroy();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
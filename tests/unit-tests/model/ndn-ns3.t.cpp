@@ -21,6 +21,7 @@
 #include "helper/ndn-stack-helper.hpp"
 #include "model/ndn-header.hpp"
 #include "utils/ndn-ns3-packet-tag.hpp"
+#include "utils/ndn-fw-hop-count-tag.hpp"
 
 #include <ndn-cxx/encoding/block.hpp>
 #include <ndn-cxx/interest.hpp>
@@ -54,6 +55,29 @@ BOOST_AUTO_TEST_CASE(ToPacket)
   BOOST_CHECK_EQUAL(type2, ::ndn::tlv::Data);
 }
 
+BOOST_AUTO_TEST_CASE(HopCount)
+{
+  auto interest = make_shared<ndn::Interest>("/prefix");
+  interest->setNonce(1);
+
+  // locally generated packet, first hop
+  Ptr<Packet> packet = Convert::ToPacket(*interest);
+  FwHopCountTag hopCountTag;
+  BOOST_REQUIRE(packet->PeekPacketTag(hopCountTag));
+  BOOST_CHECK_EQUAL(hopCountTag.Get(), 1);
+
+  auto received = Convert::FromPacket<Interest>(packet->Copy());
+  auto ns3PacketTag = received->getTag<Ns3PacketTag>();
+  BOOST_REQUIRE(ns3PacketTag != nullptr);
+  BOOST_CHECK_EQUAL(ns3PacketTag->getHopCount(), 1);
+
+  // forwarded packet, second hop
+  Ptr<Packet> forwarded = Convert::ToPacket(*received);
+  BOOST_REQUIRE(forwarded->PeekPacketTag(hopCountTag));
+  BOOST_CHECK_EQUAL(hopCountTag.Get(), 2);
+  BOOST_CHECK_EQUAL(Convert::getPacketType(forwarded), ::ndn::tlv::Interest);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
@@ -0,0 +1,123 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-interest-factory.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(UtilsNdnInterestFactory, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(PatchSequenceAndNonce)
+{
+  InterestFactory factory;
+  factory.SetInterestLifetime(time::milliseconds(2000));
+
+  Name prefix("/prefix/A");
+  for (uint32_t seq : {0, 1, 255, 256, 1000, 65536, 100000}) {
+    shared_ptr<Interest> interest = factory.Create(prefix, seq, seq + 7);
+    BOOST_CHECK_EQUAL(interest->getName(), Name(prefix).appendSequenceNumber(seq));
+    BOOST_CHECK_EQUAL(interest->getNonce(), seq + 7);
+    BOOST_CHECK_EQUAL(interest->getInterestLifetime(), time::milliseconds(2000));
+  }
+  // one template per width of the sequence number: 1, 2, and 4 bytes
+  BOOST_CHECK_EQUAL(factory.GetNTemplateBuilds(), 3);
+
+  // every call creates a separate Interest
+  shared_ptr<Interest> a = factory.Create(prefix, 5, 1);
+  shared_ptr<Interest> b = factory.Create(prefix, 5, 1);
+  BOOST_CHECK(a != b);
+  BOOST_CHECK(a->wireEncode() == b->wireEncode());
+
+  factory.Create("/other", 5, 1);
+  BOOST_CHECK_EQUAL(factory.GetNTemplateBuilds(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(PintPayload)
+{
+  InterestFactory factory(InterestFactory::PINT_PAYLOAD_SEQS);
+
+  shared_ptr<Interest> interest = factory.Create("/prefix", 0, 42);
+  BOOST_CHECK_EQUAL(interest->getName(), Name("/prefix").appendSequenceNumber(0));
+  BOOST_CHECK_EQUAL(interest->getNonce(), 42);
+
+  std::vector<uint64_t> payload = interest->getPayload();
+  BOOST_CHECK_EQUAL(payload.size(), InterestFactory::PINT_PAYLOAD_SEQS);
+  BOOST_CHECK_EQUAL(payload.front(), 0);
+
+  factory.Create("/prefix", 0, 43);
+  BOOST_CHECK_EQUAL(factory.GetNTemplateBuilds(), 1);
+
+  // payload values are patched in place as long as their widths do not change
+  payload = factory.Create("/prefix", 1, 44)->getPayload();
+  BOOST_CHECK(payload == std::vector<uint64_t>(InterestFactory::PINT_PAYLOAD_SEQS, 1));
+  BOOST_CHECK_EQUAL(factory.GetNTemplateBuilds(), 1);
+
+  // without a key, every value is the sequence number, as in an Interest built from scratch
+  Interest baseline;
+  baseline.setName(Name("/prefix").appendSequenceNumber(3));
+  baseline.setNonce(44);
+  baseline.setPayload(std::vector<uint64_t>(InterestFactory::PINT_PAYLOAD_SEQS, 3));
+  BOOST_CHECK(factory.Create("/prefix", 3, 44)->wireEncode() == baseline.wireEncode());
+
+  // consumer ID as the accounting key (ConsumerIDInPayload of accounting consumers)
+  factory.SetPayloadKey(7);
+  payload = factory.Create("/prefix", 2, 45)->getPayload();
+  BOOST_REQUIRE_EQUAL(payload.size(), InterestFactory::PINT_PAYLOAD_SEQS);
+  BOOST_CHECK_EQUAL(payload.front(), 7);
+  BOOST_CHECK_EQUAL(payload.back(), 2);
+  BOOST_CHECK_EQUAL(factory.GetNTemplateBuilds(), 1);
+
+  // a new key every Interest needs no rebuild either
+  for (uint64_t key = 10; key < 20; key++) {
+    factory.SetPayloadKey(key);
+    interest = factory.Create("/prefix", key + 100, 46);
+    payload = interest->getPayload();
+    BOOST_CHECK_EQUAL(interest->getName(), Name("/prefix").appendSequenceNumber(key + 100));
+    BOOST_CHECK_EQUAL(payload.front(), key);
+    BOOST_CHECK_EQUAL(payload.back(), key + 100);
+  }
+  BOOST_CHECK_EQUAL(factory.GetNTemplateBuilds(), 1);
+
+  // wider values change the encoding
+  factory.SetPayloadKey(300);
+  payload = factory.Create("/prefix", 5, 47)->getPayload();
+  BOOST_CHECK_EQUAL(payload.front(), 300);
+  BOOST_CHECK_EQUAL(payload.back(), 5);
+  BOOST_CHECK_EQUAL(factory.GetNTemplateBuilds(), 2);
+
+  payload = factory.Create("/prefix", 70000, 48)->getPayload();
+  BOOST_CHECK_EQUAL(payload.front(), 300);
+  BOOST_CHECK_EQUAL(payload.back(), 70000);
+  BOOST_CHECK_EQUAL(factory.GetNTemplateBuilds(), 3);
+
+  // encoding is the same as of an Interest built from scratch
+  Interest expected;
+  expected.setName(Name("/prefix").appendSequenceNumber(70001));
+  expected.setNonce(49);
+  expected.setPayload(std::vector<uint64_t>{300, 70001, 70001, 70001});
+  BOOST_CHECK(factory.Create("/prefix", 70001, 49)->wireEncode() == expected.wireEncode());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
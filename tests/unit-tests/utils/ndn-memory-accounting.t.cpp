@@ -0,0 +1,89 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-memory-accounting.hpp"
+#include "utils/tracers/ndn-l3-rate-tracer.hpp"
+#include "utils/tracers/ndn-cs-tracer.hpp"
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(UtilsNdnMemoryAccounting, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(Tracers)
+{
+  NodeContainer nodes;
+  nodes.Create(2);
+
+  PointToPointHelper p2p;
+  p2p.Install(nodes.Get(0), nodes.Get(1));
+
+  StackHelper ndnHelper;
+  ndnHelper.SetDefaultRoutes(true);
+  ndnHelper.InstallAll();
+
+  MemoryAccounting::Report report = MemoryAccounting::CollectGlobal();
+  BOOST_REQUIRE_EQUAL(report.count("Tracers"), 1);
+  BOOST_CHECK_EQUAL(report["Tracers"].nEntries, 0);
+  BOOST_CHECK_EQUAL(report["Tracers"].nBytes, 0);
+
+  L3RateTracer::InstallAll("/dev/null", Seconds(1));
+  CsTracer::InstallAll("/dev/null", Seconds(1), 1, 1.0);
+
+  report = MemoryAccounting::CollectGlobal();
+  BOOST_CHECK_EQUAL(report["Tracers"].nEntries, 4);
+  size_t nBytes = report["Tracers"].nBytes;
+  BOOST_CHECK_GT(nBytes, 0);
+
+  AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
+  consumerHelper.SetPrefix("/prefix");
+  consumerHelper.SetAttribute("Frequency", StringValue("10"));
+  consumerHelper.Install(nodes.Get(0));
+
+  AppHelper producerHelper("ns3::ndn::Producer");
+  producerHelper.SetPrefix("/prefix");
+  producerHelper.Install(nodes.Get(1));
+
+  Simulator::Stop(Seconds(2.0));
+  Simulator::Run();
+
+  // per-face and per-prefix statistics, as well as reuse distance history, grow with traffic
+  report = MemoryAccounting::CollectGlobal();
+  BOOST_CHECK_EQUAL(report["Tracers"].nEntries, 4);
+  BOOST_CHECK_GT(report["Tracers"].nBytes, nBytes);
+
+  L3RateTracer::Destroy();
+  CsTracer::Destroy();
+
+  report = MemoryAccounting::CollectGlobal();
+  BOOST_CHECK_EQUAL(report["Tracers"].nEntries, 0);
+  BOOST_CHECK_EQUAL(report["Tracers"].nBytes, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
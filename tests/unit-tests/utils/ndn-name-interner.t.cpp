@@ -0,0 +1,148 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-name-interner.hpp"
+#include "apps/ndn-consumer-cbr.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(UtilsNdnNameInterner, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(SharedComponents)
+{
+  NameComponentPool& pool = NameComponentPool::getInstance();
+  size_t nComponents = pool.size();
+
+  {
+    InternedName a(Name("/prefix/A/suffix1"));
+    InternedName b(Name("/prefix/A/suffix2"));
+    BOOST_CHECK_EQUAL(pool.size(), nComponents + 4);
+
+    BOOST_CHECK_EQUAL(a.getId(0), b.getId(0));
+    BOOST_CHECK_EQUAL(a.getId(1), b.getId(1));
+    BOOST_CHECK_NE(a.getId(2), b.getId(2));
+    BOOST_CHECK(a != b);
+
+    InternedName c(Name("/prefix/A/suffix1"));
+    BOOST_CHECK(a == c);
+    BOOST_CHECK_EQUAL(a.toName(), Name("/prefix/A/suffix1"));
+    BOOST_CHECK(InternedName(Name("/prefix/A")).isPrefixOf(b));
+
+    InternedName d = b;
+    BOOST_CHECK(d == b);
+  }
+
+  // all references are gone
+  BOOST_CHECK_EQUAL(pool.size(), nComponents);
+}
+
+BOOST_AUTO_TEST_CASE(OwnBuffer)
+{
+  NameComponentPool& pool = NameComponentPool::getInstance();
+  size_t memoryUsage = pool.getMemoryUsage();
+
+  Block wire;
+  {
+    Interest interest(Name("/prefix/unique-component"));
+    wire = interest.wireEncode();
+  }
+  Interest interest(wire);
+
+  InternedName name(interest.getName());
+  const name::Component& component = name.get(1);
+  BOOST_CHECK_EQUAL(component, interest.getName().get(1));
+
+  // component does not point into (and keep alive) the wire of the Interest
+  BOOST_CHECK(component.wire() < wire.wire() || component.wire() >= wire.wire() + wire.size());
+  BOOST_CHECK_GE(pool.getMemoryUsage(), memoryUsage + component.size());
+}
+
+BOOST_AUTO_TEST_CASE(NameTimePrefix)
+{
+  NameComponentPool& pool = NameComponentPool::getInstance();
+  size_t nComponents = pool.size();
+
+  {
+    Name prefix("/prefix/A");
+    NameTime a(Name(prefix).appendSequenceNumber(1), Seconds(1), Seconds(1), prefix.size());
+    NameTime b(Name(prefix).appendSequenceNumber(2), Seconds(2), Seconds(2), prefix.size());
+
+    // only the shared prefix is interned
+    BOOST_CHECK_EQUAL(pool.size(), nComponents + 2);
+    BOOST_CHECK_EQUAL(a.prefix.size(), 2);
+    BOOST_CHECK_EQUAL(a.prefix.getId(1), b.prefix.getId(1));
+
+    auto key = [&prefix] (const Name& name) {
+      return NameTime(name, Time(), Time(), prefix.size());
+    };
+    BOOST_CHECK(a.HasSameName(key(Name(prefix).appendSequenceNumber(1))));
+    BOOST_CHECK(!a.HasSameName(key(Name(prefix).appendSequenceNumber(2))));
+    BOOST_CHECK(!a.HasSameName(key(Name(prefix).appendSequenceNumber(1).append("more"))));
+    BOOST_CHECK(!a.HasSameName(key(Name("/prefix/B").appendSequenceNumber(1))));
+    BOOST_CHECK(!a.HasSameName(key(prefix)));
+    BOOST_CHECK_EQUAL(a.GetNameHash(), key(Name(prefix).appendSequenceNumber(1)).GetNameHash());
+  }
+
+  BOOST_CHECK_EQUAL(pool.size(), nComponents);
+}
+
+BOOST_AUTO_TEST_CASE(NameTimeIndexLookup)
+{
+  Name prefix("/prefix/A");
+  auto entry = [&prefix] (uint64_t seq, Time time) {
+    return new NameTime(Name(prefix).appendSequenceNumber(seq), time, time, prefix.size());
+  };
+
+  NameTimeIndex index;
+  index.Insert(entry(1, Seconds(1)));
+  index.Insert(entry(2, Seconds(2)));
+  index.Insert(entry(1, Seconds(3)));
+  BOOST_CHECK_EQUAL(index.GetN(), 3);
+  BOOST_CHECK_GT(index.GetMemoryUsage().nBytes, 0);
+
+  NameTime key(Name(prefix).appendSequenceNumber(1), Time(), Time(), prefix.size());
+
+  // entries of the same name are taken oldest first
+  NameTime* nt = index.Take(key);
+  BOOST_REQUIRE(nt != nullptr);
+  BOOST_CHECK_EQUAL(nt->rtt, Seconds(1));
+  delete nt;
+
+  nt = index.Take(key);
+  BOOST_REQUIRE(nt != nullptr);
+  BOOST_CHECK_EQUAL(nt->rtt, Seconds(3));
+  delete nt;
+
+  BOOST_CHECK(index.Take(key) == nullptr);
+  BOOST_CHECK(index.Take(NameTime(Name("/prefix/B").appendSequenceNumber(2), Time(), Time(),
+                                  prefix.size())) == nullptr);
+  BOOST_CHECK_EQUAL(index.GetN(), 1);
+
+  // the remaining entry is deleted with the index
+  index.Insert(entry(3, Seconds(4)));
+  BOOST_CHECK_EQUAL(index.GetN(), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
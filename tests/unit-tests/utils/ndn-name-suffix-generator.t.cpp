@@ -0,0 +1,55 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-name-suffix-generator.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(UtilsNdnNameSuffixGenerator, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(Reproducible)
+{
+  NameSuffixGenerator a;
+  NameSuffixGenerator b;
+  a.SetStream(5);
+  b.SetStream(5);
+
+  std::string suffix = a.Generate(32);
+  BOOST_CHECK_EQUAL(suffix.size(), 32);
+  BOOST_CHECK_EQUAL(suffix, b.Generate(32));
+  BOOST_CHECK_NE(suffix, a.Generate(32));
+
+  NameSuffixGenerator c;
+  c.SetStream(6);
+  BOOST_CHECK_NE(suffix, c.Generate(32));
+
+  a.SetStream(5);
+  BOOST_CHECK_EQUAL(suffix, a.Generate(32));
+
+  std::string hex = a.Generate(20, NameSuffixGenerator::HEX);
+  BOOST_CHECK_EQUAL(hex.find_first_not_of("0123456789abcdef"), std::string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,127 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-outstanding-interest-table.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(UtilsNdnOutstandingInterestTable, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(InsertFindErase)
+{
+  OutstandingInterestTable table;
+
+  for (uint32_t seq = 100; seq < 200; seq++) {
+    OutstandingInterest* entry = table.Insert(seq);
+    BOOST_REQUIRE(entry != 0);
+    BOOST_CHECK_EQUAL(entry->retxCount, 0);
+    entry->retxCount++;
+  }
+  BOOST_CHECK_EQUAL(table.GetSize(), 100);
+  BOOST_CHECK_EQUAL(table.GetCapacity(), 128);
+
+  BOOST_CHECK_EQUAL(table.Insert(150)->retxCount, 1); // existing entry
+  BOOST_CHECK(table.Find(99) == 0);
+  BOOST_CHECK(table.Find(228) == 0); // same slot as 100
+
+  for (uint32_t seq = 100; seq < 190; seq++) {
+    table.Erase(seq);
+  }
+  BOOST_CHECK_EQUAL(table.GetSize(), 10);
+
+  // window moved, so no growth is needed
+  table.Insert(300);
+  BOOST_CHECK_EQUAL(table.GetCapacity(), 128);
+  BOOST_REQUIRE(table.Find(195) != 0);
+  BOOST_CHECK_EQUAL(table.Find(195)->retxCount, 1);
+
+  // older sequence number widens the window backwards
+  table.Insert(50);
+  BOOST_CHECK_EQUAL(table.GetCapacity(), 256);
+  BOOST_CHECK(table.Find(50) != 0);
+  BOOST_CHECK(table.Find(300) != 0);
+}
+
+BOOST_AUTO_TEST_CASE(NeverSatisfied)
+{
+  OutstandingInterestTable table(1024);
+  BOOST_CHECK_EQUAL(table.GetMaxCapacity(), 1024);
+
+  // sequence number 0 is never satisfied and pins the oldest end of the window
+  table.Insert(0)->retxCount = 3;
+  for (uint32_t seq = 1; seq < 1024; seq++) {
+    BOOST_REQUIRE(table.Insert(seq) != 0);
+    table.Erase(seq);
+  }
+  BOOST_CHECK(!table.IsHashed());
+  BOOST_CHECK_EQUAL(table.GetCapacity(), 1024);
+
+  // the window would exceed the limit: entries move to the hash table, none is dropped
+  for (uint32_t seq = 1024; seq < 5000; seq++) {
+    BOOST_REQUIRE(table.Insert(seq) != 0);
+    table.Erase(seq);
+  }
+  BOOST_CHECK(table.IsHashed());
+  BOOST_CHECK_EQUAL(table.GetCapacity(), 0);
+  BOOST_REQUIRE(table.Find(0) != 0);
+  BOOST_CHECK_EQUAL(table.Find(0)->retxCount, 3);
+  BOOST_CHECK_EQUAL(table.GetSize(), 1);
+
+  table.Insert(0x80000000);
+  table.Insert(6000);
+  BOOST_CHECK_EQUAL(table.GetSize(), 3);
+  BOOST_CHECK(table.Find(6000) != 0);
+
+  table.Erase(0);
+  BOOST_CHECK(table.Find(0) == 0);
+  BOOST_CHECK_EQUAL(table.GetSize(), 2);
+
+  table.Clear();
+  BOOST_CHECK(!table.IsHashed());
+  BOOST_CHECK_EQUAL(table.GetSize(), 0);
+  BOOST_REQUIRE(table.Insert(7) != 0);
+  BOOST_CHECK(table.Find(7) != 0);
+}
+
+BOOST_AUTO_TEST_CASE(SparseSequenceNumbers)
+{
+  // content indices of a large catalog: outstanding sequence numbers span far beyond the window
+  OutstandingInterestTable table(1024);
+
+  std::vector<uint32_t> seqs;
+  for (uint32_t i = 0; i < 500; i++) {
+    seqs.push_back((i * 2654435761u) % 1000000 + 1);
+  }
+  for (uint32_t seq : seqs) {
+    BOOST_REQUIRE(table.Insert(seq) != 0);
+  }
+  BOOST_CHECK(table.IsHashed());
+  BOOST_CHECK_EQUAL(table.GetSize(), 500);
+  for (uint32_t seq : seqs) {
+    BOOST_CHECK(table.Find(seq) != 0);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,121 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+#include "utils/ndn-pint-accounting.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(UtilsNdnPintAccounting, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(PayloadView)
+{
+  std::vector<uint64_t> values = {7, 0, 255, 256, 0xFFFFFFFFFFull};
+
+  Interest interest("/prefix");
+  interest.setNonce(1);
+  interest.setIsPint(true);
+  interest.setPayload(values);
+  interest.wireEncode();
+
+  PintPayloadView view(interest);
+  BOOST_CHECK(view.isZeroCopy());
+  BOOST_REQUIRE_EQUAL(view.size(), values.size());
+  BOOST_CHECK(!view.empty());
+  for (size_t i = 0; i < values.size(); ++i) {
+    BOOST_CHECK_EQUAL(view[i], values[i]);
+  }
+
+  // same for an Interest decoded from the wire, as received by producers
+  Interest decoded(interest.wireEncode());
+  PintPayloadView decodedView(decoded);
+  BOOST_CHECK(decodedView.isZeroCopy());
+  BOOST_REQUIRE_EQUAL(decodedView.size(), values.size());
+  BOOST_CHECK_EQUAL(decodedView[4], values[4]);
+
+  Interest empty("/prefix");
+  empty.setNonce(1);
+  BOOST_CHECK(PintPayloadView(empty).empty());
+  BOOST_CHECK(!PintPayloadView(empty).isZeroCopy());
+}
+
+BOOST_AUTO_TEST_CASE(Counters)
+{
+  PintAccounting accounting;
+
+  // accounting consumers request names under their own prefixes, payload repeats seq
+  Name a = Name("/prefix/A").appendSequenceNumber(0);
+  Name b = Name("/prefix/B").appendSequenceNumber(0);
+  uint64_t faceId = 256;
+  for (const Name& name : {a, a, b}) {
+    Interest pint(name);
+    pint.setNonce(static_cast<uint32_t>(faceId));
+    pint.setIsPint(true);
+    pint.setPayload(std::vector<uint64_t>(4, 0));
+    pint.wireEncode();
+    accounting.Add(pint.getName(), PintPayloadView(pint), faceId++);
+  }
+
+  Interest pint(a);
+  pint.setNonce(3);
+  pint.setIsPint(true);
+  accounting.Add(pint.getName(), PintPayloadView(pint), 256);
+
+  BOOST_CHECK_EQUAL(accounting.GetNPints(), 4);
+  BOOST_CHECK_EQUAL(accounting.GetNEmpty(), 1);
+  BOOST_CHECK_EQUAL(accounting.GetNPintsForName(a), 3);
+  BOOST_CHECK_EQUAL(accounting.GetNPintsForName(b), 1);
+  BOOST_CHECK_EQUAL(accounting.GetNPintsForName("/prefix/C"), 0);
+  BOOST_CHECK_EQUAL(accounting.GetNPintsFromFace(256), 2);
+  BOOST_CHECK_EQUAL(accounting.GetNPintsFromFace(257), 1);
+  BOOST_CHECK_EQUAL(accounting.GetNameCounters().size(), 2);
+  BOOST_CHECK_EQUAL(accounting.GetFaceCounters().size(), 3);
+
+  // the first payload value is the sequence number, not a key
+  BOOST_CHECK(accounting.GetKeyCounters().empty());
+}
+
+BOOST_AUTO_TEST_CASE(PayloadKeyed)
+{
+  PintAccounting accounting;
+  accounting.SetPayloadKeyed(true);
+
+  // consumers with ConsumerIDInPayload put their IDs first
+  for (uint64_t key : {1, 1, 2}) {
+    Interest pint(Name("/prefix").appendSequenceNumber(0));
+    pint.setNonce(static_cast<uint32_t>(key));
+    pint.setIsPint(true);
+    pint.setPayload(std::vector<uint64_t>{key, 0, 0, 0});
+    pint.wireEncode();
+    accounting.Add(pint.getName(), PintPayloadView(pint), 256);
+  }
+
+  BOOST_CHECK_EQUAL(accounting.GetNPints(), 3);
+  BOOST_CHECK_EQUAL(accounting.GetNPintsForKey(1), 2);
+  BOOST_CHECK_EQUAL(accounting.GetNPintsForKey(2), 1);
+  BOOST_CHECK_EQUAL(accounting.GetNPintsForKey(3), 0);
+  BOOST_CHECK_EQUAL(accounting.GetKeyCounters().size(), 2);
+  BOOST_CHECK_EQUAL(accounting.GetNameCounters().size(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,96 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-reuse-distance-histogram.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(UtilsNdnReuseDistanceHistogram, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(ExactDistances)
+{
+  ReuseDistanceHistogram histogram;
+
+  // a b c a a b d a
+  for (uint64_t hash : {1, 2, 3, 1, 1, 2, 4, 1}) {
+    histogram.Access(hash);
+  }
+
+  // cold: a, b, c, d; distances: a=2, a=0, b=2 (c, a), a=2 (b, d)
+  BOOST_CHECK_EQUAL(histogram.GetNColdAccesses(), 4);
+  BOOST_CHECK_EQUAL(histogram.GetNTrackedNames(), 4);
+  BOOST_REQUIRE_EQUAL(histogram.GetBuckets().size(), 3);
+  BOOST_CHECK_EQUAL(histogram.GetBuckets()[0], 1);
+  BOOST_CHECK_EQUAL(histogram.GetBuckets()[1], 0);
+  BOOST_CHECK_EQUAL(histogram.GetBuckets()[2], 3);
+
+  BOOST_CHECK_EQUAL(ReuseDistanceHistogram::GetBucketLowerBound(0), 0);
+  BOOST_CHECK_EQUAL(ReuseDistanceHistogram::GetBucketLowerBound(1), 1);
+  BOOST_CHECK_EQUAL(ReuseDistanceHistogram::GetBucketLowerBound(3), 4);
+
+  histogram.Reset();
+  BOOST_CHECK_EQUAL(histogram.GetNColdAccesses(), 0);
+  BOOST_CHECK_EQUAL(histogram.GetBuckets().size(), 0);
+
+  histogram.Access(3); // b, a, d accessed since last access to c
+  BOOST_CHECK_EQUAL(histogram.GetNColdAccesses(), 0);
+  BOOST_REQUIRE_EQUAL(histogram.GetBuckets().size(), 3);
+  BOOST_CHECK_EQUAL(histogram.GetBuckets()[2], 1);
+}
+
+BOOST_AUTO_TEST_CASE(Compaction)
+{
+  ReuseDistanceHistogram histogram;
+
+  // cyclic access to 3000 names exhausts initial slots several times
+  const uint64_t nNames = 3000;
+  for (int round = 0; round < 3; ++round) {
+    for (uint64_t hash = 0; hash < nNames; ++hash) {
+      histogram.Access(hash);
+    }
+  }
+
+  BOOST_CHECK_EQUAL(histogram.GetNColdAccesses(), nNames);
+  BOOST_CHECK_EQUAL(histogram.GetNTrackedNames(), nNames);
+
+  // every repeated access has distance nNames - 1 = 2999, i.e., in bucket [2048, 4096)
+  BOOST_REQUIRE_EQUAL(histogram.GetBuckets().size(), 13);
+  BOOST_CHECK_EQUAL(histogram.GetBuckets()[12], 2 * nNames);
+}
+
+BOOST_AUTO_TEST_CASE(Names)
+{
+  ReuseDistanceHistogram histogram;
+
+  histogram.Access(Name("/prefix/1"));
+  histogram.Access(Name("/prefix/2"));
+  histogram.Access(Name("/prefix/1"));
+
+  BOOST_CHECK_EQUAL(histogram.GetNColdAccesses(), 2);
+  BOOST_REQUIRE_EQUAL(histogram.GetBuckets().size(), 2);
+  BOOST_CHECK_EQUAL(histogram.GetBuckets()[1], 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
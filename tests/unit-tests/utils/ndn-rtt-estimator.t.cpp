@@ -0,0 +1,86 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-rtt-estimator.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(UtilsNdnRttEstimator, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(HistoryBuffer)
+{
+  RttHistoryBuffer buffer(64);
+  BOOST_CHECK(buffer.IsEmpty());
+
+  for (uint32_t seq = 10; seq < 50; seq++) {
+    buffer.Insert(RttHistory(SequenceNumber32(seq), 1, Seconds(seq)));
+  }
+  BOOST_CHECK_EQUAL(buffer.GetSize(), 40);
+  BOOST_CHECK_EQUAL(buffer.Front().seq, SequenceNumber32(10));
+
+  BOOST_REQUIRE(buffer.Find(SequenceNumber32(20)) != 0);
+  BOOST_CHECK_EQUAL(buffer.Find(SequenceNumber32(20))->time, Seconds(20));
+  BOOST_CHECK(buffer.Find(SequenceNumber32(50)) == 0);
+
+  // out of order removal
+  buffer.Erase(SequenceNumber32(11));
+  buffer.Erase(SequenceNumber32(10));
+  BOOST_CHECK_EQUAL(buffer.Front().seq, SequenceNumber32(12));
+  BOOST_CHECK_EQUAL(buffer.GetSize(), 38);
+
+  // sparse sequence numbers take one entry each
+  for (uint32_t i = 1; i <= 26; i++) {
+    buffer.Insert(RttHistory(SequenceNumber32(i * 100000), 1, Seconds(i)));
+  }
+  BOOST_CHECK_EQUAL(buffer.GetSize(), 64);
+  BOOST_CHECK_EQUAL(buffer.Front().seq, SequenceNumber32(12));
+  BOOST_CHECK(buffer.Find(SequenceNumber32(2600000)) != 0);
+
+  // buffer is full: the oldest entry is dropped
+  buffer.Insert(RttHistory(SequenceNumber32(7), 1, Seconds(7)));
+  BOOST_CHECK_EQUAL(buffer.GetSize(), 64);
+  BOOST_CHECK_EQUAL(buffer.Front().seq, SequenceNumber32(13));
+  BOOST_CHECK(buffer.Find(SequenceNumber32(12)) == 0);
+  BOOST_CHECK(buffer.Find(SequenceNumber32(7)) != 0);
+
+  // entries erased out of order, re-inserted entry keeps its age
+  for (uint32_t seq = 14; seq < 50; seq++) {
+    buffer.Erase(SequenceNumber32(seq));
+  }
+  buffer.Insert(RttHistory(SequenceNumber32(13), 1, Seconds(113)));
+  BOOST_CHECK_EQUAL(buffer.GetSize(), 28);
+  BOOST_CHECK_EQUAL(buffer.Front().time, Seconds(113));
+  buffer.PopFront();
+  BOOST_CHECK_EQUAL(buffer.Front().seq, SequenceNumber32(100000));
+
+  BOOST_REQUIRE(buffer.FindContaining(SequenceNumber32(7)) != 0);
+  BOOST_CHECK(buffer.FindContaining(SequenceNumber32(8)) == 0);
+
+  buffer.Clear();
+  BOOST_CHECK(buffer.IsEmpty());
+  BOOST_CHECK(buffer.Find(SequenceNumber32(7)) == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
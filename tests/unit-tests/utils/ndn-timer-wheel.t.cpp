@@ -0,0 +1,99 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-timer-wheel.hpp"
+
+#include "ns3/node.h"
+#include "ns3/simulator.h"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(UtilsNdnTimerWheel, CleanupFixture)
+
+static std::vector<Time> firedTimes;
+
+static void
+RecordTime()
+{
+  firedTimes.push_back(Simulator::Now());
+}
+
+BOOST_AUTO_TEST_CASE(ScheduleAndCancel)
+{
+  firedTimes.clear();
+
+  Ptr<Node> node = CreateObject<Node>();
+  Ptr<TimerWheel> wheel = TimerWheel::GetTimerWheel(node);
+  BOOST_CHECK_EQUAL(wheel, TimerWheel::GetTimerWheel(node));
+
+  wheel->Schedule(MilliSeconds(50), MakeCallback(&RecordTime));
+  wheel->Schedule(Seconds(2), MakeCallback(&RecordTime)); // more than one rotation ahead
+  TimerWheel::TimerId cancelled = wheel->Schedule(MilliSeconds(20), MakeCallback(&RecordTime));
+  wheel->Schedule(MicroSeconds(10500), MakeCallback(&RecordTime)); // rounded up to 11ms
+  BOOST_CHECK_EQUAL(wheel->GetNPending(), 4);
+
+  wheel->Cancel(cancelled);
+  BOOST_CHECK_EQUAL(wheel->GetNPending(), 3);
+
+  Simulator::Run();
+
+  BOOST_REQUIRE_EQUAL(firedTimes.size(), 3);
+  BOOST_CHECK_EQUAL(firedTimes[0], MilliSeconds(11));
+  BOOST_CHECK_EQUAL(firedTimes[1], MilliSeconds(50));
+  BOOST_CHECK_EQUAL(firedTimes[2], Seconds(2));
+  BOOST_CHECK_EQUAL(wheel->GetNPending(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(CancelThenTick)
+{
+  firedTimes.clear();
+
+  Ptr<Node> node = CreateObject<Node>();
+  Ptr<TimerWheel> wheel = TimerWheel::GetTimerWheel(node);
+
+  // cancelling the only timer leaves no simulator event
+  wheel->Cancel(wheel->Schedule(MilliSeconds(10), MakeCallback(&RecordTime)));
+  BOOST_CHECK_EQUAL(wheel->GetNPending(), 0);
+  BOOST_CHECK(Simulator::IsFinished());
+
+  // timer in the same slot one rotation later (256 ticks) is not fired by the cancelled one
+  TimerWheel::TimerId cancelled = wheel->Schedule(MilliSeconds(20), MakeCallback(&RecordTime));
+  wheel->Schedule(MilliSeconds(276), MakeCallback(&RecordTime));
+  wheel->Cancel(cancelled);
+  wheel->Cancel(cancelled); // no-op
+  BOOST_CHECK_EQUAL(wheel->GetNPending(), 1);
+
+  Simulator::Stop(MilliSeconds(100));
+  Simulator::Run();
+  BOOST_CHECK_EQUAL(firedTimes.size(), 0);
+
+  Simulator::Run();
+  BOOST_REQUIRE_EQUAL(firedTimes.size(), 1);
+  BOOST_CHECK_EQUAL(firedTimes[0], MilliSeconds(276));
+  BOOST_CHECK_EQUAL(wheel->GetNPending(), 0);
+  BOOST_CHECK(Simulator::IsFinished());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
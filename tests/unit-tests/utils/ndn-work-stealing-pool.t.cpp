@@ -0,0 +1,78 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+#include "utils/ndn-work-stealing-pool.hpp"
+
+#include "../tests-common.hpp"
+
+#include <atomic>
+#include <stdexcept>
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(UtilsNdnWorkStealingPool, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(RunEachJobOnce)
+{
+  for (size_t nThreads : {1, 2, 4, 16}) {
+    std::vector<uint64_t> results(100, 0);
+    std::vector<WorkStealingPool::Job> jobs;
+    for (size_t i = 0; i < results.size(); ++i) {
+      jobs.push_back([&results, i] {
+        // uneven amount of work, so that workers steal from each other
+        for (size_t j = 0; j < (i % 7) * 1000; ++j) {
+          results[i] += j;
+        }
+        results[i] += i + 1;
+      });
+    }
+
+    WorkStealingPool pool(nThreads);
+    BOOST_CHECK_EQUAL(pool.GetNThreads(), nThreads);
+    pool.Run(jobs);
+
+    for (size_t i = 0; i < results.size(); ++i) {
+      uint64_t n = (i % 7) * 1000;
+      BOOST_CHECK_EQUAL(results[i], (n > 0 ? n * (n - 1) / 2 : 0) + i + 1);
+    }
+  }
+
+  BOOST_CHECK_NO_THROW(WorkStealingPool(4).Run({}));
+}
+
+BOOST_AUTO_TEST_CASE(RethrowException)
+{
+  std::atomic<size_t> nRun(0);
+  std::vector<WorkStealingPool::Job> jobs;
+  for (size_t i = 0; i < 10; ++i) {
+    jobs.push_back([&nRun, i] {
+      ++nRun;
+      if (i == 5)
+        throw std::runtime_error("job failed");
+    });
+  }
+
+  BOOST_CHECK_THROW(WorkStealingPool(3).Run(jobs), std::runtime_error);
+  BOOST_CHECK_EQUAL(nRun.load(), 10);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,251 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/topology/annotated-topology-reader.hpp"
+#include "helper/ndn-stack-helper.hpp"
+#include "helper/ndn-global-routing-helper.hpp"
+#include "model/ndn-l3-protocol.hpp"
+
+#include "daemon/fw/forwarder.hpp"
+#include "daemon/table/fib.hpp"
+
+#include "ns3/names.h"
+
+#include <fstream>
+#include <iterator>
+#include <cstdio>
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class SnapshotFixture : public CleanupFixture
+{
+public:
+  SnapshotFixture()
+    : topologyFile("annotated-topology-reader-test.txt")
+    , snapshotFile("annotated-topology-reader-test.snapshot")
+  {
+    WriteTopology("10");
+  }
+
+  ~SnapshotFixture()
+  {
+    std::remove(topologyFile.c_str());
+    std::remove(snapshotFile.c_str());
+  }
+
+  void
+  WriteTopology(const std::string& metricAB)
+  {
+    std::ofstream os(topologyFile.c_str());
+    os << "router\n\n"
+       << "A  NA  1 1\n"
+       << "B  NA  1 2\n"
+       << "C  NA  2 1\n"
+       << "D  NA  2 2\n\n"
+       << "link\n\n"
+       << "A  B  10Mbps  " << metricAB << "  1ms  100\n"
+       << "A  C  10Mbps  20  1ms  100\n"
+       << "B  D  10Mbps  10  1ms  100\n"
+       << "C  D  10Mbps  10  1ms  100\n";
+  }
+
+  /// read topology, install stack and global routing, and add origin
+  void
+  Setup(AnnotatedTopologyReader& reader, const std::string& file,
+        const std::string& origin = "D")
+  {
+    reader.SetFileName(file);
+    reader.Read();
+
+    StackHelper ndnHelper;
+    ndnHelper.InstallAll();
+    GlobalRoutingHelper routingHelper;
+    routingHelper.InstallAll();
+    routingHelper.AddOrigin("/prefix", origin);
+  }
+
+  /// start a new simulation, as if in another run
+  void
+  Restart()
+  {
+    Simulator::Destroy();
+    Names::Clear();
+    GlobalRouter::clear();
+  }
+
+  /// next hops of /prefix on node: (cost of each next hop)
+  std::vector<uint64_t>
+  GetCosts(const std::string& node)
+  {
+    std::vector<uint64_t> costs;
+    shared_ptr<nfd::fib::Entry> entry = Names::Find<Node>(node)->GetObject<L3Protocol>()
+      ->getForwarder()->getFib().findExactMatch("/prefix");
+    if (entry != nullptr) {
+      for (const nfd::fib::NextHop& nexthop : entry->getNextHops()) {
+        costs.push_back(nexthop.getCost());
+      }
+    }
+    return costs;
+  }
+
+public:
+  std::string topologyFile;
+  std::string snapshotFile;
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTopologyAnnotatedTopologyReader, SnapshotFixture)
+
+BOOST_AUTO_TEST_CASE(SnapshotRoundTrip)
+{
+  std::vector<uint64_t> costs;
+  uint64_t topologyChecksum = 0;
+  uint64_t routingChecksum = 0;
+  {
+    AnnotatedTopologyReader reader("");
+    Setup(reader, topologyFile);
+    GlobalRoutingHelper::CalculateRoutes();
+    costs = GetCosts("A");
+    topologyChecksum = reader.GetTopologyChecksum();
+    routingChecksum = reader.GetRoutingChecksum("CalculateRoutes");
+    reader.SaveTopologySnapshot(snapshotFile, "CalculateRoutes");
+  }
+  BOOST_REQUIRE_EQUAL(costs.size(), 1);
+  BOOST_CHECK_EQUAL(costs[0], 20);
+
+  Restart();
+
+  // the snapshot replaces the text file, routes are loaded instead of calculated
+  AnnotatedTopologyReader reader("");
+  Setup(reader, snapshotFile);
+  BOOST_CHECK_EQUAL(reader.GetNodes().GetN(), 4);
+  BOOST_CHECK_EQUAL(reader.LinksSize(), 4);
+  BOOST_CHECK(Names::Find<Node>("C") != 0);
+  BOOST_CHECK_EQUAL(reader.GetTopologyChecksum(), topologyChecksum);
+  BOOST_CHECK_EQUAL(reader.GetRoutingChecksum("CalculateRoutes"), routingChecksum);
+  BOOST_CHECK_EQUAL(GetCosts("A").size(), 0);
+
+  BOOST_REQUIRE(reader.LoadRoutes(snapshotFile, "CalculateRoutes"));
+  BOOST_CHECK(GetCosts("A") == costs);
+}
+
+BOOST_AUTO_TEST_CASE(ChecksumMismatch)
+{
+  {
+    AnnotatedTopologyReader reader("");
+    Setup(reader, topologyFile);
+    GlobalRoutingHelper::CalculateRoutes();
+    reader.SaveTopologySnapshot(snapshotFile, "CalculateRoutes");
+
+    // the same topology, but different route parameters
+    BOOST_CHECK_NE(reader.GetRoutingChecksum("CalculateRoutes"),
+                   reader.GetRoutingChecksum("CalculateMultipathRoutes(2)"));
+  }
+
+  Restart();
+  {
+    // different origin
+    AnnotatedTopologyReader reader("");
+    Setup(reader, topologyFile, "C");
+    BOOST_CHECK(!reader.LoadRoutes(snapshotFile, "CalculateRoutes"));
+    BOOST_CHECK(!reader.LoadRoutes(snapshotFile, "CalculateMultipathRoutes(2)"));
+    BOOST_CHECK_EQUAL(GetCosts("A").size(), 0);
+  }
+
+  Restart();
+  {
+    // different link metric
+    WriteTopology("30");
+    AnnotatedTopologyReader reader("");
+    Setup(reader, topologyFile);
+    BOOST_CHECK(!reader.LoadRoutes(snapshotFile, "CalculateRoutes"));
+    BOOST_CHECK_EQUAL(GetCosts("A").size(), 0);
+  }
+
+  Restart();
+  {
+    // the same topology, origins, and parameters
+    WriteTopology("10");
+    AnnotatedTopologyReader reader("");
+    Setup(reader, topologyFile);
+    BOOST_CHECK(!reader.LoadRoutes(snapshotFile, "CalculateMultipathRoutes(2)"));
+    BOOST_CHECK(reader.LoadRoutes(snapshotFile, "CalculateRoutes"));
+    BOOST_CHECK_EQUAL(GetCosts("A").size(), 1);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TruncatedAndCorrupted)
+{
+  std::string contents;
+  {
+    AnnotatedTopologyReader reader("");
+    Setup(reader, topologyFile);
+    GlobalRoutingHelper::CalculateRoutes();
+    reader.SaveTopologySnapshot(snapshotFile);
+
+    std::ifstream is(snapshotFile.c_str(), std::ios::binary);
+    contents.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+    BOOST_REQUIRE(reader.LoadRoutes(snapshotFile));
+  }
+  BOOST_REQUIRE_GT(contents.size(), 32);
+
+  Restart();
+  AnnotatedTopologyReader reader("");
+  Setup(reader, topologyFile);
+
+  // every truncation is detected
+  for (size_t size = 0; size < contents.size(); size += 7) {
+    std::ofstream(snapshotFile.c_str(), std::ios::binary | std::ios::trunc)
+      .write(contents.data(), size);
+    BOOST_CHECK(!reader.LoadRoutes(snapshotFile));
+  }
+  BOOST_CHECK_EQUAL(GetCosts("A").size(), 0);
+
+  // wrong magic
+  std::string corrupted = contents;
+  corrupted[0] = 'X';
+  std::ofstream(snapshotFile.c_str(), std::ios::binary | std::ios::trunc)
+    .write(corrupted.data(), corrupted.size());
+  BOOST_CHECK(!reader.LoadRoutes(snapshotFile));
+
+  // wrong checksum: magic (8 bytes), version (4 bytes), topology checksum (8 bytes)
+  corrupted = contents;
+  corrupted[12] ^= 0x01;
+  std::ofstream(snapshotFile.c_str(), std::ios::binary | std::ios::trunc)
+    .write(corrupted.data(), corrupted.size());
+  BOOST_CHECK(!reader.LoadRoutes(snapshotFile));
+
+  // huge string length of the first node name, right after the checksums and node count
+  corrupted = contents;
+  for (size_t i = 32; i < 36; i++) {
+    corrupted[i] = '\xff';
+  }
+  std::ofstream(snapshotFile.c_str(), std::ios::binary | std::ios::trunc)
+    .write(corrupted.data(), corrupted.size());
+  BOOST_CHECK(!reader.LoadRoutes(snapshotFile));
+
+  BOOST_CHECK_EQUAL(GetCosts("A").size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
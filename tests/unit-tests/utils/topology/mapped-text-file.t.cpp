@@ -0,0 +1,90 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/topology/mapped-text-file.hpp"
+
+#include <fstream>
+#include <cstdio>
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTopologyMappedTextFile, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(LinesAndTokens)
+{
+  const char* fileName = "mapped-text-file-test.txt";
+  {
+    std::ofstream os(fileName);
+    os << "router\r\n"
+       << " Node0\tNA  1.5 -2 7\n"
+       << "\n"
+       << "link";
+  }
+
+  MappedTextFile file(fileName);
+  BOOST_REQUIRE(file.IsOpen());
+
+  MappedTextFile::Token line;
+  std::vector<MappedTextFile::Token> tokens;
+
+  BOOST_REQUIRE(file.NextLine(line));
+  BOOST_CHECK(line == "router");
+
+  BOOST_REQUIRE(file.NextLine(line));
+  BOOST_REQUIRE_EQUAL(MappedTextFile::Split(line, tokens), 5);
+  BOOST_CHECK_EQUAL(tokens[0].ToString(), "Node0");
+  BOOST_CHECK_EQUAL(tokens[1].ToString(), "NA");
+
+  double latitude = 0, longitude = 0;
+  uint32_t systemId = 0;
+  BOOST_CHECK(MappedTextFile::Parse(tokens[2], latitude));
+  BOOST_CHECK(MappedTextFile::Parse(tokens[3], longitude));
+  BOOST_CHECK(!MappedTextFile::Parse(tokens[3], systemId));
+  BOOST_CHECK(MappedTextFile::Parse(tokens[4], systemId));
+  BOOST_CHECK_EQUAL(latitude, 1.5);
+  BOOST_CHECK_EQUAL(longitude, -2);
+  BOOST_CHECK_EQUAL(systemId, 7);
+
+  BOOST_REQUIRE(file.NextLine(line));
+  BOOST_CHECK(line.empty());
+  BOOST_CHECK_EQUAL(MappedTextFile::Split(line, tokens), 0);
+
+  BOOST_REQUIRE(file.NextLine(line));
+  BOOST_CHECK(line == "link");
+  BOOST_CHECK(!file.NextLine(line));
+
+  std::remove(fileName);
+}
+
+BOOST_AUTO_TEST_CASE(MissingFile)
+{
+  MappedTextFile file("mapped-text-file-does-not-exist.txt");
+  BOOST_CHECK(!file.IsOpen());
+
+  MappedTextFile::Token line;
+  BOOST_CHECK(!file.NextLine(line));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,72 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/topology/topology-partitioner.hpp"
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTopologyTopologyPartitioner, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(TwoClusters)
+{
+  // two rings of 5 nodes with 1ms links, connected by two 10ms links
+  TopologyPartitioner partitioner(2);
+  for (int i = 0; i < 10; i++) {
+    partitioner.AddNode();
+  }
+  for (int cluster = 0; cluster < 2; cluster++) {
+    for (int i = 0; i < 5; i++) {
+      partitioner.AddLink(cluster * 5 + i, cluster * 5 + (i + 1) % 5, MilliSeconds(1));
+    }
+  }
+  partitioner.AddLink(0, 5, MilliSeconds(10));
+  partitioner.AddLink(2, 7, MilliSeconds(10));
+
+  std::vector<uint32_t> partitions = partitioner.Partition();
+  BOOST_REQUIRE_EQUAL(partitions.size(), 10);
+  for (int i = 1; i < 5; i++) {
+    BOOST_CHECK_EQUAL(partitions[i], partitions[0]);
+    BOOST_CHECK_EQUAL(partitions[5 + i], partitions[5]);
+  }
+  BOOST_CHECK_NE(partitions[0], partitions[5]);
+
+  BOOST_CHECK_EQUAL(partitioner.GetCutSize(), 2);
+  BOOST_CHECK_EQUAL(partitioner.GetLookahead(), MilliSeconds(10));
+}
+
+BOOST_AUTO_TEST_CASE(SinglePartition)
+{
+  TopologyPartitioner partitioner(1);
+  partitioner.AddNode();
+  partitioner.AddNode();
+  partitioner.AddLink(0, 1, MilliSeconds(1));
+
+  std::vector<uint32_t> partitions = partitioner.Partition();
+  BOOST_CHECK_EQUAL(partitions[0], 0);
+  BOOST_CHECK_EQUAL(partitions[1], 0);
+  BOOST_CHECK_EQUAL(partitioner.GetCutSize(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -40,6 +40,15 @@ public:
   FwHopCountTag()
     : m_hopCount(0){};
 
+  /**
+   * @brief Constructor with initial hop count
+   */
+  explicit
+  FwHopCountTag(uint32_t hopCount)
+    : m_hopCount(hopCount)
+  {
+  }
+
   /**
    * @brief Destructor
    */
@@ -0,0 +1,221 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-interest-factory.hpp"
+
+#include <ndn-cxx/encoding/block.hpp>
+#include <ndn-cxx/encoding/buffer.hpp>
+
+#include <cstring>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @brief Number of bytes in NonNegativeInteger encoding of value
+ */
+static inline size_t
+nonNegativeIntegerWidth(uint64_t value)
+{
+  if (value <= 0xFF)
+    return 1;
+  else if (value <= 0xFFFF)
+    return 2;
+  else if (value <= 0xFFFFFFFF)
+    return 4;
+  else
+    return 8;
+}
+
+/**
+ * @brief Write value as big-endian number of width bytes ending at end
+ */
+static inline void
+writeBigEndian(uint8_t* end, size_t width, uint64_t value)
+{
+  for (size_t i = 1; i <= width; ++i) {
+    *(end - i) = static_cast<uint8_t>(value >> (8 * (i - 1)));
+  }
+}
+
+const size_t InterestFactory::PINT_PAYLOAD_SEQS;
+
+InterestFactory::InterestFactory(size_t nPayloadSeqs)
+  : m_nPayloadSeqs(nPayloadSeqs)
+  , m_hasPayloadKey(false)
+  , m_payloadKey(0)
+  , m_hasLifetime(false)
+  , m_lifetime(0)
+  , m_isValid(false)
+  , m_seq(0)
+  , m_seqWidth(0)
+  , m_canPatchSeq(false)
+  , m_seqEnd(0)
+  , m_nonceOffset(0)
+  , m_nTemplateBuilds(0)
+{
+}
+
+void
+InterestFactory::SetInterestLifetime(const time::milliseconds& lifetime)
+{
+  if (m_hasLifetime && m_lifetime == lifetime)
+    return;
+
+  m_hasLifetime = true;
+  m_lifetime = lifetime;
+  m_isValid = false;
+}
+
+void
+InterestFactory::SetPayloadKey(uint64_t key)
+{
+  if (m_hasPayloadKey && m_payloadKey == key)
+    return;
+
+  // patched in place by Create, unless its width changes
+  m_hasPayloadKey = true;
+  m_payloadKey = key;
+}
+
+size_t
+InterestFactory::GetNTemplateBuilds() const
+{
+  return m_nTemplateBuilds;
+}
+
+uint64_t
+InterestFactory::GetPayloadValue(size_t i, uint32_t seq) const
+{
+  return (i == 0 && m_hasPayloadKey) ? m_payloadKey : seq;
+}
+
+bool
+InterestFactory::CanPatchPayload(uint32_t seq) const
+{
+  if (m_payloadValues.size() != m_nPayloadSeqs)
+    return false;
+
+  for (size_t i = 0; i < m_payloadValues.size(); ++i) {
+    if (nonNegativeIntegerWidth(GetPayloadValue(i, seq)) != m_payloadValues[i].second)
+      return false;
+  }
+  return true;
+}
+
+shared_ptr<Interest>
+InterestFactory::Create(const Name& prefix, uint32_t seq, uint32_t nonce)
+{
+  bool needRebuild = !m_isValid || prefix != m_prefix || !CanPatchPayload(seq);
+  if (!needRebuild && seq != m_seq) {
+    needRebuild = !m_canPatchSeq || nonNegativeIntegerWidth(seq) != m_seqWidth;
+  }
+  if (needRebuild) {
+    BuildTemplate(prefix, seq);
+  }
+
+  auto buffer = make_shared< ::ndn::Buffer>(m_wire.begin(), m_wire.end());
+
+  if (seq != m_seq) {
+    // NonNegativeInteger is big-endian and occupies the tail of the component value
+    writeBigEndian(buffer->data() + m_seqEnd, m_seqWidth, seq);
+  }
+
+  for (size_t i = 0; i < m_payloadValues.size(); ++i) {
+    const std::pair<size_t, size_t>& value = m_payloadValues[i];
+    writeBigEndian(buffer->data() + value.first + value.second, value.second,
+                   GetPayloadValue(i, seq));
+  }
+
+  // same (host) byte order as Interest::setNonce
+  std::memcpy(buffer->data() + m_nonceOffset, &nonce, sizeof(nonce));
+
+  return make_shared<Interest>(Block(buffer));
+}
+
+void
+InterestFactory::BuildTemplate(const Name& prefix, uint32_t seq)
+{
+  Interest interest;
+  interest.setName(Name(prefix).appendSequenceNumber(seq));
+  interest.setNonce(0);
+  if (m_hasLifetime) {
+    interest.setInterestLifetime(m_lifetime);
+  }
+  std::vector<uint64_t> payload;
+  for (size_t i = 0; i < m_nPayloadSeqs; ++i) {
+    payload.push_back(GetPayloadValue(i, seq));
+  }
+  if (!payload.empty()) {
+    interest.setPayload(payload);
+  }
+
+  Block wire = interest.wireEncode();
+  m_wire.assign(wire.begin(), wire.end());
+
+  wire.parse();
+  Block name = *wire.find(::ndn::tlv::Name);
+  name.parse();
+  const Block& component = name.elements().back();
+  m_seqEnd = component.value_end() - wire.begin();
+
+  Block::element_const_iterator nonce = wire.find(::ndn::tlv::Nonce);
+  BOOST_ASSERT(nonce != wire.elements_end() && nonce->value_size() == sizeof(uint32_t));
+  m_nonceOffset = nonce->value_begin() - wire.begin();
+
+  // make sure the component ends with the big-endian sequence number before patching it later
+  m_seqWidth = nonNegativeIntegerWidth(seq);
+  m_canPatchSeq = component.value_size() >= m_seqWidth;
+  for (size_t i = 1; m_canPatchSeq && i <= m_seqWidth; ++i) {
+    m_canPatchSeq = m_wire[m_seqEnd - i] == static_cast<uint8_t>(seq >> (8 * (i - 1)));
+  }
+
+  // PINT payload: one NonNegativeInteger element per value (see PintPayloadView)
+  m_payloadValues.clear();
+  Block::element_const_iterator payloadElement = wire.find(::ndn::tlv::Payload);
+  if (!payload.empty() && payloadElement != wire.elements_end()) {
+    Block payloadBlock = *payloadElement;
+    payloadBlock.parse();
+    for (const Block& value : payloadBlock.elements()) {
+      size_t offset = value.value_begin() - wire.begin();
+      m_payloadValues.push_back(std::make_pair(offset, value.value_size()));
+    }
+
+    // patch only if the values are encoded as expected
+    bool canPatch = m_payloadValues.size() == payload.size();
+    for (size_t i = 0; canPatch && i < payload.size(); ++i) {
+      canPatch = m_payloadValues[i].second == nonNegativeIntegerWidth(payload[i]);
+      for (size_t j = 1; canPatch && j <= m_payloadValues[i].second; ++j) {
+        size_t end = m_payloadValues[i].first + m_payloadValues[i].second;
+        canPatch = m_wire[end - j] == static_cast<uint8_t>(payload[i] >> (8 * (j - 1)));
+      }
+    }
+    if (!canPatch) {
+      m_payloadValues.clear();
+    }
+  }
+
+  m_prefix = prefix;
+  m_seq = seq;
+  m_isValid = true;
+  ++m_nTemplateBuilds;
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,129 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_INTEREST_FACTORY_HPP
+#define NDN_INTEREST_FACTORY_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-apps
+ * @brief Factory of Interests of the form /<prefix>/<seq> built from an encoded template
+ *
+ * The factory keeps the wire encoding of an Interest for the current prefix, lifetime, and
+ * widths of the encoded numbers.  A new Interest is a copy of the template with the sequence
+ * number, the PINT payload values, and the nonce patched in place, decoded from that buffer, so
+ * its wire encoding does not need to be built again when it is sent out.  The template is rebuilt
+ * only when prefix or lifetime change, or when the number of bytes needed to encode the sequence
+ * number or a payload value (NonNegativeInteger) changes.
+ *
+ * Every call returns a new Interest object, as the forwarder keeps references to Interests
+ * (e.g., in PIT in-records) after they are sent.
+ */
+class InterestFactory {
+public:
+  /**
+   * @brief Number of values in PINT payload of accounting consumers
+   */
+  static const size_t PINT_PAYLOAD_SEQS = 4;
+
+  /**
+   * @param nPayloadSeqs number of values in the PINT accounting payload (0 means no payload).
+   *                     Values are copies of the sequence number, except the first one when
+   *                     the payload key is set
+   */
+  explicit
+  InterestFactory(size_t nPayloadSeqs = 0);
+
+  /**
+   * @brief Set the first value of PINT accounting payload (e.g., consumer ID)
+   *
+   * Not set by default, so all values are copies of the sequence number.  Setting a key changes
+   * the size of PINTs; it is used by accounting consumers with ConsumerIDInPayload attribute,
+   * whose producers then count PINTs per key (see PintAccounting::SetPayloadKeyed)
+   */
+  void
+  SetPayloadKey(uint64_t key);
+
+  /**
+   * @brief Set InterestLifetime of created Interests (unset by default)
+   */
+  void
+  SetInterestLifetime(const time::milliseconds& lifetime);
+
+  /**
+   * @brief Create Interest for prefix/seq with the specified nonce
+   */
+  shared_ptr<Interest>
+  Create(const Name& prefix, uint32_t seq, uint32_t nonce);
+
+  /**
+   * @brief Get number of times the template has been (re)built
+   */
+  size_t
+  GetNTemplateBuilds() const;
+
+private:
+  /**
+   * @brief Get i-th value of PINT payload for the sequence number
+   */
+  uint64_t
+  GetPayloadValue(size_t i, uint32_t seq) const;
+
+  /**
+   * @brief Check whether payload values for the sequence number have the widths of the template
+   */
+  bool
+  CanPatchPayload(uint32_t seq) const;
+
+  void
+  BuildTemplate(const Name& prefix, uint32_t seq);
+
+private:
+  size_t m_nPayloadSeqs;
+  bool m_hasPayloadKey;
+  uint64_t m_payloadKey;
+  bool m_hasLifetime;
+  time::milliseconds m_lifetime;
+
+  bool m_isValid;
+  Name m_prefix;
+  uint32_t m_seq;               ///< @brief sequence number encoded in the template
+  size_t m_seqWidth;            ///< @brief bytes of the sequence number in the last component
+  bool m_canPatchSeq;           ///< @brief whether sequence number can be patched in place
+  size_t m_seqEnd;              ///< @brief offset of the end of the last component value
+  size_t m_nonceOffset;         ///< @brief offset of Nonce value
+  std::vector<uint8_t> m_wire;  ///< @brief encoded template Interest
+
+  /**
+   * @brief (offset, width) of every NonNegativeInteger value in the Payload element, empty if
+   *        payload values cannot be patched in place
+   */
+  std::vector<std::pair<size_t, size_t>> m_payloadValues;
+
+  size_t m_nTemplateBuilds;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_INTEREST_FACTORY_HPP
@@ -0,0 +1,196 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-memory-accounting.hpp"
+
+#include "model/ndn-l3-protocol.hpp"
+#include "model/cs/ndn-content-store.hpp"
+#include "apps/ndn-app.hpp"
+#include "utils/ndn-name-interner.hpp"
+#include "utils/tracers/ndn-l3-rate-tracer.hpp"
+#include "utils/tracers/ndn-cs-tracer.hpp"
+#include "utils/tracers/ndn-app-delay-tracer.hpp"
+#include "utils/tracers/ndn-mem-tracer.hpp"
+#include "utils/tracers/l2-rate-tracer.hpp"
+
+#include "daemon/fw/forwarder.hpp"
+#include "daemon/table/name-tree.hpp"
+#include "daemon/table/fib.hpp"
+#include "daemon/table/pit.hpp"
+#include "daemon/table/cs.hpp"
+#include "daemon/table/cs-skip-list-entry.hpp"
+#include "daemon/table/measurements.hpp"
+#include "daemon/table/strategy-choice.hpp"
+#include "daemon/table/dead-nonce-list.hpp"
+
+#include "ns3/node.h"
+#include "ns3/application.h"
+
+namespace ns3 {
+namespace ndn {
+
+const size_t MemoryAccounting::CONTAINER_NODE_OVERHEAD;
+
+size_t
+MemoryAccounting::EstimateNameSize(const Name& name)
+{
+  size_t size = sizeof(Name);
+  for (const name::Component& component : name) {
+    size += sizeof(name::Component) + component.size();
+  }
+  return size;
+}
+
+TableMemoryUsage
+MemoryAccounting::Estimate(const nfd::NameTree& nameTree)
+{
+  TableMemoryUsage usage(nameTree.size(), nameTree.getNBuckets() * sizeof(void*));
+  for (const nfd::name_tree::Entry& entry : nameTree) {
+    usage.nBytes += sizeof(nfd::name_tree::Entry) + CONTAINER_NODE_OVERHEAD
+                    + EstimateNameSize(entry.getPrefix());
+  }
+  return usage;
+}
+
+TableMemoryUsage
+MemoryAccounting::Estimate(const nfd::Fib& fib)
+{
+  // prefixes are shared with NameTree entries
+  TableMemoryUsage usage(fib.size(), 0);
+  for (const nfd::fib::Entry& entry : fib) {
+    usage.nBytes += sizeof(nfd::fib::Entry)
+                    + entry.getNextHops().capacity() * sizeof(nfd::fib::NextHop);
+  }
+  return usage;
+}
+
+TableMemoryUsage
+MemoryAccounting::Estimate(const nfd::Pit& pit)
+{
+  TableMemoryUsage usage(pit.size(), 0);
+  for (const nfd::pit::Entry& entry : pit) {
+    usage.nBytes += sizeof(nfd::pit::Entry)
+                    + sizeof(Interest) + entry.getInterest().wireEncode().size()
+                    + entry.getInRecords().size()
+                        * (sizeof(nfd::pit::InRecord) + CONTAINER_NODE_OVERHEAD)
+                    + entry.getOutRecords().size()
+                        * (sizeof(nfd::pit::OutRecord) + CONTAINER_NODE_OVERHEAD);
+  }
+  return usage;
+}
+
+TableMemoryUsage
+MemoryAccounting::Estimate(const nfd::Cs& cs)
+{
+  // entries are preallocated up to the limit; skip list keeps ~2 list nodes per entry
+  TableMemoryUsage usage(cs.size(), cs.getLimit() * sizeof(nfd::cs::skip_list::Entry));
+  for (const nfd::cs::Entry& entry : cs) {
+    usage.nBytes += 2 * CONTAINER_NODE_OVERHEAD + sizeof(Data) + entry.getData().wireEncode().size();
+  }
+  return usage;
+}
+
+TableMemoryUsage
+MemoryAccounting::Estimate(const nfd::Measurements& measurements)
+{
+  return TableMemoryUsage(measurements.size(),
+                          measurements.size() * sizeof(nfd::measurements::Entry));
+}
+
+TableMemoryUsage
+MemoryAccounting::Estimate(const nfd::StrategyChoice& strategyChoice)
+{
+  return TableMemoryUsage(strategyChoice.size(),
+                          strategyChoice.size() * sizeof(nfd::strategy_choice::Entry));
+}
+
+TableMemoryUsage
+MemoryAccounting::Estimate(const nfd::DeadNonceList& deadNonceList)
+{
+  // each entry is linked in sequenced and hashed indices
+  return TableMemoryUsage(deadNonceList.size(),
+                          deadNonceList.size() * (sizeof(uint64_t) + 4 * sizeof(void*)));
+}
+
+TableMemoryUsage
+MemoryAccounting::Estimate(Ptr<ContentStore> contentStore)
+{
+  TableMemoryUsage usage(contentStore->GetSize(), 0);
+  for (Ptr<cs::Entry> entry = contentStore->Begin(); entry != contentStore->End();
+       entry = contentStore->Next(entry)) {
+    usage.nBytes += sizeof(cs::Entry) + CONTAINER_NODE_OVERHEAD + sizeof(Data)
+                    + entry->GetData()->wireEncode().size();
+  }
+  return usage;
+}
+
+MemoryAccounting::Report
+MemoryAccounting::Collect(Ptr<Node> node)
+{
+  Report report;
+
+  Ptr<L3Protocol> l3 = node->GetObject<L3Protocol>();
+  if (l3 != nullptr) {
+    nfd::Forwarder& forwarder = *l3->getForwarder();
+
+    report["NameTree"] = Estimate(forwarder.getNameTree());
+    report["Fib"] = Estimate(forwarder.getFib());
+    report["Pit"] = Estimate(forwarder.getPit());
+    report["Cs"] = Estimate(forwarder.getCs());
+    report["Measurements"] = Estimate(forwarder.getMeasurements());
+    report["StrategyChoice"] = Estimate(forwarder.getStrategyChoice());
+    report["DeadNonceList"] = Estimate(forwarder.getDeadNonceList());
+  }
+
+  Ptr<ContentStore> contentStore = node->GetObject<ContentStore>();
+  if (contentStore != nullptr) {
+    report["NdnSimCs"] = Estimate(contentStore);
+  }
+
+  TableMemoryUsage& apps = report["App"];
+  for (uint32_t i = 0; i < node->GetNApplications(); ++i) {
+    Ptr<App> app = DynamicCast<App>(node->GetApplication(i));
+    if (app != nullptr) {
+      apps += app->GetMemoryUsage();
+    }
+  }
+
+  return report;
+}
+
+MemoryAccounting::Report
+MemoryAccounting::CollectGlobal()
+{
+  Report report;
+
+  const NameComponentPool& pool = NameComponentPool::getInstance();
+  report["NameComponentPool"] = TableMemoryUsage(pool.size(), pool.getMemoryUsage());
+
+  TableMemoryUsage& tracers = report["Tracers"];
+  tracers += L3RateTracer::GetMemoryUsage();
+  tracers += CsTracer::GetMemoryUsage();
+  tracers += AppDelayTracer::GetMemoryUsage();
+  tracers += MemTracer::GetMemoryUsage();
+  tracers += L2RateTracer::GetMemoryUsage();
+
+  return report;
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,144 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_MEMORY_ACCOUNTING_HPP
+#define NDN_MEMORY_ACCOUNTING_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/ptr.h"
+
+#include <map>
+
+namespace nfd {
+class NameTree;
+class Fib;
+class Pit;
+class Cs;
+class Measurements;
+class StrategyChoice;
+class DeadNonceList;
+} // namespace nfd
+
+namespace ns3 {
+
+class Node;
+
+namespace ndn {
+
+class ContentStore;
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Live size of a table or another subsystem: number of entries and estimated bytes
+ */
+struct TableMemoryUsage {
+  TableMemoryUsage()
+    : nEntries(0)
+    , nBytes(0)
+  {
+  }
+
+  TableMemoryUsage(size_t entries, size_t bytes)
+    : nEntries(entries)
+    , nBytes(bytes)
+  {
+  }
+
+  TableMemoryUsage&
+  operator+=(const TableMemoryUsage& other)
+  {
+    nEntries += other.nEntries;
+    nBytes += other.nBytes;
+    return *this;
+  }
+
+  size_t nEntries;
+  size_t nBytes;
+};
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Per-node accounting of memory used by NFD tables and ndnSIM subsystems
+ *
+ * Unlike MemUsage, which reports RSS of the whole process, this class estimates how many
+ * entries and bytes each individual structure holds.  Byte counts are estimates: they include
+ * sizes of the entry objects, wire-encoded names and packets referenced by the entries, and
+ * container node overhead, but not allocator slack.
+ *
+ * Estimation walks the tables, so its cost is linear in the number of entries.
+ */
+class MemoryAccounting {
+public:
+  /**
+   * @brief Approximate overhead of a node in a node-based container (list, hash table, rb-tree)
+   */
+  static const size_t CONTAINER_NODE_OVERHEAD = 3 * sizeof(void*);
+
+  /**
+   * @brief Usage report, keyed by table/subsystem name (e.g., "Pit", "Cs", "App")
+   */
+  typedef std::map<std::string, TableMemoryUsage> Report;
+
+  /**
+   * @brief Collect usage of all NFD tables, ndnSIM content store (if any), and NDN applications
+   *        installed on the node
+   */
+  static Report
+  Collect(Ptr<Node> node);
+
+  /**
+   * @brief Usage of process-wide structures that are not attributed to any node
+   *        (interned name components and statically created tracers)
+   */
+  static Report
+  CollectGlobal();
+
+  static size_t
+  EstimateNameSize(const Name& name);
+
+  static TableMemoryUsage
+  Estimate(const nfd::NameTree& nameTree);
+
+  static TableMemoryUsage
+  Estimate(const nfd::Fib& fib);
+
+  static TableMemoryUsage
+  Estimate(const nfd::Pit& pit);
+
+  static TableMemoryUsage
+  Estimate(const nfd::Cs& cs);
+
+  static TableMemoryUsage
+  Estimate(const nfd::Measurements& measurements);
+
+  static TableMemoryUsage
+  Estimate(const nfd::StrategyChoice& strategyChoice);
+
+  static TableMemoryUsage
+  Estimate(const nfd::DeadNonceList& deadNonceList);
+
+  static TableMemoryUsage
+  Estimate(Ptr<ContentStore> contentStore);
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_MEMORY_ACCOUNTING_HPP
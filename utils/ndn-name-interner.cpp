@@ -0,0 +1,206 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-name-interner.hpp"
+
+#include "ns3/assert.h"
+
+#include <boost/functional/hash.hpp>
+
+namespace ns3 {
+namespace ndn {
+
+NameComponentPool&
+NameComponentPool::getInstance()
+{
+  // intentionally never destroyed, so InternedName objects with static storage duration can be
+  // safely released during program shutdown
+  static NameComponentPool* instance = new NameComponentPool();
+  return *instance;
+}
+
+NameComponentPool::NameComponentPool()
+  : m_valueBytes(0)
+{
+}
+
+size_t
+NameComponentPool::ComponentHash::operator()(const name::Component& component) const
+{
+  size_t seed = component.type();
+  boost::hash_range(seed, component.value_begin(), component.value_end());
+  return seed;
+}
+
+NameComponentPool::Id
+NameComponentPool::acquire(const name::Component& component)
+{
+  auto it = m_index.find(component);
+  if (it != m_index.end()) {
+    ++m_entries[it->second].refCount;
+    return it->second;
+  }
+
+  // component of a decoded packet shares the wire buffer of the whole packet, so the pool keeps a
+  // copy in its own buffer instead of keeping the packet alive
+  name::Component copy(Block(component.wire(), component.size()));
+
+  Id id;
+  if (!m_freeIds.empty()) {
+    id = m_freeIds.back();
+    m_freeIds.pop_back();
+    m_entries[id].component = copy;
+    m_entries[id].refCount = 1;
+  }
+  else {
+    id = m_entries.size();
+    m_entries.push_back(Entry{copy, 1});
+  }
+
+  m_index.emplace(copy, id);
+  m_valueBytes += copy.size() + sizeof(::ndn::Buffer);
+  return id;
+}
+
+void
+NameComponentPool::addRef(Id id)
+{
+  NS_ASSERT(id < m_entries.size() && m_entries[id].refCount > 0);
+  ++m_entries[id].refCount;
+}
+
+void
+NameComponentPool::release(Id id)
+{
+  NS_ASSERT(id < m_entries.size() && m_entries[id].refCount > 0);
+
+  Entry& entry = m_entries[id];
+  if (--entry.refCount > 0)
+    return;
+
+  m_valueBytes -= entry.component.size() + sizeof(::ndn::Buffer);
+  m_index.erase(entry.component);
+  entry.component = name::Component();
+  m_freeIds.push_back(id);
+}
+
+size_t
+NameComponentPool::size() const
+{
+  return m_index.size();
+}
+
+size_t
+NameComponentPool::getMemoryUsage() const
+{
+  // index keys share the own buffers of entries, so only count them as nodes
+  return m_valueBytes + m_entries.capacity() * sizeof(Entry) + m_freeIds.capacity() * sizeof(Id)
+         + m_index.size() * (sizeof(name::Component) + sizeof(Id) + sizeof(void*))
+         + m_index.bucket_count() * sizeof(void*);
+}
+
+InternedName::InternedName()
+{
+}
+
+InternedName::InternedName(const Name& name)
+{
+  NameComponentPool& pool = NameComponentPool::getInstance();
+
+  m_ids.reserve(name.size());
+  for (const name::Component& component : name) {
+    m_ids.push_back(pool.acquire(component));
+  }
+}
+
+InternedName::InternedName(const InternedName& other)
+  : m_ids(other.m_ids)
+{
+  NameComponentPool& pool = NameComponentPool::getInstance();
+  for (Id id : m_ids) {
+    pool.addRef(id);
+  }
+}
+
+InternedName::InternedName(InternedName&& other)
+  : m_ids(std::move(other.m_ids))
+{
+  other.m_ids.clear();
+}
+
+InternedName::~InternedName()
+{
+  if (m_ids.empty())
+    return;
+
+  NameComponentPool& pool = NameComponentPool::getInstance();
+  for (Id id : m_ids) {
+    pool.release(id);
+  }
+}
+
+InternedName&
+InternedName::operator=(InternedName other)
+{
+  m_ids.swap(other.m_ids);
+  return *this;
+}
+
+InternedName&
+InternedName::append(const name::Component& component)
+{
+  m_ids.push_back(NameComponentPool::getInstance().acquire(component));
+  return *this;
+}
+
+bool
+InternedName::isPrefixOf(const InternedName& other) const
+{
+  if (m_ids.size() > other.m_ids.size())
+    return false;
+
+  return std::equal(m_ids.begin(), m_ids.end(), other.m_ids.begin());
+}
+
+Name
+InternedName::toName() const
+{
+  NameComponentPool& pool = NameComponentPool::getInstance();
+
+  Name name;
+  for (Id id : m_ids) {
+    name.append(pool.get(id));
+  }
+  return name;
+}
+
+size_t
+InternedName::Hash::operator()(const InternedName& name) const
+{
+  return boost::hash_range(name.m_ids.begin(), name.m_ids.end());
+}
+
+std::ostream&
+operator<<(std::ostream& os, const InternedName& name)
+{
+  return os << name.toName();
+}
+
+} // namespace ndn
+} // namespace ns3
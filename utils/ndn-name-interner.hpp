@@ -0,0 +1,255 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_NAME_INTERNER_HPP
+#define NDN_NAME_INTERNER_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include <boost/noncopyable.hpp>
+
+#include <unordered_map>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Process-wide pool of interned name components
+ *
+ * Each distinct name::Component is stored once, in its own buffer (not in the wire buffer of the
+ * packet it came from), and identified by a dense integer ID.  Entries are reference counted, so
+ * components of short-lived names are reclaimed as soon as the last InternedName referencing
+ * them goes away.  Released IDs are reused.
+ *
+ * Interning pays off only for components that repeat across many names (e.g., the prefix of a
+ * consumer); unique components such as random suffixes or sequence numbers are better stored
+ * as they are.
+ *
+ * The pool is not thread-safe; it is intended to be used from the simulator thread only.
+ */
+class NameComponentPool : boost::noncopyable {
+public:
+  typedef uint32_t Id;
+
+  /**
+   * @brief Get the process-wide pool
+   */
+  static NameComponentPool&
+  getInstance();
+
+  /**
+   * @brief Intern component (if necessary) and add a reference to it
+   * @returns ID of the component
+   */
+  Id
+  acquire(const name::Component& component);
+
+  /**
+   * @brief Add a reference to an already interned component
+   */
+  void
+  addRef(Id id);
+
+  /**
+   * @brief Remove a reference; component is reclaimed when the last reference is gone
+   */
+  void
+  release(Id id);
+
+  /**
+   * @brief Get interned component by its ID
+   */
+  const name::Component&
+  get(Id id) const;
+
+  /**
+   * @brief Number of live interned components
+   */
+  size_t
+  size() const;
+
+  /**
+   * @brief Approximate number of bytes used by the pool (component buffers and indices)
+   */
+  size_t
+  getMemoryUsage() const;
+
+private:
+  NameComponentPool();
+
+  struct ComponentHash {
+    size_t
+    operator()(const name::Component& component) const;
+  };
+
+  struct Entry {
+    name::Component component;
+    uint32_t refCount;
+  };
+
+  std::vector<Entry> m_entries;
+  std::vector<Id> m_freeIds;
+  std::unordered_map<name::Component, Id, ComponentHash> m_index;
+  size_t m_valueBytes;
+};
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Compact, interned representation of ndn::Name
+ *
+ * Name is stored as a sequence of NameComponentPool IDs.  Identical components (e.g., shared
+ * prefixes such as /prefix/A) are stored only once in the process, and comparison for equality
+ * is a comparison of integer vectors instead of component-by-component TLV comparison.
+ *
+ * Ordering of InternedName is by component IDs and is not the canonical NDN name order.
+ */
+class InternedName {
+public:
+  typedef NameComponentPool::Id Id;
+
+  InternedName();
+
+  explicit InternedName(const Name& name);
+
+  InternedName(const InternedName& other);
+
+  InternedName(InternedName&& other);
+
+  ~InternedName();
+
+  InternedName&
+  operator=(InternedName other);
+
+  /**
+   * @brief Append a component
+   */
+  InternedName&
+  append(const name::Component& component);
+
+  /**
+   * @brief Get number of components
+   */
+  size_t
+  size() const;
+
+  bool
+  empty() const;
+
+  /**
+   * @brief Get ID of i-th component
+   */
+  Id
+  getId(size_t i) const;
+
+  /**
+   * @brief Get i-th component from the pool
+   */
+  const name::Component&
+  get(size_t i) const;
+
+  /**
+   * @brief Check if this name is a prefix of (or equal to) other
+   */
+  bool
+  isPrefixOf(const InternedName& other) const;
+
+  /**
+   * @brief Convert back to ndn::Name
+   */
+  Name
+  toName() const;
+
+  bool
+  operator==(const InternedName& other) const;
+
+  bool
+  operator!=(const InternedName& other) const;
+
+  bool
+  operator<(const InternedName& other) const;
+
+  /**
+   * @brief Hasher for use in unordered containers
+   */
+  struct Hash {
+    size_t
+    operator()(const InternedName& name) const;
+  };
+
+private:
+  std::vector<Id> m_ids;
+};
+
+std::ostream&
+operator<<(std::ostream& os, const InternedName& name);
+
+inline const name::Component&
+NameComponentPool::get(Id id) const
+{
+  return m_entries[id].component;
+}
+
+inline size_t
+InternedName::size() const
+{
+  return m_ids.size();
+}
+
+inline bool
+InternedName::empty() const
+{
+  return m_ids.empty();
+}
+
+inline InternedName::Id
+InternedName::getId(size_t i) const
+{
+  return m_ids[i];
+}
+
+inline const name::Component&
+InternedName::get(size_t i) const
+{
+  return NameComponentPool::getInstance().get(m_ids[i]);
+}
+
+inline bool
+InternedName::operator==(const InternedName& other) const
+{
+  return m_ids == other.m_ids;
+}
+
+inline bool
+InternedName::operator!=(const InternedName& other) const
+{
+  return m_ids != other.m_ids;
+}
+
+inline bool
+InternedName::operator<(const InternedName& other) const
+{
+  return m_ids < other.m_ids;
+}
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_NAME_INTERNER_HPP
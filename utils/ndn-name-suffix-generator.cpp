@@ -0,0 +1,151 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-name-suffix-generator.hpp"
+
+#include "ns3/rng-seed-manager.h"
+
+#include <algorithm>
+
+namespace ns3 {
+namespace ndn {
+
+static const char BASE62_DIGITS[] =
+  "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+static const char HEX_DIGITS[] = "0123456789abcdef";
+
+// number of base62 digits extracted from one 64-bit value; each digit consumes ~5.95 bits of
+// the value, so after 6 digits 28 bits remain and the per-digit bias stays below 62/2^28
+static const size_t BASE62_DIGITS_PER_VALUE = 6;
+static const size_t HEX_DIGITS_PER_VALUE = 16;
+
+// golden ratio increment of SplitMix64
+static const uint64_t GAMMA = 0x9e3779b97f4a7c15ULL;
+
+static inline uint64_t
+mix64(uint64_t z)
+{
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+/**
+ * @brief Portable 64x64 -> 128 bit multiplication
+ * @param[out] low lower 64 bits of the product (may alias a or b)
+ * @return upper 64 bits of the product
+ */
+static inline uint64_t
+multiply64(uint64_t a, uint64_t b, uint64_t& low)
+{
+  uint64_t aLow = a & 0xFFFFFFFFULL, aHigh = a >> 32;
+  uint64_t bLow = b & 0xFFFFFFFFULL, bHigh = b >> 32;
+
+  uint64_t lowLow = aLow * bLow;
+  uint64_t lowHigh = aLow * bHigh;
+  uint64_t highLow = aHigh * bLow;
+  uint64_t highHigh = aHigh * bHigh;
+
+  // sum of the middle 32-bit columns, including carry from the lowest product
+  uint64_t middle = (lowLow >> 32) + (lowHigh & 0xFFFFFFFFULL) + (highLow & 0xFFFFFFFFULL);
+
+  low = (middle << 32) | (lowLow & 0xFFFFFFFFULL);
+  return highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+}
+
+NameSuffixGenerator::NameSuffixGenerator()
+{
+  SetStream(0);
+}
+
+void
+NameSuffixGenerator::SetStream(uint64_t stream)
+{
+  m_stream = stream;
+  m_key = mix64(mix64(RngSeedManager::GetSeed()) ^ mix64(RngSeedManager::GetRun() + GAMMA)
+                ^ mix64(stream + 2 * GAMMA));
+  m_counter = 0;
+}
+
+uint64_t
+NameSuffixGenerator::GetStream() const
+{
+  return m_stream;
+}
+
+uint64_t
+NameSuffixGenerator::Next()
+{
+  return mix64(m_key + GAMMA * ++m_counter);
+}
+
+double
+NameSuffixGenerator::NextDouble()
+{
+  // 53 random bits, shifted by one so that zero is never returned
+  return ((Next() >> 11) + 1) * (1.0 / 9007199254740992.0);
+}
+
+void
+NameSuffixGenerator::Generate(char* buffer, size_t length, Alphabet alphabet /* = BASE62*/)
+{
+  if (alphabet == HEX) {
+    while (length > 0) {
+      uint64_t value = Next();
+      size_t n = std::min(length, HEX_DIGITS_PER_VALUE);
+      for (size_t i = 0; i < n; ++i) {
+        buffer[i] = HEX_DIGITS[(value >> (4 * i)) & 0xF];
+      }
+      buffer += n;
+      length -= n;
+    }
+    return;
+  }
+
+  while (length > 0) {
+    // treat value as a fraction in [0, 1) and take the integer part of value * 62 as the digit
+    uint64_t value = Next();
+    size_t n = std::min(length, BASE62_DIGITS_PER_VALUE);
+    for (size_t i = 0; i < n; ++i) {
+      buffer[i] = BASE62_DIGITS[multiply64(value, 62, value)];
+    }
+    buffer += n;
+    length -= n;
+  }
+}
+
+std::string
+NameSuffixGenerator::Generate(size_t length, Alphabet alphabet /* = BASE62*/)
+{
+  std::string suffix(length, '\0');
+  Generate(&suffix[0], length, alphabet);
+  return suffix;
+}
+
+name::Component
+NameSuffixGenerator::GenerateComponent(size_t length, Alphabet alphabet /* = BASE62*/)
+{
+  // generate directly into the component buffer
+  shared_ptr<::ndn::Buffer> buffer = make_shared<::ndn::Buffer>(length);
+  Generate(reinterpret_cast<char*>(buffer->buf()), length, alphabet);
+  return name::Component(buffer);
+}
+
+} // namespace ndn
+} // namespace ns3
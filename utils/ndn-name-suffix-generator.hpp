@@ -0,0 +1,106 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_NAME_SUFFIX_GENERATOR_HPP
+#define NDN_NAME_SUFFIX_GENERATOR_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include <string>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-apps
+ * @brief Reproducible generator of random name suffixes
+ *
+ * The generator is counter-based: the i-th 64-bit output is a bijective mix of (key + i), where
+ * the key is derived from the global ns-3 seed (RngSeed), run number (RngRun), and the stream
+ * assigned to the generator.  Each application owns its own generator, so generated names depend
+ * only on (seed, run, stream) and on how many suffixes the application itself generated, and not
+ * on the order in which other components draw random numbers.  This makes names reproducible
+ * across runs of parameter sweeps, unlike libc rand().
+ *
+ * Characters are produced in fixed-size blocks from each 64-bit output (16 hex or 6 base62
+ * characters per output) without per-character calls or string concatenation.
+ */
+class NameSuffixGenerator {
+public:
+  enum Alphabet {
+    BASE62, ///< [0-9A-Za-z]
+    HEX     ///< [0-9a-f]
+  };
+
+  /**
+   * @brief Create generator bound to stream 0
+   */
+  NameSuffixGenerator();
+
+  /**
+   * @brief Bind the generator to a stream and restart the sequence
+   *
+   * Key is re-derived from the current RngSeed/RngRun values
+   */
+  void
+  SetStream(uint64_t stream);
+
+  uint64_t
+  GetStream() const;
+
+  /**
+   * @brief Get next 64-bit random value
+   */
+  uint64_t
+  Next();
+
+  /**
+   * @brief Get next random value uniformly distributed in (0, 1]
+   */
+  double
+  NextDouble();
+
+  /**
+   * @brief Fill buffer with length random characters from the alphabet
+   */
+  void
+  Generate(char* buffer, size_t length, Alphabet alphabet = BASE62);
+
+  /**
+   * @brief Generate random string of the specified length
+   */
+  std::string
+  Generate(size_t length, Alphabet alphabet = BASE62);
+
+  /**
+   * @brief Generate generic name component consisting of length random characters
+   */
+  name::Component
+  GenerateComponent(size_t length, Alphabet alphabet = BASE62);
+
+private:
+  uint64_t m_stream;
+  uint64_t m_key;
+  uint64_t m_counter;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_NAME_SUFFIX_GENERATOR_HPP
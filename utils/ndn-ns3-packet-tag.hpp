@@ -27,6 +27,12 @@
 namespace ns3 {
 namespace ndn {
 
+/**
+ * @brief NDN packet tag that keeps the ns-3 packet the NDN packet was decoded from
+ *
+ * Besides the ns-3 packet, the tag carries per-packet metadata (hop count) as plain fields,
+ * so that it can be read without walking the ns-3 PacketTagList.
+ */
 class Ns3PacketTag : public ::ndn::Tag {
 public:
   static size_t
@@ -35,8 +41,9 @@ public:
     return 0xaee87802; // md5("Ns3PacketTag")[0:8]
   }
 
-  Ns3PacketTag(Ptr<const Packet> packet)
+  Ns3PacketTag(Ptr<const Packet> packet, uint32_t hopCount = 0)
     : m_packet(packet)
+    , m_hopCount(hopCount)
   {
   }
 
@@ -46,8 +53,18 @@ public:
     return m_packet;
   }
 
+  /**
+   * @brief Get number of NetDeviceFace hops the packet has traversed
+   */
+  uint32_t
+  getHopCount() const
+  {
+    return m_hopCount;
+  }
+
 private:
   Ptr<const Packet> m_packet;
+  uint32_t m_hopCount;
 };
 
 } // namespace ndn
@@ -0,0 +1,242 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-outstanding-interest-table.hpp"
+
+#include "ns3/assert.h"
+
+#include <algorithm>
+
+namespace ns3 {
+namespace ndn {
+
+static const uint32_t INITIAL_CAPACITY = 16;
+
+const uint32_t OutstandingInterestTable::DEFAULT_MAX_CAPACITY;
+
+OutstandingInterestTable::OutstandingInterestTable(uint32_t maxCapacity /* = DEFAULT_MAX_CAPACITY*/)
+  : m_mask(0)
+  , m_maxCapacity(INITIAL_CAPACITY)
+  , m_head(0)
+  , m_end(0)
+  , m_size(0)
+  , m_isHashed(false)
+{
+  while (m_maxCapacity < maxCapacity && m_maxCapacity < (1u << 31)) {
+    m_maxCapacity *= 2;
+  }
+}
+
+void
+OutstandingInterestTable::Reserve(uint32_t span)
+{
+  uint32_t capacity = m_slots.size();
+  if (span <= capacity)
+    return;
+
+  NS_ASSERT(span <= m_maxCapacity);
+
+  uint32_t newCapacity = std::max(capacity, INITIAL_CAPACITY);
+  while (newCapacity < span) {
+    newCapacity *= 2;
+  }
+
+  std::vector<OutstandingInterest> slots(newCapacity);
+  std::vector<bool> isValid(newCapacity, false);
+  uint32_t mask = newCapacity - 1;
+
+  for (uint32_t i = 0; i < capacity; i++) {
+    if (m_isValid[i]) {
+      uint32_t index = m_slots[i].seq & mask;
+      slots[index] = m_slots[i];
+      isValid[index] = true;
+    }
+  }
+
+  m_slots.swap(slots);
+  m_isValid.swap(isValid);
+  m_mask = mask;
+}
+
+void
+OutstandingInterestTable::SwitchToHashed()
+{
+  m_hashed.reserve(m_size);
+  for (uint32_t i = 0; i < m_slots.size(); i++) {
+    if (m_isValid[i])
+      m_hashed[m_slots[i].seq] = m_slots[i];
+  }
+
+  std::vector<OutstandingInterest>().swap(m_slots);
+  std::vector<bool>().swap(m_isValid);
+  m_mask = 0;
+  m_isHashed = true;
+}
+
+OutstandingInterest*
+OutstandingInterestTable::InitEntry(OutstandingInterest& entry, uint32_t seq)
+{
+  entry = OutstandingInterest();
+  entry.seq = seq;
+  entry.retxCount = 0;
+  entry.isTimeoutPending = false;
+  return &entry;
+}
+
+OutstandingInterest*
+OutstandingInterestTable::Insert(uint32_t seq)
+{
+  OutstandingInterest* entry = Find(seq);
+  if (entry != 0)
+    return entry;
+
+  if (m_size == 0 && !m_isHashed) {
+    m_head = seq;
+    m_end = seq;
+  }
+
+  if (!m_isHashed) {
+    if (static_cast<int32_t>(seq - m_head) < 0) {
+      if (m_end - seq > m_maxCapacity) {
+        SwitchToHashed();
+      }
+      else {
+        Reserve(m_end - seq);
+        m_head = seq;
+      }
+    }
+    else if (static_cast<int32_t>(seq - m_end) >= 0) {
+      if (seq + 1 - m_head > m_maxCapacity) {
+        SwitchToHashed();
+      }
+      else {
+        Reserve(seq + 1 - m_head);
+        m_end = seq + 1;
+      }
+    }
+  }
+
+  m_size++;
+  if (m_isHashed)
+    return InitEntry(m_hashed[seq], seq);
+
+  uint32_t index = seq & m_mask;
+  m_isValid[index] = true;
+  return InitEntry(m_slots[index], seq);
+}
+
+OutstandingInterest*
+OutstandingInterestTable::Find(uint32_t seq)
+{
+  if (m_size == 0)
+    return 0;
+
+  if (m_isHashed) {
+    auto entry = m_hashed.find(seq);
+    return entry != m_hashed.end() ? &entry->second : 0;
+  }
+
+  uint32_t index = seq & m_mask;
+  if (m_isValid[index] && m_slots[index].seq == seq)
+    return &m_slots[index];
+  else
+    return 0;
+}
+
+void
+OutstandingInterestTable::Erase(uint32_t seq)
+{
+  if (m_isHashed) {
+    m_size -= m_hashed.erase(seq);
+    return;
+  }
+
+  if (Find(seq) == 0)
+    return;
+
+  m_isValid[seq & m_mask] = false;
+  m_size--;
+
+  if (m_size == 0) {
+    m_head = m_end;
+    return;
+  }
+
+  // shrink the window from both sides
+  if (seq == m_head) {
+    while (!m_isValid[m_head & m_mask]) {
+      m_head++;
+    }
+  }
+  if (seq + 1 == m_end) {
+    while (!m_isValid[(m_end - 1) & m_mask]) {
+      m_end--;
+    }
+  }
+}
+
+void
+OutstandingInterestTable::Clear()
+{
+  std::fill(m_isValid.begin(), m_isValid.end(), false);
+  m_size = 0;
+  m_head = 0;
+  m_end = 0;
+
+  std::unordered_map<uint32_t, OutstandingInterest>().swap(m_hashed);
+  m_isHashed = false;
+}
+
+size_t
+OutstandingInterestTable::GetSize() const
+{
+  return m_size;
+}
+
+size_t
+OutstandingInterestTable::GetCapacity() const
+{
+  return m_slots.size();
+}
+
+size_t
+OutstandingInterestTable::GetMaxCapacity() const
+{
+  return m_maxCapacity;
+}
+
+bool
+OutstandingInterestTable::IsHashed() const
+{
+  return m_isHashed;
+}
+
+size_t
+OutstandingInterestTable::GetMemoryUsage() const
+{
+  // ring slots with their validity bits, or hash nodes (value and next pointer) with buckets
+  typedef std::unordered_map<uint32_t, OutstandingInterest>::value_type HashedValue;
+
+  return m_slots.size() * (sizeof(OutstandingInterest) + 1)
+         + m_hashed.size() * (sizeof(HashedValue) + sizeof(void*))
+         + m_hashed.bucket_count() * sizeof(void*);
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,142 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_OUTSTANDING_INTEREST_TABLE_HPP
+#define NDN_OUTSTANDING_INTEREST_TABLE_HPP
+
+#include "ns3/nstime.h"
+
+#include <vector>
+#include <unordered_map>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-apps
+ * @brief State of an Interest sent by a consumer and not yet satisfied
+ */
+struct OutstandingInterest {
+  uint32_t seq;
+  Time firstSent;        ///< @brief time of the first transmission
+  Time lastSent;         ///< @brief time of the last transmission
+  Time timeoutBase;      ///< @brief time from which retransmission timeout is counted
+  uint32_t retxCount;    ///< @brief number of transmissions
+  bool isTimeoutPending; ///< @brief whether retransmission timeout is armed
+};
+
+/**
+ * @ingroup ndn-apps
+ * @brief Table of outstanding Interests of a consumer, indexed by sequence number
+ *
+ * Entries are kept in a ring, in slot (seq mod capacity), so all operations are O(1).  All
+ * entries must fit into a window of capacity consecutive sequence numbers; the ring doubles when
+ * the window between the oldest and the newest outstanding sequence number grows beyond it.
+ *
+ * The window is limited to maxCapacity sequence numbers, so that an Interest that is never
+ * satisfied cannot grow the ring without bound.  When outstanding sequence numbers do not fit
+ * into the window (e.g., content indices drawn from a large catalog, or a sequence number that
+ * is never satisfied), the table falls back to a hash table, which stays in use until Clear.
+ * No entry is ever dropped.
+ */
+class OutstandingInterestTable {
+public:
+  static const uint32_t DEFAULT_MAX_CAPACITY = 1u << 16;
+
+  /**
+   * @param maxCapacity maximum window of sequence numbers (rounded up to a power of two)
+   */
+  explicit
+  OutstandingInterestTable(uint32_t maxCapacity = DEFAULT_MAX_CAPACITY);
+
+  /**
+   * @brief Find entry for the sequence number, or create a new one (with zero retxCount)
+   * @return pointer to the entry, valid until the next Insert
+   */
+  OutstandingInterest*
+  Insert(uint32_t seq);
+
+  /**
+   * @brief Find entry for the sequence number
+   * @return pointer to the entry or 0 if not found
+   */
+  OutstandingInterest*
+  Find(uint32_t seq);
+
+  void
+  Erase(uint32_t seq);
+
+  void
+  Clear();
+
+  size_t
+  GetSize() const;
+
+  /**
+   * @brief Get number of slots in the ring (0 once the table is hashed)
+   */
+  size_t
+  GetCapacity() const;
+
+  size_t
+  GetMaxCapacity() const;
+
+  /**
+   * @brief Check whether entries are kept in the hash table instead of the ring
+   */
+  bool
+  IsHashed() const;
+
+  /**
+   * @brief Get approximate number of bytes allocated for entries
+   */
+  size_t
+  GetMemoryUsage() const;
+
+private:
+  void
+  Reserve(uint32_t span);
+
+  /**
+   * @brief Move all entries from the ring into the hash table
+   */
+  void
+  SwitchToHashed();
+
+  static OutstandingInterest*
+  InitEntry(OutstandingInterest& entry, uint32_t seq);
+
+private:
+  std::vector<OutstandingInterest> m_slots;
+  std::vector<bool> m_isValid;
+  uint32_t m_mask;
+  uint32_t m_maxCapacity;
+
+  uint32_t m_head; // the oldest sequence number in the window
+  uint32_t m_end;  // sequence number following the newest one in the window
+  size_t m_size;
+
+  bool m_isHashed;
+  std::unordered_map<uint32_t, OutstandingInterest> m_hashed;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_OUTSTANDING_INTEREST_TABLE_HPP
@@ -0,0 +1,209 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-pint-accounting.hpp"
+
+#include <ndn-cxx/encoding/block.hpp>
+#include <ndn-cxx/encoding/tlv.hpp>
+
+#include <ostream>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @brief Read TLV type and length, and advance position to the value
+ * @return length of the value
+ */
+static inline size_t
+readHeader(const uint8_t*& position, const uint8_t* end)
+{
+  ::ndn::tlv::readType(position, end);
+  uint64_t length = ::ndn::tlv::readVarNumber(position, end);
+  if (length > static_cast<uint64_t>(end - position)) {
+    throw ::ndn::tlv::Error("TLV length exceeds the payload");
+  }
+  return static_cast<size_t>(length);
+}
+
+PintPayloadView::PintPayloadView(const Interest& interest)
+  : m_begin(nullptr)
+  , m_end(nullptr)
+  , m_size(0)
+{
+  const Block& wire = interest.wireEncode();
+  wire.parse(); // no-op for Interests decoded from the network
+  Block::element_const_iterator element = wire.find(::ndn::tlv::Payload);
+  if (element == wire.elements_end()) {
+    return; // no payload
+  }
+
+  m_begin = &*element->value_begin();
+  m_end = m_begin + element->value_size();
+
+  for (const uint8_t* position = m_begin; position != m_end; ++m_size) {
+    position += readHeader(position, m_end);
+  }
+}
+
+size_t
+PintPayloadView::size() const
+{
+  return m_size;
+}
+
+bool
+PintPayloadView::empty() const
+{
+  return m_size == 0;
+}
+
+bool
+PintPayloadView::isZeroCopy() const
+{
+  return m_begin != nullptr;
+}
+
+uint64_t
+PintPayloadView::operator[](size_t i) const
+{
+  BOOST_ASSERT(i < m_size);
+
+  const uint8_t* position = m_begin;
+  for (size_t j = 0; j < i; ++j) {
+    position += readHeader(position, m_end);
+  }
+
+  size_t length = readHeader(position, m_end);
+  return ::ndn::tlv::readNonNegativeInteger(length, position, position + length);
+}
+
+PintAccounting::PintAccounting()
+  : m_nPints(0)
+  , m_nEmpty(0)
+  , m_isPayloadKeyed(false)
+{
+}
+
+void
+PintAccounting::SetPayloadKeyed(bool isPayloadKeyed)
+{
+  m_isPayloadKeyed = isPayloadKeyed;
+}
+
+void
+PintAccounting::Add(const Interest& pint)
+{
+  Add(pint.getName(), PintPayloadView(pint), pint.getIncomingFaceId());
+}
+
+void
+PintAccounting::Add(const Name& name, const PintPayloadView& payload, uint64_t incomingFaceId)
+{
+  ++m_nPints;
+  ++m_faceCounters[incomingFaceId];
+
+  auto counter = m_nameCounters.find(name);
+  if (counter == m_nameCounters.end()) {
+    // own copy of the name, so the counter does not keep the PINT's wire buffer alive
+    const Block& wire = name.wireEncode();
+    Name copy(Block(wire.wire(), wire.size()));
+    counter = m_nameCounters.insert(std::make_pair(copy, 0)).first;
+  }
+  ++counter->second;
+
+  if (payload.empty()) {
+    ++m_nEmpty;
+    return;
+  }
+
+  if (m_isPayloadKeyed) {
+    ++m_keyCounters[payload[0]];
+  }
+}
+
+uint64_t
+PintAccounting::GetNPints() const
+{
+  return m_nPints;
+}
+
+uint64_t
+PintAccounting::GetNEmpty() const
+{
+  return m_nEmpty;
+}
+
+uint64_t
+PintAccounting::GetNPintsForName(const Name& name) const
+{
+  auto i = m_nameCounters.find(name);
+  return i != m_nameCounters.end() ? i->second : 0;
+}
+
+uint64_t
+PintAccounting::GetNPintsForKey(uint64_t key) const
+{
+  auto i = m_keyCounters.find(key);
+  return i != m_keyCounters.end() ? i->second : 0;
+}
+
+uint64_t
+PintAccounting::GetNPintsFromFace(uint64_t faceId) const
+{
+  auto i = m_faceCounters.find(faceId);
+  return i != m_faceCounters.end() ? i->second : 0;
+}
+
+const std::map<Name, uint64_t>&
+PintAccounting::GetNameCounters() const
+{
+  return m_nameCounters;
+}
+
+const std::unordered_map<uint64_t, uint64_t>&
+PintAccounting::GetKeyCounters() const
+{
+  return m_keyCounters;
+}
+
+const std::map<uint64_t, uint64_t>&
+PintAccounting::GetFaceCounters() const
+{
+  return m_faceCounters;
+}
+
+void
+PintAccounting::Print(std::ostream& os) const
+{
+  os << "Pints\t" << m_nPints << "\n";
+  os << "EmptyPints\t" << m_nEmpty << "\n";
+  for (const auto& face : m_faceCounters) {
+    os << "Face\t" << face.first << "\t" << face.second << "\n";
+  }
+  for (const auto& name : m_nameCounters) {
+    os << "Name\t" << name.first << "\t" << name.second << "\n";
+  }
+  for (const auto& key : m_keyCounters) {
+    os << "Key\t" << key.first << "\t" << key.second << "\n";
+  }
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,175 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_PINT_ACCOUNTING_HPP
+#define NDN_PINT_ACCOUNTING_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include <map>
+#include <unordered_map>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-apps
+ * @brief Read-only view of the accounting payload of an Interest (PINT)
+ *
+ * The payload is encoded (by Interest::setPayload of the ndn-cxx PINT extension) as a Payload
+ * element of the Interest, which contains one NonNegativeInteger element per value:
+ *
+ *     Payload ::= PAYLOAD-TYPE TLV-LENGTH
+ *                   (VALUE-TYPE TLV-LENGTH NonNegativeInteger)*
+ *
+ * Values are decoded in place from the Interest wire encoding, which is available for every
+ * Interest received from the network, instead of being copied into a std::vector as done by
+ * Interest::getPayload().  Nothing is allocated; the view references the Interest and must not
+ * outlive it.
+ *
+ * Accounting consumers put their sequence number into every value.  Only when their
+ * ConsumerIDInPayload attribute is set, the first value is the ID of the consumer instead (see
+ * InterestFactory::SetPayloadKey).
+ *
+ * @throw tlv::Error if the payload element is malformed
+ */
+class PintPayloadView {
+public:
+  explicit
+  PintPayloadView(const Interest& interest);
+
+  size_t
+  size() const;
+
+  bool
+  empty() const;
+
+  /**
+   * @brief Get i-th value of the payload
+   */
+  uint64_t
+  operator[](size_t i) const;
+
+  /**
+   * @brief Whether payload values are read in place from the Interest's wire encoding
+   *
+   * False if the Interest has no payload
+   */
+  bool
+  isZeroCopy() const;
+
+private:
+  const uint8_t* m_begin; ///< @brief beginning of the Payload element value
+  const uint8_t* m_end;   ///< @brief end of the Payload element value
+  size_t m_size;
+};
+
+/**
+ * @ingroup ndn-apps
+ * @brief Producer-side aggregator of PINT accounting information
+ *
+ * Every PINT is folded into counters as it arrives:
+ * - per name of the PINT (i.e., per consumer, as every accounting consumer requests names under
+ *   its own prefix or sequence number),
+ * - per incoming face of the producer node (i.e., per downstream router forwarding PINTs),
+ * - optionally, per accounting key (first value of the payload), for consumers that put their ID
+ *   there (ConsumerIDInPayload attribute).
+ *
+ * Counters are allocated on the first PINT of each name, face, or key only.
+ */
+class PintAccounting {
+public:
+  PintAccounting();
+
+  /**
+   * @brief Also count PINTs per accounting key carried in the first payload value
+   *
+   * Disabled by default, as the first value is the sequence number unless consumers are
+   * configured otherwise
+   */
+  void
+  SetPayloadKeyed(bool isPayloadKeyed);
+
+  /**
+   * @brief Account PINT
+   */
+  void
+  Add(const Interest& pint);
+
+  /**
+   * @brief Account PINT for the name with payload received from incomingFaceId
+   */
+  void
+  Add(const Name& name, const PintPayloadView& payload, uint64_t incomingFaceId);
+
+  uint64_t
+  GetNPints() const;
+
+  /**
+   * @brief Get number of PINTs without payload
+   */
+  uint64_t
+  GetNEmpty() const;
+
+  /**
+   * @brief Get number of PINTs for the name
+   */
+  uint64_t
+  GetNPintsForName(const Name& name) const;
+
+  /**
+   * @brief Get number of PINTs with the accounting key (only counted if payload keyed)
+   */
+  uint64_t
+  GetNPintsForKey(uint64_t key) const;
+
+  /**
+   * @brief Get number of PINTs received from the face
+   */
+  uint64_t
+  GetNPintsFromFace(uint64_t faceId) const;
+
+  const std::map<Name, uint64_t>&
+  GetNameCounters() const;
+
+  const std::unordered_map<uint64_t, uint64_t>&
+  GetKeyCounters() const;
+
+  const std::map<uint64_t, uint64_t>&
+  GetFaceCounters() const;
+
+  /**
+   * @brief Print counters as tab-separated lines
+   */
+  void
+  Print(std::ostream& os) const;
+
+private:
+  uint64_t m_nPints;
+  uint64_t m_nEmpty;
+  bool m_isPayloadKeyed;
+  std::map<Name, uint64_t> m_nameCounters;
+  std::unordered_map<uint64_t, uint64_t> m_keyCounters;
+  std::map<uint64_t, uint64_t> m_faceCounters;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_PINT_ACCOUNTING_HPP
@@ -0,0 +1,203 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-reuse-distance-histogram.hpp"
+
+#include "ndn-memory-accounting.hpp"
+
+#include "core/city-hash.hpp"
+
+#include "ns3/assert.h"
+
+#include <cmath>
+#include <limits>
+
+namespace ns3 {
+namespace ndn {
+
+static const uint32_t INITIAL_N_SLOTS = 1024;
+
+ReuseDistanceHistogram::ReuseDistanceHistogram(double samplingRate /* = 1.0*/)
+  : m_samplingRate(samplingRate)
+  , m_slotHashes(INITIAL_N_SLOTS)
+  , m_tree(INITIAL_N_SLOTS + 1)
+  , m_nextSlot(0)
+  , m_nColdAccesses(0)
+{
+  NS_ASSERT(m_samplingRate > 0 && m_samplingRate <= 1.0);
+
+  if (m_samplingRate >= 1.0)
+    m_threshold = std::numeric_limits<uint64_t>::max();
+  else
+    m_threshold = static_cast<uint64_t>(std::ldexp(m_samplingRate, 64));
+}
+
+void
+ReuseDistanceHistogram::Access(const Name& name)
+{
+  const Block& wire = name.wireEncode();
+  Access(CityHash64(reinterpret_cast<const char*>(wire.wire()), wire.size()));
+}
+
+void
+ReuseDistanceHistogram::Access(uint64_t hash)
+{
+  if (!IsSampled(hash))
+    return;
+
+  if (m_nextSlot == m_slotHashes.size())
+    Compact();
+
+  uint32_t slot = m_nextSlot++;
+  m_slotHashes[slot] = hash;
+  Update(slot, 1);
+
+  auto item = m_lastAccess.insert(std::make_pair(hash, slot));
+  if (item.second) {
+    m_nColdAccesses += 1 / m_samplingRate;
+    return;
+  }
+
+  uint32_t lastSlot = item.first->second;
+  item.first->second = slot;
+
+  uint32_t distance = CountBefore(slot) - CountBefore(lastSlot + 1);
+  Update(lastSlot, -1);
+
+  uint64_t scaled = static_cast<uint64_t>(std::llround(distance / m_samplingRate));
+  size_t bucket = 0;
+  while (scaled > 0) {
+    scaled >>= 1;
+    ++bucket;
+  }
+
+  if (bucket >= m_buckets.size())
+    m_buckets.resize(bucket + 1, 0);
+  m_buckets[bucket] += 1 / m_samplingRate;
+}
+
+double
+ReuseDistanceHistogram::GetSamplingRate() const
+{
+  return m_samplingRate;
+}
+
+const std::vector<double>&
+ReuseDistanceHistogram::GetBuckets() const
+{
+  return m_buckets;
+}
+
+double
+ReuseDistanceHistogram::GetNColdAccesses() const
+{
+  return m_nColdAccesses;
+}
+
+size_t
+ReuseDistanceHistogram::GetNTrackedNames() const
+{
+  return m_lastAccess.size();
+}
+
+size_t
+ReuseDistanceHistogram::GetMemoryUsage() const
+{
+  size_t nodeSize =
+    sizeof(std::pair<const uint64_t, uint32_t>) + MemoryAccounting::CONTAINER_NODE_OVERHEAD;
+
+  return m_lastAccess.size() * nodeSize + m_lastAccess.bucket_count() * sizeof(void*)
+         + m_slotHashes.capacity() * sizeof(uint64_t) + m_tree.capacity() * sizeof(uint32_t)
+         + m_buckets.capacity() * sizeof(double);
+}
+
+uint64_t
+ReuseDistanceHistogram::GetBucketLowerBound(size_t bucket)
+{
+  return bucket == 0 ? 0 : (static_cast<uint64_t>(1) << (bucket - 1));
+}
+
+void
+ReuseDistanceHistogram::Reset()
+{
+  m_buckets.clear();
+  m_nColdAccesses = 0;
+}
+
+bool
+ReuseDistanceHistogram::IsSampled(uint64_t hash) const
+{
+  // CityHash output bits are well mixed, so comparing against the threshold selects
+  // samplingRate fraction of names
+  return hash <= m_threshold;
+}
+
+uint32_t
+ReuseDistanceHistogram::CountBefore(uint32_t slot) const
+{
+  uint32_t count = 0;
+  for (; slot > 0; slot -= slot & (~slot + 1)) {
+    count += m_tree[slot];
+  }
+  return count;
+}
+
+void
+ReuseDistanceHistogram::Update(uint32_t slot, int32_t delta)
+{
+  for (++slot; slot < m_tree.size(); slot += slot & (~slot + 1)) {
+    m_tree[slot] += delta;
+  }
+}
+
+void
+ReuseDistanceHistogram::Compact()
+{
+  uint32_t nSlots = static_cast<uint32_t>(m_slotHashes.size());
+  if (m_lastAccess.size() > nSlots / 2) {
+    nSlots *= 2;
+  }
+
+  // keep only the last access of every tracked name, preserving the order
+  std::vector<uint64_t> slotHashes(nSlots);
+  uint32_t nextSlot = 0;
+  for (uint32_t slot = 0; slot < m_nextSlot; ++slot) {
+    auto item = m_lastAccess.find(m_slotHashes[slot]);
+    if (item != m_lastAccess.end() && item->second == slot) {
+      item->second = nextSlot;
+      slotHashes[nextSlot++] = item->first;
+    }
+  }
+
+  m_slotHashes.swap(slotHashes);
+  m_nextSlot = nextSlot;
+
+  // linear-time construction of the Fenwick tree with ones in [0, nextSlot)
+  m_tree.assign(nSlots + 1, 0);
+  for (uint32_t i = 1; i <= nSlots; ++i) {
+    if (i <= nextSlot)
+      m_tree[i] += 1;
+    uint32_t parent = i + (i & (~i + 1));
+    if (parent <= nSlots)
+      m_tree[parent] += m_tree[i];
+  }
+}
+
+} // namespace ndn
+} // namespace ns3
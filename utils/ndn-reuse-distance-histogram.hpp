@@ -0,0 +1,141 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_REUSE_DISTANCE_HISTOGRAM_HPP
+#define NDN_REUSE_DISTANCE_HISTOGRAM_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Histogram of reuse (stack) distances of the accessed names
+ *
+ * Reuse distance of an access is the number of distinct names accessed since the previous
+ * access to the same name.  Distances are accumulated into logarithmic buckets: bucket 0 holds
+ * distance 0 and bucket i > 0 holds distances in [2^(i-1), 2^i).  First accesses to a name are
+ * counted separately as cold accesses.
+ *
+ * To bound the memory and time overhead, only a subset of names is tracked: a name is sampled if
+ * its hash falls below samplingRate of the hash space, so that either all or none of the accesses
+ * to the name are sampled.  Distances and counts of the sampled accesses are scaled by
+ * 1/samplingRate.  With samplingRate 1.0 distances are exact.
+ */
+class ReuseDistanceHistogram {
+public:
+  /**
+   * @param samplingRate fraction of names to track, in (0, 1]
+   */
+  explicit
+  ReuseDistanceHistogram(double samplingRate = 1.0);
+
+  /**
+   * @brief Account access to the name
+   */
+  void
+  Access(const Name& name);
+
+  /**
+   * @brief Account access to the name with the given hash
+   */
+  void
+  Access(uint64_t hash);
+
+  double
+  GetSamplingRate() const;
+
+  /**
+   * @brief Get (scaled) number of accesses in each bucket
+   *
+   * Trailing empty buckets are not included
+   */
+  const std::vector<double>&
+  GetBuckets() const;
+
+  /**
+   * @brief Get (scaled) number of first accesses to names
+   */
+  double
+  GetNColdAccesses() const;
+
+  /**
+   * @brief Get number of tracked (sampled) names
+   */
+  size_t
+  GetNTrackedNames() const;
+
+  /**
+   * @brief Estimate bytes used by the histogram and the access history
+   */
+  size_t
+  GetMemoryUsage() const;
+
+  /**
+   * @brief Get the smallest distance accounted in the bucket
+   */
+  static uint64_t
+  GetBucketLowerBound(size_t bucket);
+
+  /**
+   * @brief Reset counters, preserving history of the accesses
+   */
+  void
+  Reset();
+
+private:
+  bool
+  IsSampled(uint64_t hash) const;
+
+  /**
+   * @brief Number of tracked names last accessed in slots [0, slot)
+   */
+  uint32_t
+  CountBefore(uint32_t slot) const;
+
+  void
+  Update(uint32_t slot, int32_t delta);
+
+  /**
+   * @brief Renumber slots of tracked names (or grow slot space) when slots are exhausted
+   */
+  void
+  Compact();
+
+private:
+  double m_samplingRate;
+  uint64_t m_threshold;
+
+  std::unordered_map<uint64_t, uint32_t> m_lastAccess; ///< @brief hash -> slot of last access
+  std::vector<uint64_t> m_slotHashes;                  ///< @brief slot -> hash
+  std::vector<uint32_t> m_tree;                        ///< @brief Fenwick tree of live slots
+  uint32_t m_nextSlot;
+
+  std::vector<double> m_buckets;
+  double m_nColdAccesses;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_REUSE_DISTANCE_HISTOGRAM_HPP
@@ -27,6 +27,7 @@
 // Implements several variations of round trip time estimators
 
 #include <iostream>
+#include <algorithm>
 
 #include "ndn-rtt-estimator.hpp"
 #include "ns3/simulator.h"
@@ -34,6 +35,7 @@
 #include "ns3/integer.h"
 #include "ns3/uinteger.h"
 #include "ns3/log.h"
+#include "ns3/assert.h"
 
 NS_LOG_COMPONENT_DEFINE("ndn.RttEstimator");
 
@@ -62,7 +64,14 @@ RttEstimator::GetTypeId(void)
                     MakeTimeChecker())
       .AddAttribute("MaxRTO", "Maximum retransmit timeout value", TimeValue(Seconds(200.0)),
                     MakeTimeAccessor(&RttEstimator::SetMaxRto, &RttEstimator::GetMaxRto),
-                    MakeTimeChecker());
+                    MakeTimeChecker())
+      .AddAttribute("MaxHistory",
+                    "Maximum number of outstanding sequence numbers kept in the history "
+                    "(oldest entries are dropped beyond it)",
+                    UintegerValue(65536),
+                    MakeUintegerAccessor(&RttEstimator::SetMaxHistory,
+                                         &RttEstimator::GetMaxHistory),
+                    MakeUintegerChecker<uint32_t>(1));
   return tid;
 }
 
@@ -102,6 +111,19 @@ RttEstimator::GetCurrentEstimate(void) const
   return m_currentEstimatedRtt;
 }
 
+void
+RttEstimator::SetMaxHistory(uint32_t maxHistory)
+{
+  NS_LOG_FUNCTION(this << maxHistory);
+  m_history.SetMaxSize(maxHistory);
+}
+
+uint32_t
+RttEstimator::GetMaxHistory(void) const
+{
+  return m_history.GetMaxSize();
+}
+
 // RttHistory methods
 RttHistory::RttHistory(SequenceNumber32 s, uint32_t c, Time t)
   : seq(s)
@@ -121,6 +143,146 @@ RttHistory::RttHistory(const RttHistory& h)
   NS_LOG_FUNCTION(this);
 }
 
+// RttHistoryBuffer methods
+
+RttHistoryBuffer::RttHistoryBuffer(uint32_t maxSize /* = 65536*/)
+  : m_nextOrder(0)
+  , m_maxSize(maxSize)
+{
+}
+
+void
+RttHistoryBuffer::SetMaxSize(uint32_t maxSize)
+{
+  m_maxSize = std::max<uint32_t>(maxSize, 1);
+  while (m_entries.size() > m_maxSize) {
+    PopFront();
+  }
+}
+
+uint32_t
+RttHistoryBuffer::GetMaxSize() const
+{
+  return m_maxSize;
+}
+
+size_t
+RttHistoryBuffer::GetSize() const
+{
+  return m_entries.size();
+}
+
+bool
+RttHistoryBuffer::IsEmpty() const
+{
+  return m_entries.empty();
+}
+
+void
+RttHistoryBuffer::Insert(const RttHistory& history)
+{
+  uint32_t seq = history.seq.GetValue();
+
+  auto entry = m_entries.find(seq);
+  if (entry != m_entries.end()) {
+    entry->second.history = history;
+    return;
+  }
+
+  if (m_entries.size() >= m_maxSize)
+    PopFront();
+
+  Entry newEntry = {history, m_nextOrder};
+  m_entries.insert(std::make_pair(seq, newEntry));
+  m_order.push_back(std::make_pair(seq, m_nextOrder));
+  m_nextOrder++;
+}
+
+RttHistory*
+RttHistoryBuffer::Find(SequenceNumber32 seq)
+{
+  auto entry = m_entries.find(seq.GetValue());
+  if (entry != m_entries.end())
+    return &entry->second.history;
+  else
+    return 0;
+}
+
+RttHistory*
+RttHistoryBuffer::FindContaining(SequenceNumber32 seq)
+{
+  for (const auto& record : m_order) {
+    auto entry = m_entries.find(record.first);
+    if (entry == m_entries.end() || entry->second.order != record.second)
+      continue; // removed
+
+    RttHistory& history = entry->second.history;
+    if (seq >= history.seq && seq < history.seq + SequenceNumber32(history.count))
+      return &history;
+  }
+  return 0;
+}
+
+void
+RttHistoryBuffer::Erase(SequenceNumber32 seq)
+{
+  if (m_entries.erase(seq.GetValue()) == 0)
+    return;
+
+  SkipRemoved();
+  CompactOrder();
+}
+
+RttHistory&
+RttHistoryBuffer::Front()
+{
+  NS_ASSERT(!m_entries.empty());
+  return m_entries.find(m_order.front().first)->second.history;
+}
+
+void
+RttHistoryBuffer::PopFront()
+{
+  NS_ASSERT(!m_entries.empty());
+  m_entries.erase(m_order.front().first);
+  m_order.pop_front();
+  SkipRemoved();
+}
+
+void
+RttHistoryBuffer::SkipRemoved()
+{
+  while (!m_order.empty()) {
+    auto entry = m_entries.find(m_order.front().first);
+    if (entry != m_entries.end() && entry->second.order == m_order.front().second)
+      break;
+    m_order.pop_front();
+  }
+}
+
+void
+RttHistoryBuffer::CompactOrder()
+{
+  // entries erased out of order leave their records behind the oldest entry
+  if (m_order.size() <= 2 * m_entries.size() + 16)
+    return;
+
+  std::deque<std::pair<uint32_t, uint64_t>> order;
+  for (const auto& record : m_order) {
+    auto entry = m_entries.find(record.first);
+    if (entry != m_entries.end() && entry->second.order == record.second)
+      order.push_back(record);
+  }
+  m_order.swap(order);
+}
+
+void
+RttHistoryBuffer::Clear()
+{
+  m_entries.clear();
+  m_order.clear();
+}
+
 // Base class methods
 
 RttEstimator::RttEstimator()
@@ -172,46 +334,54 @@ RttEstimator::SentSeq(SequenceNumber32 seq, uint32_t size)
   NS_LOG_FUNCTION(this << seq << size);
   // Note that a particular sequence has been sent
   if (seq == m_next) { // This is the next expected one, just log at end
-    m_history.push_back(RttHistory(seq, size, Simulator::Now()));
+    m_history.Insert(RttHistory(seq, size, Simulator::Now()));
     m_next = seq + SequenceNumber32(size); // Update next expected
   }
   else { // This is a retransmit, find in list and mark as re-tx
-    for (RttHistory_t::iterator i = m_history.begin(); i != m_history.end(); ++i) {
-      if ((seq >= i->seq) && (seq < (i->seq + SequenceNumber32(i->count)))) { // Found it
-        i->retx = true;
-        // One final test..be sure this re-tx does not extend "next"
-        if ((seq + SequenceNumber32(size)) > m_next) {
-          m_next = seq + SequenceNumber32(size);
-          i->count = ((seq + SequenceNumber32(size)) - i->seq); // And update count in hist
-        }
-        break;
+    RttHistory* i = m_history.Find(seq);
+    if (i == 0)
+      i = m_history.FindContaining(seq);
+
+    if (i != 0) { // Found it
+      i->retx = true;
+      // One final test..be sure this re-tx does not extend "next"
+      if ((seq + SequenceNumber32(size)) > m_next) {
+        m_next = seq + SequenceNumber32(size);
+        i->count = ((seq + SequenceNumber32(size)) - i->seq); // And update count in hist
       }
     }
   }
 }
 
+void
+RttEstimator::SentSeqs(SequenceNumber32 seq, uint32_t count)
+{
+  NS_LOG_FUNCTION(this << seq << count);
+  for (uint32_t i = 0; i < count; i++) {
+    SentSeq(seq + SequenceNumber32(i), 1);
+  }
+}
+
 Time
 RttEstimator::AckSeq(SequenceNumber32 ackSeq)
 {
   NS_LOG_FUNCTION(this << ackSeq);
   // An ack has been received, calculate rtt and log this measurement
-  // Note we use a linear search (O(n)) for this since for the common
-  // case the ack'ed packet will be at the head of the list
   Time m = Seconds(0.0);
-  if (m_history.size() == 0)
+  if (m_history.IsEmpty())
     return (m); // No pending history, just exit
-  RttHistory& h = m_history.front();
+  RttHistory& h = m_history.Front();
   if (!h.retx && ackSeq >= (h.seq + SequenceNumber32(h.count))) { // Ok to use this sample
     m = Simulator::Now() - h.time;                                // Elapsed time
     Measurement(m);                                               // Log the measurement
     ResetMultiplier(); // Reset multiplier on valid measurement
   }
   // Now delete all ack history with seq <= ack
-  while (m_history.size() > 0) {
-    RttHistory& h = m_history.front();
+  while (!m_history.IsEmpty()) {
+    RttHistory& h = m_history.Front();
     if ((h.seq + SequenceNumber32(h.count)) > ackSeq)
-      break;               // Done removing
-    m_history.pop_front(); // Remove
+      break;              // Done removing
+    m_history.PopFront(); // Remove
   }
   return m;
 }
@@ -222,7 +392,7 @@ RttEstimator::ClearSent()
   NS_LOG_FUNCTION(this);
   // Clear all history entries
   m_next = 1;
-  m_history.clear();
+  m_history.Clear();
 }
 
 void
@@ -247,7 +417,7 @@ RttEstimator::Reset()
   // Reset to initial state
   m_next = 1;
   m_currentEstimatedRtt = m_initialEstimatedRtt;
-  m_history.clear(); // Remove all info from the history
+  m_history.Clear(); // Remove all info from the history
   m_nSamples = 0;
   ResetMultiplier();
 }
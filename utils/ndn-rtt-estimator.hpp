@@ -27,6 +27,8 @@
 #define NDN_RTT_ESTIMATOR_H
 
 #include <deque>
+#include <unordered_map>
+#include <utility>
 #include "ns3/sequence-number.h"
 #include "ns3/nstime.h"
 #include "ns3/object.h"
@@ -51,7 +53,106 @@ public:
   bool retx;            // True if this has been retransmitted
 };
 
-typedef std::deque<RttHistory> RttHistory_t;
+/**
+ * \ingroup ndn-apps
+ *
+ * \brief Sequence-indexed buffer of RttHistory entries
+ *
+ * Entries are kept in a hash table keyed by the sequence number, so lookup, insertion, and removal
+ * of an entry by its sequence number take O(1) however sparse the sequence numbers are (e.g.,
+ * random sequence numbers of ConsumerZipfMandelbrot).  The order of insertion is kept alongside;
+ * at most maxSize entries are stored, and the oldest entries are dropped beyond that.
+ */
+class RttHistoryBuffer {
+public:
+  /**
+   * \param maxSize maximum number of stored entries
+   */
+  RttHistoryBuffer(uint32_t maxSize = 65536);
+
+  void
+  SetMaxSize(uint32_t maxSize);
+
+  uint32_t
+  GetMaxSize() const;
+
+  /**
+   * \brief Insert entry (replaces entry with the same sequence number, keeping its age)
+   *
+   * If the buffer is full, the oldest entry is dropped
+   */
+  void
+  Insert(const RttHistory& history);
+
+  /**
+   * \brief Find entry starting at the sequence number
+   * \return pointer to the entry or 0 if not found
+   */
+  RttHistory*
+  Find(SequenceNumber32 seq);
+
+  /**
+   * \brief Find entry that covers the sequence number (linear in the number of entries)
+   * \return pointer to the entry or 0 if not found
+   */
+  RttHistory*
+  FindContaining(SequenceNumber32 seq);
+
+  /**
+   * \brief Remove entry starting at the sequence number, if present
+   */
+  void
+  Erase(SequenceNumber32 seq);
+
+  /**
+   * \brief Get the oldest entry (buffer must not be empty)
+   *
+   * When entries are inserted in order of sequence numbers (as RttEstimator does), this is the
+   * entry with the lowest sequence number
+   */
+  RttHistory&
+  Front();
+
+  void
+  PopFront();
+
+  void
+  Clear();
+
+  size_t
+  GetSize() const;
+
+  bool
+  IsEmpty() const;
+
+private:
+  /**
+   * \brief Drop order records of removed entries from the front of the order
+   */
+  void
+  SkipRemoved();
+
+  /**
+   * \brief Drop all order records of removed entries once they outnumber stored entries
+   */
+  void
+  CompactOrder();
+
+private:
+  struct Entry {
+    RttHistory history;
+    uint64_t order; ///< \brief insertion counter, to tell the current entry from older ones
+  };
+
+  std::unordered_map<uint32_t, Entry> m_entries;
+
+  /// @brief (seq, insertion counter) in order of insertion, including records of removed entries
+  std::deque<std::pair<uint32_t, uint64_t>> m_order;
+  uint64_t m_nextOrder;
+  uint32_t m_maxSize;
+};
+
+typedef RttHistoryBuffer RttHistory_t;
 
 /**
  * \ingroup tcp
@@ -87,6 +188,18 @@ public:
   virtual Time
   AckSeq(SequenceNumber32 ackSeq);
 
+  /**
+   * \brief Note that a block of consecutive sequences has been sent at once
+   *
+   * Equivalent to calling SentSeq (seq + i, 1) for i in [0, count) (which is what the default
+   * implementation does); estimators can override it to share per-call work across the block
+   *
+   * \param seq first sequence number
+   * \param count number of sequence numbers (each of size 1)
+   */
+  virtual void
+  SentSeqs(SequenceNumber32 seq, uint32_t count);
+
   /**
    * \brief Clear all history entries
    */
@@ -170,6 +283,17 @@ public:
   Time
   GetCurrentEstimate(void) const;
 
+  /**
+   * \brief Set maximum number of outstanding sequence numbers tracked in the history
+   *
+   * Beyond it, history of the oldest sequence numbers is dropped (no RTT sample is taken for them)
+   */
+  void
+  SetMaxHistory(uint32_t maxHistory);
+
+  uint32_t
+  GetMaxHistory(void) const;
+
 private:
   SequenceNumber32 m_next; // Next expected sequence to be sent
   uint16_t m_maxMultiplier;
@@ -147,17 +147,30 @@ RttMeanDeviation::SentSeq(SequenceNumber32 seq, uint32_t size)
 {
   NS_LOG_FUNCTION(this << seq << size);
 
-  RttHistory_t::iterator i;
-  for (i = m_history.begin(); i != m_history.end(); ++i) {
-    if (seq == i->seq) { // Found it
-      i->retx = true;
-      break;
-    }
+  RttHistory* i = m_history.Find(seq);
+  if (i != 0) { // Found it
+    i->retx = true;
+  }
+  else {
+    // Note that a particular sequence has been sent
+    m_history.Insert(RttHistory(seq, size, Simulator::Now()));
   }
+}
 
-  // Note that a particular sequence has been sent
-  if (i == m_history.end())
-    m_history.push_back(RttHistory(seq, size, Simulator::Now()));
+void
+RttMeanDeviation::SentSeqs(SequenceNumber32 seq, uint32_t count)
+{
+  NS_LOG_FUNCTION(this << seq << count);
+
+  Time now = Simulator::Now();
+  for (uint32_t i = 0; i < count; i++) {
+    SequenceNumber32 current = seq + SequenceNumber32(i);
+    RttHistory* history = m_history.Find(current);
+    if (history != 0)
+      history->retx = true;
+    else
+      m_history.Insert(RttHistory(current, 1, now));
+  }
 }
 
 Time
@@ -165,22 +178,16 @@ RttMeanDeviation::AckSeq(SequenceNumber32 ackSeq)
 {
   NS_LOG_FUNCTION(this << ackSeq);
   // An ack has been received, calculate rtt and log this measurement
-  // Note we use a linear search (O(n)) for this since for the common
-  // case the ack'ed packet will be at the head of the list
   Time m = Seconds(0.0);
-  if (m_history.size() == 0)
-    return (m); // No pending history, just exit
-
-  for (RttHistory_t::iterator i = m_history.begin(); i != m_history.end(); ++i) {
-    if (ackSeq == i->seq) { // Found it
-      if (!i->retx) {
-        m = Simulator::Now() - i->time; // Elapsed time
-        Measurement(m);                 // Log the measurement
-        ResetMultiplier();              // Reset multiplier on valid measurement
-      }
-      m_history.erase(i);
-      break;
+
+  RttHistory* i = m_history.Find(ackSeq);
+  if (i != 0) { // Found it
+    if (!i->retx) {
+      m = Simulator::Now() - i->time; // Elapsed time
+      Measurement(m);                 // Log the measurement
+      ResetMultiplier();              // Reset multiplier on valid measurement
     }
+    m_history.Erase(ackSeq);
   }
 
   return m;
@@ -57,6 +57,8 @@ public:
 
   void
   SentSeq(SequenceNumber32 seq, uint32_t size);
+  void
+  SentSeqs(SequenceNumber32 seq, uint32_t count);
   Time
   AckSeq(SequenceNumber32 ackSeq);
   void
@@ -0,0 +1,204 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-timer-wheel.hpp"
+
+#include "ns3/node.h"
+#include "ns3/simulator.h"
+#include "ns3/log.h"
+#include "ns3/string.h"
+
+#include <limits>
+
+NS_LOG_COMPONENT_DEFINE("ndn.TimerWheel");
+
+namespace ns3 {
+namespace ndn {
+
+NS_OBJECT_ENSURE_REGISTERED(TimerWheel);
+
+static const size_t N_SLOTS = 256;
+
+TypeId
+TimerWheel::GetTypeId()
+{
+  static TypeId tid = TypeId("ns3::ndn::TimerWheel")
+                        .SetGroupName("Ndn")
+                        .SetParent<Object>()
+                        .AddConstructor<TimerWheel>()
+                        .AddAttribute("Resolution", "Granularity of the timers", StringValue("1ms"),
+                                      MakeTimeAccessor(&TimerWheel::m_resolution),
+                                      MakeTimeChecker(TimeStep(1)));
+  return tid;
+}
+
+Ptr<TimerWheel>
+TimerWheel::GetTimerWheel(Ptr<Node> node)
+{
+  Ptr<TimerWheel> wheel = node->GetObject<TimerWheel>();
+  if (wheel == 0) {
+    wheel = CreateObject<TimerWheel>();
+    node->AggregateObject(wheel);
+  }
+  return wheel;
+}
+
+TimerWheel::TimerWheel()
+  : m_slots(N_SLOTS)
+  , m_lastId(0)
+  , m_nextTick(0)
+  , m_isTicking(false)
+{
+}
+
+void
+TimerWheel::DoDispose()
+{
+  Simulator::Remove(m_tickEvent);
+  m_slots.clear();
+  m_pending.clear();
+
+  Object::DoDispose();
+}
+
+Time
+TimerWheel::GetTickTime(uint64_t tick) const
+{
+  return TimeStep(tick * m_resolution.GetTimeStep());
+}
+
+TimerWheel::TimerId
+TimerWheel::Schedule(const Time& delay, const Callback<void>& callback)
+{
+  int64_t resolution = m_resolution.GetTimeStep();
+  uint64_t tick = ((Simulator::Now() + delay).GetTimeStep() + resolution - 1) / resolution;
+
+  Timer timer = {++m_lastId, tick, callback};
+  m_slots[tick % N_SLOTS].push_back(timer);
+  m_pending.insert(std::make_pair(timer.id, tick));
+
+  // while ticking, the next tick is scheduled after all expired timers are processed
+  if (!m_isTicking && (!m_tickEvent.IsRunning() || tick < m_nextTick)) {
+    Simulator::Remove(m_tickEvent);
+    m_nextTick = tick;
+    m_tickEvent =
+      Simulator::Schedule(GetTickTime(tick) - Simulator::Now(), &TimerWheel::Tick, this);
+  }
+
+  return timer.id;
+}
+
+void
+TimerWheel::Cancel(TimerId timerId)
+{
+  auto item = m_pending.find(timerId);
+  if (item == m_pending.end())
+    return;
+
+  uint64_t tick = item->second;
+  m_pending.erase(item);
+
+  // timer may be absent from the slot if it has already expired and is about to be fired
+  std::vector<Timer>& slot = m_slots[tick % N_SLOTS];
+  for (std::vector<Timer>::iterator timer = slot.begin(); timer != slot.end(); ++timer) {
+    if (timer->id == timerId) {
+      slot.erase(timer);
+      break;
+    }
+  }
+
+  // while ticking, the next tick is scheduled after all expired timers are processed
+  if (!m_isTicking && tick == m_nextTick && m_tickEvent.IsRunning()) {
+    Simulator::Remove(m_tickEvent);
+    ScheduleTick(m_nextTick);
+  }
+}
+
+size_t
+TimerWheel::GetNPending() const
+{
+  return m_pending.size();
+}
+
+void
+TimerWheel::Tick()
+{
+  uint64_t tick = m_nextTick;
+
+  std::vector<Timer> expired;
+  std::vector<Timer>& slot = m_slots[tick % N_SLOTS];
+  std::vector<Timer>::iterator last = slot.begin();
+  for (std::vector<Timer>::iterator timer = slot.begin(); timer != slot.end(); ++timer) {
+    if (timer->tick <= tick)
+      expired.push_back(*timer);
+    else
+      *last++ = *timer;
+  }
+  slot.erase(last, slot.end());
+
+  m_isTicking = true;
+  for (Timer& timer : expired) {
+    if (m_pending.erase(timer.id) > 0)
+      timer.callback();
+  }
+  m_isTicking = false;
+
+  // timers scheduled by callbacks with zero delay fall into the current tick
+  ScheduleTick(tick);
+}
+
+void
+TimerWheel::ScheduleTick(uint64_t fromTick)
+{
+  if (m_pending.empty()) {
+    // only cancelled timers are left
+    for (std::vector<Timer>& slot : m_slots) {
+      slot.clear();
+    }
+    return;
+  }
+
+  uint64_t nextTick = std::numeric_limits<uint64_t>::max();
+  for (uint64_t tick = fromTick; tick < fromTick + N_SLOTS; tick++) {
+    for (const Timer& timer : m_slots[tick % N_SLOTS]) {
+      if (timer.tick <= tick) {
+        nextTick = tick;
+        break;
+      }
+    }
+    if (nextTick != std::numeric_limits<uint64_t>::max())
+      break;
+  }
+
+  if (nextTick == std::numeric_limits<uint64_t>::max()) {
+    // all timers are more than one rotation ahead
+    for (const std::vector<Timer>& slot : m_slots) {
+      for (const Timer& timer : slot) {
+        nextTick = std::min(nextTick, timer.tick);
+      }
+    }
+  }
+
+  m_nextTick = nextTick;
+  m_tickEvent =
+    Simulator::Schedule(GetTickTime(nextTick) - Simulator::Now(), &TimerWheel::Tick, this);
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,119 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_TIMER_WHEEL_HPP
+#define NDN_TIMER_WHEEL_HPP
+
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+#include "ns3/callback.h"
+#include "ns3/ptr.h"
+
+#include <vector>
+#include <unordered_map>
+
+namespace ns3 {
+
+class Node;
+
+namespace ndn {
+
+/**
+ * @ingroup ndn-apps
+ * @brief Hashed timer wheel shared by applications on a node
+ *
+ * Timers are rounded up to the wheel resolution and kept in slot (tick mod number of slots).
+ * Only one simulator event per node is pending at any time (for the earliest non-empty tick),
+ * instead of one periodic event per application.  Cancelled timers are removed from their slot
+ * right away, and the simulator event is rescheduled if the earliest timer is cancelled, so
+ * cancelled timers never cause a tick.
+ */
+class TimerWheel : public Object {
+public:
+  typedef uint64_t TimerId;
+
+  static TypeId
+  GetTypeId();
+
+  /**
+   * @brief Get timer wheel aggregated to the node (created on first use)
+   */
+  static Ptr<TimerWheel>
+  GetTimerWheel(Ptr<Node> node);
+
+  TimerWheel();
+
+  /**
+   * @brief Schedule callback to be called after the delay (rounded up to the resolution)
+   * @return identifier that can be used to cancel the timer
+   */
+  TimerId
+  Schedule(const Time& delay, const Callback<void>& callback);
+
+  /**
+   * @brief Cancel timer (no-op if timer already fired or was cancelled)
+   */
+  void
+  Cancel(TimerId timerId);
+
+  /**
+   * @brief Get number of pending (not fired and not cancelled) timers
+   */
+  size_t
+  GetNPending() const;
+
+protected:
+  virtual void
+  DoDispose();
+
+private:
+  void
+  Tick();
+
+  /**
+   * @brief Schedule simulator event for the earliest tick not less than fromTick
+   */
+  void
+  ScheduleTick(uint64_t fromTick);
+
+  Time
+  GetTickTime(uint64_t tick) const;
+
+private:
+  struct Timer {
+    TimerId id;
+    uint64_t tick;
+    Callback<void> callback;
+  };
+
+  Time m_resolution;
+  std::vector<std::vector<Timer>> m_slots;
+  std::unordered_map<TimerId, uint64_t> m_pending; ///< @brief timer ID -> tick
+  TimerId m_lastId;
+
+  EventId m_tickEvent;
+  uint64_t m_nextTick;
+  bool m_isTicking;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_TIMER_WHEEL_HPP
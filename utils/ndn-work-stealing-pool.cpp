@@ -0,0 +1,137 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-work-stealing-pool.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace ns3 {
+namespace ndn {
+
+namespace {
+
+/**
+ * @brief Range of job indices owned by a worker
+ */
+struct WorkQueue {
+  std::mutex mutex;
+  std::deque<size_t> jobs;
+};
+
+bool
+popOwn(WorkQueue& queue, size_t& job)
+{
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.jobs.empty())
+    return false;
+
+  job = queue.jobs.back();
+  queue.jobs.pop_back();
+  return true;
+}
+
+bool
+steal(WorkQueue& queue, size_t& job)
+{
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.jobs.empty())
+    return false;
+
+  job = queue.jobs.front();
+  queue.jobs.pop_front();
+  return true;
+}
+
+} // namespace
+
+WorkStealingPool::WorkStealingPool(size_t nThreads /* = 0*/)
+  : m_nThreads(nThreads)
+{
+  if (m_nThreads == 0)
+    m_nThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+size_t
+WorkStealingPool::GetNThreads() const
+{
+  return m_nThreads;
+}
+
+void
+WorkStealingPool::Run(const std::vector<Job>& jobs) const
+{
+  size_t nWorkers = std::min(m_nThreads, jobs.size());
+  if (nWorkers == 0)
+    return;
+
+  std::vector<std::unique_ptr<WorkQueue>> queues;
+  for (size_t i = 0; i < nWorkers; ++i) {
+    queues.emplace_back(new WorkQueue);
+    size_t begin = jobs.size() * i / nWorkers;
+    size_t end = jobs.size() * (i + 1) / nWorkers;
+    for (size_t job = begin; job < end; ++job) {
+      queues.back()->jobs.push_back(job);
+    }
+  }
+
+  std::mutex errorMutex;
+  std::exception_ptr error;
+
+  auto work = [&] (size_t self) {
+    size_t job;
+    while (true) {
+      bool hasJob = popOwn(*queues[self], job);
+      for (size_t i = 1; !hasJob && i < nWorkers; ++i) {
+        hasJob = steal(*queues[(self + i) % nWorkers], job);
+      }
+      if (!hasJob)
+        return; // jobs are never added, so there is nothing left anywhere
+
+      try {
+        jobs[job]();
+      }
+      catch (...) {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        if (!error)
+          error = std::current_exception();
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < nWorkers; ++i) {
+    threads.emplace_back(work, i);
+  }
+  work(0); // the calling thread is one of the workers
+
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  if (error)
+    std::rethrow_exception(error);
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,71 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_WORK_STEALING_POOL_HPP
+#define NDN_WORK_STEALING_POOL_HPP
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-apps
+ * @brief Pool of worker threads running a set of independent jobs
+ *
+ * Jobs are split into contiguous ranges, one per worker.  A worker takes jobs from the back of
+ * its own range, and once the range is empty it steals jobs from the front of other workers'
+ * ranges, so that workers with cheap jobs help those with expensive ones.
+ *
+ * Jobs must not touch the simulator or any state shared with other jobs.  Each job is run
+ * exactly once, so results that depend only on the job itself do not depend on the number of
+ * threads or on the order in which jobs are picked up.
+ */
+class WorkStealingPool {
+public:
+  typedef std::function<void()> Job;
+
+  /**
+   * @param nThreads number of worker threads (0: number of hardware threads)
+   */
+  explicit
+  WorkStealingPool(size_t nThreads = 0);
+
+  size_t
+  GetNThreads() const;
+
+  /**
+   * @brief Run all jobs and wait for them to finish
+   *
+   * If a job throws, the remaining jobs are still run and the first exception is rethrown
+   * from the calling thread
+   */
+  void
+  Run(const std::vector<Job>& jobs) const;
+
+private:
+  size_t m_nThreads;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_WORK_STEALING_POOL_HPP
@@ -42,8 +42,16 @@
 #include "ns3/error-model.h"
 #include "ns3/constant-position-mobility-model.h"
 
+#include "topology-partitioner.hpp"
+#include "mapped-text-file.hpp"
+
 #include "model/ndn-l3-protocol.hpp"
 #include "model/ndn-net-device-face.hpp"
+#include "model/ndn-global-router.hpp"
+#include "helper/ndn-fib-helper.hpp"
+
+#include "daemon/fw/forwarder.hpp"
+#include "daemon/table/fib.hpp"
 
 #include <boost/foreach.hpp>
 #include <boost/lexical_cast.hpp>
@@ -53,6 +61,11 @@
 #include <boost/graph/graphviz.hpp>
 
 #include <set>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+#include <unordered_set>
 
 #ifdef NS3_MPI
 #include <ns3/mpi-interface.h>
@@ -64,12 +77,235 @@ namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE("AnnotatedTopologyReader");
 
+/// @cond include_hidden
+
+namespace {
+
+const char SNAPSHOT_MAGIC[8] = {'N', 'D', 'N', 'T', 'O', 'P', 'O', '\0'};
+const uint32_t SNAPSHOT_VERSION = 2;
+const uint32_t SNAPSHOT_MAX_STRING = 1 << 20; // sanity limit for corrupted files
+
+/**
+ * \brief Contents of the topology snapshot file
+ */
+struct Snapshot {
+  struct Link {
+    uint32_t from;
+    uint32_t to;
+    vector<pair<string, string>> attributes;
+  };
+
+  struct Route {
+    string prefix;
+    uint32_t link;
+    uint8_t end; ///< \brief 0 for the "from" node of the link, 1 for the "to" node
+    uint64_t cost;
+  };
+
+  uint64_t checksum;
+  uint64_t routingChecksum;
+  vector<string> nodeNames;
+  vector<Vector> nodePositions;
+  vector<uint32_t> systemIds;
+  vector<Link> links;
+  vector<Route> routes;
+};
+
+class SnapshotWriter {
+public:
+  SnapshotWriter(ostream& os)
+    : m_os(os)
+  {
+  }
+
+  template<class T>
+  void
+  Write(const T& value)
+  {
+    m_os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
+
+  void
+  WriteString(const string& value)
+  {
+    Write<uint32_t>(value.size());
+    m_os.write(value.data(), value.size());
+  }
+
+private:
+  ostream& m_os;
+};
+
+class SnapshotReader {
+public:
+  SnapshotReader(istream& is)
+    : m_is(is)
+  {
+  }
+
+  /**
+   * \brief Check that the stream was not truncated so far
+   */
+  bool
+  IsGood() const
+  {
+    return !m_is.fail();
+  }
+
+  template<class T>
+  T
+  Read()
+  {
+    T value = T();
+    m_is.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return value;
+  }
+
+  string
+  ReadString()
+  {
+    uint32_t size = Read<uint32_t>();
+    if (!IsGood() || size > SNAPSHOT_MAX_STRING) {
+      m_is.setstate(ios::failbit);
+      return string();
+    }
+
+    string value(size, '\0');
+    m_is.read(&value[0], size);
+    return value;
+  }
+
+private:
+  istream& m_is;
+};
+
+/**
+ * \brief 64-bit FNV-1a hash
+ */
+class Checksum {
+public:
+  Checksum()
+    : m_value(14695981039346656037ULL)
+  {
+  }
+
+  void
+  Add(const void* data, size_t size)
+  {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; i++) {
+      m_value = (m_value ^ bytes[i]) * 1099511628211ULL;
+    }
+  }
+
+  void
+  Add(uint32_t value)
+  {
+    Add(&value, sizeof(value));
+  }
+
+  void
+  Add(uint64_t value)
+  {
+    Add(&value, sizeof(value));
+  }
+
+  void
+  Add(const string& value)
+  {
+    Add(static_cast<uint32_t>(value.size()));
+    Add(value.data(), value.size());
+  }
+
+  uint64_t
+  GetValue() const
+  {
+    return m_value;
+  }
+
+private:
+  uint64_t m_value;
+};
+
+bool
+IsSnapshotFile(const string& file)
+{
+  ifstream is(file.c_str(), ios::binary);
+  char magic[sizeof(SNAPSHOT_MAGIC)];
+  return is.read(magic, sizeof(magic)) && memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) == 0;
+}
+
+bool
+ReadSnapshotFile(const string& file, Snapshot& snapshot)
+{
+  ifstream is(file.c_str(), ios::binary);
+  char magic[sizeof(SNAPSHOT_MAGIC)];
+  if (!is.read(magic, sizeof(magic)) || memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) != 0) {
+    return false;
+  }
+
+  SnapshotReader reader(is);
+  if (reader.Read<uint32_t>() != SNAPSHOT_VERSION) {
+    NS_LOG_ERROR("Unsupported version of the topology snapshot " << file);
+    return false;
+  }
+  snapshot.checksum = reader.Read<uint64_t>();
+  snapshot.routingChecksum = reader.Read<uint64_t>();
+
+  uint32_t nNodes = reader.Read<uint32_t>();
+  for (uint32_t i = 0; i < nNodes && reader.IsGood(); i++) {
+    snapshot.nodeNames.push_back(reader.ReadString());
+    double x = reader.Read<double>();
+    double y = reader.Read<double>();
+    snapshot.nodePositions.push_back(Vector(x, y, 0));
+    snapshot.systemIds.push_back(reader.Read<uint32_t>());
+  }
+
+  uint32_t nLinks = reader.Read<uint32_t>();
+  for (uint32_t i = 0; i < nLinks && reader.IsGood(); i++) {
+    Snapshot::Link link;
+    link.from = reader.Read<uint32_t>();
+    link.to = reader.Read<uint32_t>();
+    if (link.from >= nNodes || link.to >= nNodes) {
+      return false;
+    }
+
+    uint32_t nAttributes = reader.Read<uint32_t>();
+    for (uint32_t j = 0; j < nAttributes && reader.IsGood(); j++) {
+      string attribute = reader.ReadString();
+      link.attributes.push_back(make_pair(attribute, reader.ReadString()));
+    }
+    snapshot.links.push_back(link);
+  }
+
+  uint32_t nRoutes = reader.Read<uint32_t>();
+  for (uint32_t i = 0; i < nRoutes && reader.IsGood(); i++) {
+    Snapshot::Route route;
+    route.prefix = reader.ReadString();
+    route.link = reader.Read<uint32_t>();
+    route.end = reader.Read<uint8_t>();
+    route.cost = reader.Read<uint64_t>();
+    if (route.link >= nLinks || route.end > 1) {
+      return false;
+    }
+    snapshot.routes.push_back(route);
+  }
+
+  return reader.IsGood();
+}
+
+} // namespace
+
+/// @endcond
+
 AnnotatedTopologyReader::AnnotatedTopologyReader(const std::string& path, double scale /*=1.0*/)
   : m_path(path)
   , m_randX(0, 100.0)
   , m_randY(0, 100.0)
   , m_scale(scale)
   , m_requiredPartitions(1)
+  , m_partitions(0)
+  , m_imbalance(0.1)
 {
   NS_LOG_FUNCTION(this);
 
@@ -130,6 +366,66 @@ AnnotatedTopologyReader::CreateNode(const std::string name, double posX, double
   return node;
 }
 
+void
+AnnotatedTopologyReader::CreateNodes(const std::vector<std::string>& names,
+                                     const std::vector<Vector>& positions,
+                                     const std::vector<uint32_t>& systemIds)
+{
+  for (size_t i = 0; i < names.size(); i++) {
+    CreateNode(names[i], positions[i].x, positions[i].y, systemIds[i]);
+  }
+}
+
+void
+AnnotatedTopologyReader::SetPartitions(uint32_t nPartitions, double imbalance /* = 0.1*/)
+{
+  m_partitions = nPartitions;
+  m_imbalance = imbalance;
+}
+
+void
+AnnotatedTopologyReader::SetNodeWeight(const std::string& name, double weight)
+{
+  m_nodeWeights[name] = weight;
+}
+
+bool
+AnnotatedTopologyReader::IsPartitioningEnabled() const
+{
+  return m_partitions > 1;
+}
+
+std::vector<uint32_t>
+AnnotatedTopologyReader::PartitionNodes(const std::vector<std::string>& nodeNames,
+                                        const std::vector<std::pair<uint32_t, uint32_t>>& links,
+                                        const std::vector<std::string>& delays) const
+{
+  NS_ASSERT(links.size() == delays.size());
+
+  // links without explicit delay get the default one
+  TypeId::AttributeInformation info;
+  TypeId::LookupByName("ns3::PointToPointChannel").LookupAttributeByName("Delay", &info);
+  Time defaultDelay = DynamicCast<const TimeValue>(info.initialValue)->Get();
+
+  TopologyPartitioner partitioner(m_partitions, m_imbalance);
+  for (const std::string& name : nodeNames) {
+    std::map<std::string, double>::const_iterator weight = m_nodeWeights.find(name);
+    partitioner.AddNode(weight != m_nodeWeights.end() ? weight->second : 1.0);
+  }
+
+  for (size_t i = 0; i < links.size(); i++) {
+    partitioner.AddLink(links[i].first, links[i].second,
+                        delays[i].empty() ? defaultDelay : Time(delays[i]));
+  }
+
+  std::vector<uint32_t> systemIds = partitioner.Partition();
+
+  NS_LOG_INFO("Nodes assigned to " << m_partitions << " partitions, "
+                                   << partitioner.GetCutSize() << " links cross partitions, "
+                                   << "lookahead " << partitioner.GetLookahead().As(Time::MS));
+  return systemIds;
+}
+
 NodeContainer
 AnnotatedTopologyReader::GetNodes() const
 {
@@ -142,118 +438,260 @@ AnnotatedTopologyReader::GetLinks() const
   return m_linksList;
 }
 
+const AnnotatedTopologyReader::ReadTimes&
+AnnotatedTopologyReader::GetReadTimes() const
+{
+  return m_readTimes;
+}
+
+AnnotatedTopologyReader::Stopwatch::Stopwatch()
+  : m_start(std::chrono::steady_clock::now())
+{
+}
+
+double
+AnnotatedTopologyReader::Stopwatch::Lap()
+{
+  std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  double seconds = std::chrono::duration<double>(now - m_start).count();
+  m_start = now;
+  return seconds;
+}
+
 NodeContainer
 AnnotatedTopologyReader::Read(void)
 {
-  ifstream topgen;
-  topgen.open(GetFileName().c_str());
+  if (IsSnapshotFile(GetFileName())) {
+    return ReadSnapshot();
+  }
+
+  m_readTimes = ReadTimes();
+  Stopwatch stopwatch;
 
-  if (!topgen.is_open() || !topgen.good()) {
+  MappedTextFile topgen(GetFileName());
+  if (!topgen.IsOpen()) {
     NS_FATAL_ERROR("Cannot open file " << GetFileName() << " for reading");
     return m_nodes;
   }
 
-  while (!topgen.eof()) {
-    string line;
-    getline(topgen, line);
-
-    if (line == "router")
+  MappedTextFile::Token line;
+  bool hasRouterSection = false;
+  while (topgen.NextLine(line)) {
+    if (line == "router") {
+      hasRouterSection = true;
       break;
+    }
   }
 
-  if (topgen.eof()) {
+  if (!hasRouterSection) {
     NS_FATAL_ERROR("Topology file " << GetFileName() << " does not have \"router\" section");
     return m_nodes;
   }
 
-  while (!topgen.eof()) {
-    string line;
-    getline(topgen, line);
-    if (line[0] == '#')
+  // Nodes are created only after all links are read, so systemIds can be assigned by the
+  // partitioner (if enabled)
+  vector<string> nodeNames;
+  vector<Vector> nodePositions;
+  vector<uint32_t> systemIds;
+  unordered_map<string, uint32_t> nodeIndex;
+
+  vector<MappedTextFile::Token> tokens;
+  bool hasLinkSection = false;
+  while (topgen.NextLine(line)) {
+    if (!line.empty() && line.data[0] == '#')
       continue; // comments
-    if (line == "link")
+    if (line == "link") {
+      hasLinkSection = true;
       break; // stop reading nodes
+    }
+
+    if (MappedTextFile::Split(line, tokens) == 0)
+      continue;
 
-    istringstream lineBuffer(line);
-    string name, city;
+    // name city latitude longitude systemId; parsing stops at the first malformed value
     double latitude = 0, longitude = 0;
     uint32_t systemId = 0;
+    tokens.resize(5);
+    if (MappedTextFile::Parse(tokens[2], latitude) && MappedTextFile::Parse(tokens[3], longitude))
+      MappedTextFile::Parse(tokens[4], systemId);
 
-    lineBuffer >> name >> city >> latitude >> longitude >> systemId;
-    if (name.empty())
-      continue;
-
-    Ptr<Node> node;
+    nodeIndex[tokens[0].ToString()] = nodeNames.size();
+    nodeNames.push_back(tokens[0].ToString());
+    systemIds.push_back(systemId);
 
     if (abs(latitude) > 0.001 && abs(latitude) > 0.001)
-      node = CreateNode(name, m_scale * longitude, -m_scale * latitude, systemId);
+      nodePositions.push_back(Vector(m_scale * longitude, -m_scale * latitude, 0));
     else {
       UniformVariable var(0, 200);
-      node = CreateNode(name, var.GetValue(), var.GetValue(), systemId);
-      // node = CreateNode (name, systemId);
+      double posX = var.GetValue();
+      nodePositions.push_back(Vector(posX, var.GetValue(), 0));
     }
   }
 
-  map<string, set<string>> processedLinks; // to eliminate duplications
-
-  if (topgen.eof()) {
+  if (!hasLinkSection) {
     NS_LOG_ERROR("Topology file " << GetFileName() << " does not have \"link\" section");
+    m_readTimes.parse = stopwatch.Lap();
+    CreateNodes(nodeNames, nodePositions, systemIds);
+    m_readTimes.nodes = stopwatch.Lap();
     return m_nodes;
   }
 
-  // SeekToSection ("link");
-  while (!topgen.eof()) {
-    string line;
-    getline(topgen, line);
-    if (line == "")
+  // to eliminate duplications: (from << 32 | to) of processed links
+  unordered_set<uint64_t> processedLinks;
+
+  struct LinkRecord {
+    uint32_t from, to;
+    string capacity, metric, delay, maxPackets, lossRate;
+  };
+  vector<LinkRecord> linkRecords;
+
+  while (topgen.NextLine(line)) {
+    if (line.empty())
       continue;
-    if (line[0] == '#')
+    if (line.data[0] == '#')
       continue; // comments
 
-    // NS_LOG_DEBUG ("Input: [" << line << "]");
+    MappedTextFile::Split(line, tokens);
+    tokens.resize(7);
 
-    istringstream lineBuffer(line);
-    string from, to, capacity, metric, delay, maxPackets, lossRate;
-
-    lineBuffer >> from >> to >> capacity >> metric >> delay >> maxPackets >> lossRate;
+    unordered_map<string, uint32_t>::const_iterator from = nodeIndex.find(tokens[0].ToString());
+    unordered_map<string, uint32_t>::const_iterator to = nodeIndex.find(tokens[1].ToString());
+    NS_ASSERT_MSG(from != nodeIndex.end(), tokens[0].ToString() << " node not found");
+    NS_ASSERT_MSG(to != nodeIndex.end(), tokens[1].ToString() << " node not found");
+    if (from == nodeIndex.end() || to == nodeIndex.end())
+      continue;
 
-    if (processedLinks[to].size() != 0
-        && processedLinks[to].find(from) != processedLinks[to].end()) {
+    if (processedLinks.count((static_cast<uint64_t>(to->second) << 32) | from->second) != 0) {
       continue; // duplicated link
     }
-    processedLinks[from].insert(to);
+    processedLinks.insert((static_cast<uint64_t>(from->second) << 32) | to->second);
+
+    LinkRecord record;
+    record.from = from->second;
+    record.to = to->second;
+    record.capacity = tokens[2].ToString();
+    record.metric = tokens[3].ToString();
+    record.delay = tokens[4].ToString();
+    record.maxPackets = tokens[5].ToString();
+    record.lossRate = tokens[6].ToString();
+    linkRecords.push_back(record);
+  }
+
+  m_readTimes.parse = stopwatch.Lap();
+
+  if (IsPartitioningEnabled()) {
+    vector<pair<uint32_t, uint32_t>> linkNodes;
+    vector<string> delays;
+    linkNodes.reserve(linkRecords.size());
+    delays.reserve(linkRecords.size());
+    for (const LinkRecord& record : linkRecords) {
+      linkNodes.push_back(make_pair(record.from, record.to));
+      delays.push_back(record.delay);
+    }
+    systemIds = PartitionNodes(nodeNames, linkNodes, delays);
+  }
+
+  m_readTimes.partition = stopwatch.Lap();
 
-    Ptr<Node> fromNode = Names::Find<Node>(m_path, from);
-    NS_ASSERT_MSG(fromNode != 0, from << " node not found");
-    Ptr<Node> toNode = Names::Find<Node>(m_path, to);
-    NS_ASSERT_MSG(toNode != 0, to << " node not found");
+  CreateNodes(nodeNames, nodePositions, systemIds);
 
-    Link link(fromNode, from, toNode, to);
+  m_readTimes.nodes = stopwatch.Lap();
 
-    link.SetAttribute("DataRate", capacity);
-    link.SetAttribute("OSPF", metric);
+  for (const LinkRecord& record : linkRecords) {
+    Link link(m_nodes.Get(record.from), nodeNames[record.from], m_nodes.Get(record.to),
+              nodeNames[record.to]);
 
-    if (!delay.empty())
-      link.SetAttribute("Delay", delay);
-    if (!maxPackets.empty())
-      link.SetAttribute("MaxPackets", maxPackets);
+    link.SetAttribute("DataRate", record.capacity);
+    link.SetAttribute("OSPF", record.metric);
+
+    if (!record.delay.empty())
+      link.SetAttribute("Delay", record.delay);
+    if (!record.maxPackets.empty())
+      link.SetAttribute("MaxPackets", record.maxPackets);
 
     // Saran Added lossRate
-    if (!lossRate.empty())
-      link.SetAttribute("LossRate", lossRate);
+    if (!record.lossRate.empty())
+      link.SetAttribute("LossRate", record.lossRate);
 
     AddLink(link);
-    NS_LOG_DEBUG("New link " << from << " <==> " << to << " / " << capacity << " with " << metric
-                             << " metric (" << delay << ", " << maxPackets << ", " << lossRate
-                             << ")");
+    NS_LOG_DEBUG("New link " << nodeNames[record.from] << " <==> " << nodeNames[record.to] << " / "
+                             << record.capacity << " with " << record.metric << " metric ("
+                             << record.delay << ", " << record.maxPackets << ", "
+                             << record.lossRate << ")");
   }
 
   NS_LOG_INFO("Annotated topology created with " << m_nodes.GetN() << " nodes and " << LinksSize()
                                                  << " links");
-  topgen.close();
 
   ApplySettings();
 
+  m_readTimes.links = stopwatch.Lap();
+
+  NS_LOG_INFO("Read times: parse " << m_readTimes.parse << "s, partition "
+                                   << m_readTimes.partition << "s, nodes " << m_readTimes.nodes
+                                   << "s, links " << m_readTimes.links << "s");
+
+  return m_nodes;
+}
+
+NodeContainer
+AnnotatedTopologyReader::ReadSnapshot()
+{
+  m_readTimes = ReadTimes();
+  Stopwatch stopwatch;
+
+  Snapshot snapshot;
+  if (!ReadSnapshotFile(GetFileName(), snapshot)) {
+    NS_FATAL_ERROR("Topology snapshot " << GetFileName() << " is truncated or corrupted");
+    return m_nodes;
+  }
+
+  m_readTimes.parse = stopwatch.Lap();
+
+  if (IsPartitioningEnabled()) {
+    vector<pair<uint32_t, uint32_t>> linkNodes;
+    vector<string> delays;
+    for (const Snapshot::Link& link : snapshot.links) {
+      linkNodes.push_back(make_pair(link.from, link.to));
+
+      string delay;
+      for (const pair<string, string>& attribute : link.attributes) {
+        if (attribute.first == "Delay")
+          delay = attribute.second;
+      }
+      delays.push_back(delay);
+    }
+    snapshot.systemIds = PartitionNodes(snapshot.nodeNames, linkNodes, delays);
+  }
+
+  m_readTimes.partition = stopwatch.Lap();
+
+  CreateNodes(snapshot.nodeNames, snapshot.nodePositions, snapshot.systemIds);
+
+  m_readTimes.nodes = stopwatch.Lap();
+
+  for (const Snapshot::Link& record : snapshot.links) {
+    Link link(m_nodes.Get(record.from), snapshot.nodeNames[record.from], m_nodes.Get(record.to),
+              snapshot.nodeNames[record.to]);
+
+    for (const pair<string, string>& attribute : record.attributes) {
+      link.SetAttribute(attribute.first, attribute.second);
+    }
+
+    AddLink(link);
+  }
+
+  NS_LOG_INFO("Topology snapshot loaded with " << m_nodes.GetN() << " nodes and " << LinksSize()
+                                               << " links");
+
+  ApplySettings();
+
+  m_readTimes.links = stopwatch.Lap();
+
+  if (GetTopologyChecksum() != snapshot.checksum) {
+    NS_FATAL_ERROR("Topology snapshot " << GetFileName() << " has invalid checksum");
+  }
+
   return m_nodes;
 }
 
@@ -329,12 +767,17 @@ AnnotatedTopologyReader::ApplySettings()
 
   PointToPointHelper p2p;
 
+  // p2p keeps settings between links, so the helper is reconfigured only when a link has a value
+  // different from the previously applied one (most links in large topologies share settings)
+  string appliedMaxPackets, appliedDataRate, appliedDelay;
+
   BOOST_FOREACH (Link& link, m_linksList) {
     // cout << "Link: " << Findlink.GetFromNode () << ", " << link.GetToNode () << endl;
     string tmp;
 
     ////////////////////////////////////////////////
-    if (link.GetAttributeFailSafe("MaxPackets", tmp)) {
+    if (link.GetAttributeFailSafe("MaxPackets", tmp) && tmp != appliedMaxPackets) {
+      appliedMaxPackets = tmp;
       NS_LOG_INFO("MaxPackets = " + link.GetAttribute("MaxPackets"));
 
       try {
@@ -373,12 +816,14 @@ AnnotatedTopologyReader::ApplySettings()
       }
     }
 
-    if (link.GetAttributeFailSafe("DataRate", tmp)) {
+    if (link.GetAttributeFailSafe("DataRate", tmp) && tmp != appliedDataRate) {
+      appliedDataRate = tmp;
       NS_LOG_INFO("DataRate = " + link.GetAttribute("DataRate"));
       p2p.SetDeviceAttribute("DataRate", StringValue(link.GetAttribute("DataRate")));
     }
 
-    if (link.GetAttributeFailSafe("Delay", tmp)) {
+    if (link.GetAttributeFailSafe("Delay", tmp) && tmp != appliedDelay) {
+      appliedDelay = tmp;
       NS_LOG_INFO("Delay = " + link.GetAttribute("Delay"));
       p2p.SetChannelAttribute("Delay", StringValue(link.GetAttribute("Delay")));
     }
@@ -495,6 +940,208 @@ AnnotatedTopologyReader::SaveTopology(const std::string& file)
   }
 }
 
+uint64_t
+AnnotatedTopologyReader::GetTopologyChecksum()
+{
+  Checksum checksum;
+  unordered_map<uint32_t, uint32_t> nodeIndex; // node id => index in m_nodes
+
+  checksum.Add(m_nodes.GetN());
+  for (uint32_t i = 0; i < m_nodes.GetN(); i++) {
+    nodeIndex[m_nodes.Get(i)->GetId()] = i;
+    checksum.Add(Names::FindName(m_nodes.Get(i)));
+  }
+
+  checksum.Add(static_cast<uint32_t>(m_linksList.size()));
+  for (Link& link : m_linksList) {
+    checksum.Add(nodeIndex[link.GetFromNode()->GetId()]);
+    checksum.Add(nodeIndex[link.GetToNode()->GetId()]);
+
+    checksum.Add(static_cast<uint32_t>(distance(link.AttributesBegin(), link.AttributesEnd())));
+    for (Link::ConstAttributesIterator attribute = link.AttributesBegin();
+         attribute != link.AttributesEnd(); attribute++) {
+      checksum.Add(attribute->first);
+      checksum.Add(attribute->second);
+    }
+  }
+
+  return checksum.GetValue();
+}
+
+uint64_t
+AnnotatedTopologyReader::GetRoutingChecksum(const std::string& routeParameters)
+{
+  Checksum checksum;
+  checksum.Add(GetTopologyChecksum());
+  checksum.Add(routeParameters);
+
+  // origins, independent of the order in which they were added
+  vector<string> prefixes;
+  for (uint32_t i = 0; i < m_nodes.GetN(); i++) {
+    prefixes.clear();
+    Ptr<ndn::GlobalRouter> router = m_nodes.Get(i)->GetObject<ndn::GlobalRouter>();
+    if (router != 0) {
+      for (const shared_ptr<ndn::Name>& prefix : router->GetLocalPrefixes()) {
+        prefixes.push_back(prefix->toUri());
+      }
+    }
+    sort(prefixes.begin(), prefixes.end());
+
+    checksum.Add(static_cast<uint32_t>(prefixes.size()));
+    for (const string& prefix : prefixes) {
+      checksum.Add(prefix);
+    }
+  }
+
+  return checksum.GetValue();
+}
+
+void
+AnnotatedTopologyReader::SaveTopologySnapshot(const std::string& file,
+                                              const std::string& routeParameters)
+{
+  ofstream os(file.c_str(), ios::trunc | ios::binary);
+  if (!os.is_open()) {
+    NS_LOG_ERROR("Cannot open file " << file << " for writing");
+    return;
+  }
+
+  os.write(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+
+  SnapshotWriter writer(os);
+  writer.Write(SNAPSHOT_VERSION);
+  writer.Write(GetTopologyChecksum());
+  writer.Write(GetRoutingChecksum(routeParameters));
+
+  unordered_map<uint32_t, uint32_t> nodeIndex; // node id => index in m_nodes
+
+  writer.Write<uint32_t>(m_nodes.GetN());
+  for (uint32_t i = 0; i < m_nodes.GetN(); i++) {
+    Ptr<Node> node = m_nodes.Get(i);
+    nodeIndex[node->GetId()] = i;
+
+    Vector position;
+    Ptr<MobilityModel> mobility = node->GetObject<MobilityModel>();
+    if (mobility != 0)
+      position = mobility->GetPosition();
+
+    writer.WriteString(Names::FindName(node));
+    writer.Write(position.x);
+    writer.Write(position.y);
+    writer.Write(node->GetSystemId());
+  }
+
+  // faces of the links => (link index, link end)
+  unordered_map<const ndn::Face*, pair<uint32_t, uint8_t>> linkFaces;
+
+  writer.Write<uint32_t>(m_linksList.size());
+  uint32_t linkIndex = 0;
+  for (Link& link : m_linksList) {
+    writer.Write(nodeIndex[link.GetFromNode()->GetId()]);
+    writer.Write(nodeIndex[link.GetToNode()->GetId()]);
+
+    writer.Write(static_cast<uint32_t>(distance(link.AttributesBegin(), link.AttributesEnd())));
+    for (Link::ConstAttributesIterator attribute = link.AttributesBegin();
+         attribute != link.AttributesEnd(); attribute++) {
+      writer.WriteString(attribute->first);
+      writer.WriteString(attribute->second);
+    }
+
+    Ptr<ndn::L3Protocol> fromNdn = link.GetFromNode()->GetObject<ndn::L3Protocol>();
+    if (fromNdn != 0) {
+      shared_ptr<ndn::Face> face = fromNdn->getFaceByNetDevice(link.GetFromNetDevice());
+      if (face != 0)
+        linkFaces[face.get()] = make_pair(linkIndex, 0);
+    }
+
+    Ptr<ndn::L3Protocol> toNdn = link.GetToNode()->GetObject<ndn::L3Protocol>();
+    if (toNdn != 0) {
+      shared_ptr<ndn::Face> face = toNdn->getFaceByNetDevice(link.GetToNetDevice());
+      if (face != 0)
+        linkFaces[face.get()] = make_pair(linkIndex, 1);
+    }
+
+    linkIndex++;
+  }
+
+  // only next hops via the link faces are saved; application faces are recreated by applications
+  vector<Snapshot::Route> routes;
+  for (NodeContainer::Iterator node = m_nodes.Begin(); node != m_nodes.End(); node++) {
+    Ptr<ndn::L3Protocol> ndn = (*node)->GetObject<ndn::L3Protocol>();
+    if (ndn == 0)
+      continue;
+
+    for (const nfd::fib::Entry& entry : ndn->getForwarder()->getFib()) {
+      for (const nfd::fib::NextHop& nextHop : entry.getNextHops()) {
+        unordered_map<const ndn::Face*, pair<uint32_t, uint8_t>>::const_iterator linkFace =
+          linkFaces.find(nextHop.getFace().get());
+        if (linkFace == linkFaces.end())
+          continue;
+
+        Snapshot::Route route;
+        route.prefix = entry.getPrefix().toUri();
+        route.link = linkFace->second.first;
+        route.end = linkFace->second.second;
+        route.cost = nextHop.getCost();
+        routes.push_back(route);
+      }
+    }
+  }
+
+  writer.Write<uint32_t>(routes.size());
+  for (const Snapshot::Route& route : routes) {
+    writer.WriteString(route.prefix);
+    writer.Write(route.link);
+    writer.Write(route.end);
+    writer.Write(route.cost);
+  }
+
+  NS_LOG_INFO("Topology snapshot saved with " << m_nodes.GetN() << " nodes, " << LinksSize()
+                                              << " links, and " << routes.size() << " routes");
+}
+
+bool
+AnnotatedTopologyReader::LoadRoutes(const std::string& file, const std::string& routeParameters)
+{
+  Snapshot snapshot;
+  if (!ReadSnapshotFile(file, snapshot)) {
+    NS_LOG_WARN(file << " is not a valid topology snapshot");
+    return false;
+  }
+
+  if (snapshot.checksum != GetTopologyChecksum()) {
+    NS_LOG_INFO("Routes in " << file << " were saved for a different topology");
+    return false;
+  }
+
+  if (snapshot.routingChecksum != GetRoutingChecksum(routeParameters)) {
+    NS_LOG_INFO("Routes in " << file << " were saved for different origins or route parameters");
+    return false;
+  }
+
+  vector<Link*> links;
+  for (Link& link : m_linksList) {
+    links.push_back(&link);
+  }
+
+  for (const Snapshot::Route& route : snapshot.routes) {
+    const Link& link = *links[route.link];
+    Ptr<Node> node = route.end == 0 ? link.GetFromNode() : link.GetToNode();
+    Ptr<NetDevice> device = route.end == 0 ? link.GetFromNetDevice() : link.GetToNetDevice();
+
+    Ptr<ndn::L3Protocol> ndn = node->GetObject<ndn::L3Protocol>();
+    NS_ASSERT_MSG(ndn != 0, "Ndn stack should be installed on the node");
+
+    shared_ptr<ndn::Face> face = ndn->getFaceByNetDevice(device);
+    NS_ASSERT_MSG(face != 0, "There is no face associated with the link");
+
+    ndn::FibHelper::AddRoute(node, ndn::Name(route.prefix), face, static_cast<int32_t>(route.cost));
+  }
+
+  NS_LOG_INFO(snapshot.routes.size() << " routes loaded from " << file);
+  return true;
+}
+
 /// @cond include_hidden
 
 template<class Names>
@@ -25,6 +25,11 @@
 #include "ns3/topology-reader.h"
 #include "ns3/random-variable.h"
 #include "ns3/object-factory.h"
+#include "ns3/vector.h"
+
+#include <map>
+#include <vector>
+#include <chrono>
 
 namespace ns3 {
 
@@ -97,6 +102,55 @@ public:
   virtual void
   SetMobilityModel(const std::string& model);
 
+  /**
+   * \brief Enable automatic assignment of nodes to partitions for distributed (MPI) simulation
+   *
+   * When enabled, systemIds specified in the topology file are ignored and nodes are assigned
+   * to nPartitions partitions using TopologyPartitioner: minimum delay of links between
+   * partitions (lookahead) is maximized, partitions are balanced according to node weights (see
+   * SetNodeWeight), and the number of links between partitions is minimized.
+   *
+   * Should be called before Read (), typically as SetPartitions (MpiInterface::GetSize ())
+   *
+   * \param nPartitions number of partitions (0 or 1 disables partitioning)
+   * \param imbalance allowed relative excess of partition weight over the average
+   */
+  virtual void
+  SetPartitions(uint32_t nPartitions, double imbalance = 0.1);
+
+  /**
+   * \brief Set weight of the node for partitioning (default is 1)
+   *
+   * Weight should reflect the expected simulation load on the node, e.g., 1 + number of
+   * consumer applications that will be installed on it.  Should be called before Read ()
+   */
+  virtual void
+  SetNodeWeight(const std::string& name, double weight);
+
+  /**
+   * \brief Wall-clock time (in seconds) spent in phases of the last Read () call
+   */
+  struct ReadTimes {
+    ReadTimes()
+      : parse(0)
+      , partition(0)
+      , nodes(0)
+      , links(0)
+    {
+    }
+
+    double parse;     ///< \brief reading the file and building the list of nodes and links
+    double partition; ///< \brief assigning nodes to partitions (if enabled)
+    double nodes;     ///< \brief creating nodes
+    double links;     ///< \brief creating links (network devices and channels)
+  };
+
+  /**
+   * \brief Get time spent in phases of the last Read () call
+   */
+  const ReadTimes&
+  GetReadTimes() const;
+
   /**
    * \brief Apply OSPF metric on Ipv4 (if exists) and Ccnx (if exists) stacks
    */
@@ -109,6 +163,53 @@ public:
   virtual void
   SaveTopology(const std::string& file);
 
+  /**
+   * \brief Save topology and routes in binary snapshot format
+   *
+   * The snapshot contains nodes (names, positions, and systemIds), links with all their
+   * attributes, checksums of the topology and of the routing input (see GetTopologyChecksum and
+   * GetRoutingChecksum), and FIB next hops (e.g., calculated by GlobalRoutingHelper) that point
+   * to faces of the topology links.  Data is stored in the native byte order.
+   *
+   * The snapshot can be given to Read () instead of the text topology file (the format is detected
+   * automatically), and routes are restored using LoadRoutes ()
+   *
+   * \param routeParameters description of how the routes were calculated, e.g.,
+   *        "CalculateMultipathRoutes(3)"; the same description should be given to LoadRoutes ()
+   */
+  virtual void
+  SaveTopologySnapshot(const std::string& file, const std::string& routeParameters = "");
+
+  /**
+   * \brief Install routes saved in the snapshot, if the snapshot was saved for the same topology
+   *
+   * The topology can be read either from the snapshot or from the text file.  NDN stack should be
+   * installed on the nodes
+   *
+   * \param routeParameters description of how the routes should be calculated, as given to
+   *        SaveTopologySnapshot ()
+   * \return false if the file is not a snapshot or was saved for a different topology, different
+   *         origins (see GlobalRoutingHelper::AddOrigin), or different route parameters (routes
+   *         should be calculated again, e.g., using GlobalRoutingHelper::CalculateRoutes ())
+   */
+  virtual bool
+  LoadRoutes(const std::string& file, const std::string& routeParameters = "");
+
+  /**
+   * \brief Get checksum of node names, links, and link attributes
+   *
+   * Node positions and systemIds are not included, as they do not affect routing
+   */
+  uint64_t
+  GetTopologyChecksum();
+
+  /**
+   * \brief Get checksum of everything that routes are calculated from: the topology
+   *        (see GetTopologyChecksum), origins of every node, and routeParameters
+   */
+  uint64_t
+  GetRoutingChecksum(const std::string& routeParameters);
+
   /**
    * \brief Save topology in graphviz format (.dot file)
    */
@@ -122,6 +223,49 @@ protected:
   Ptr<Node>
   CreateNode(const std::string name, double posX, double posY, uint32_t systemId);
 
+  void
+  CreateNodes(const std::vector<std::string>& names, const std::vector<Vector>& positions,
+              const std::vector<uint32_t>& systemIds);
+
+  bool
+  IsPartitioningEnabled() const;
+
+  /**
+   * \brief Assign nodes to partitions
+   *
+   * \param nodeNames names of the nodes
+   * \param links pairs of node indices (in nodeNames) connected by links
+   * \param delays delays of the links (empty string for the default PointToPointChannel delay)
+   * \return systemId for every node
+   */
+  std::vector<uint32_t>
+  PartitionNodes(const std::vector<std::string>& nodeNames,
+                 const std::vector<std::pair<uint32_t, uint32_t>>& links,
+                 const std::vector<std::string>& delays) const;
+
+  /**
+   * \brief Read topology from the binary snapshot (see SaveTopologySnapshot)
+   */
+  NodeContainer
+  ReadSnapshot();
+
+  /**
+   * \brief Measures wall-clock time of consecutive phases
+   */
+  class Stopwatch {
+  public:
+    Stopwatch();
+
+    /**
+     * \brief Get seconds since construction or the previous call
+     */
+    double
+    Lap();
+
+  private:
+    std::chrono::steady_clock::time_point m_start;
+  };
+
 protected:
   /**
    * \brief This method applies setting to corresponding nodes and links
@@ -134,6 +278,7 @@ protected:
 protected:
   std::string m_path;
   NodeContainer m_nodes;
+  ReadTimes m_readTimes;
 
 private:
   AnnotatedTopologyReader(const AnnotatedTopologyReader&);
@@ -147,6 +292,10 @@ private:
   double m_scale;
 
   uint32_t m_requiredPartitions;
+
+  uint32_t m_partitions;
+  double m_imbalance;
+  std::map<std::string, double> m_nodeWeights;
 };
 }
 
@@ -0,0 +1,174 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "mapped-text-file.hpp"
+
+#include <cstring>
+#include <cstdlib>
+#include <limits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ns3 {
+
+bool
+MappedTextFile::Token::operator==(const char* other) const
+{
+  return std::strlen(other) == size && std::memcmp(data, other, size) == 0;
+}
+
+MappedTextFile::MappedTextFile(const std::string& fileName)
+  : m_isOpen(false)
+  , m_data(0)
+  , m_size(0)
+  , m_position(0)
+  , m_isMapped(false)
+{
+  int fd = open(fileName.c_str(), O_RDONLY);
+  if (fd < 0)
+    return;
+
+  struct stat info;
+  if (fstat(fd, &info) != 0) {
+    close(fd);
+    return;
+  }
+
+  m_size = info.st_size;
+  m_isOpen = true;
+
+  if (m_size > 0) {
+    void* data = mmap(0, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data != MAP_FAILED) {
+      madvise(data, m_size, MADV_SEQUENTIAL);
+      m_data = static_cast<const char*>(data);
+      m_isMapped = true;
+    }
+    else {
+      // e.g., special files that cannot be mapped
+      m_buffer.resize(m_size);
+      ssize_t nRead = read(fd, &m_buffer[0], m_size);
+      m_size = nRead > 0 ? nRead : 0;
+      m_data = m_buffer.empty() ? 0 : &m_buffer[0];
+    }
+  }
+
+  close(fd);
+}
+
+MappedTextFile::~MappedTextFile()
+{
+  if (m_isMapped)
+    munmap(const_cast<char*>(m_data), m_size);
+}
+
+bool
+MappedTextFile::NextLine(Token& line)
+{
+  if (m_position >= m_size)
+    return false;
+
+  const char* begin = m_data + m_position;
+  const char* end = static_cast<const char*>(std::memchr(begin, '\n', m_size - m_position));
+  if (end == 0) {
+    end = m_data + m_size;
+    m_position = m_size;
+  }
+  else {
+    m_position = end - m_data + 1;
+  }
+
+  if (end > begin && *(end - 1) == '\r')
+    end--;
+
+  line = Token(begin, end - begin);
+  return true;
+}
+
+static inline bool
+IsSpace(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' || c == '\f';
+}
+
+size_t
+MappedTextFile::Split(const Token& line, std::vector<Token>& tokens)
+{
+  tokens.clear();
+
+  const char* position = line.data;
+  const char* end = line.data + line.size;
+  while (position < end) {
+    while (position < end && IsSpace(*position))
+      position++;
+
+    const char* begin = position;
+    while (position < end && !IsSpace(*position))
+      position++;
+
+    if (position > begin)
+      tokens.push_back(Token(begin, position - begin));
+  }
+
+  return tokens.size();
+}
+
+bool
+MappedTextFile::Parse(const Token& token, double& value)
+{
+  // tokens are not null-terminated
+  char buffer[64];
+  if (token.empty() || token.size >= sizeof(buffer))
+    return false;
+
+  std::memcpy(buffer, token.data, token.size);
+  buffer[token.size] = '\0';
+
+  char* end = 0;
+  double result = std::strtod(buffer, &end);
+  if (end != buffer + token.size)
+    return false;
+
+  value = result;
+  return true;
+}
+
+bool
+MappedTextFile::Parse(const Token& token, uint32_t& value)
+{
+  if (token.empty() || token.size > 10)
+    return false;
+
+  uint64_t result = 0;
+  for (size_t i = 0; i < token.size; i++) {
+    if (token.data[i] < '0' || token.data[i] > '9')
+      return false;
+    result = result * 10 + (token.data[i] - '0');
+  }
+  if (result > std::numeric_limits<uint32_t>::max())
+    return false;
+
+  value = result;
+  return true;
+}
+
+} // namespace ns3
@@ -0,0 +1,132 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef MAPPED_TEXT_FILE_H
+#define MAPPED_TEXT_FILE_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <stdint.h>
+
+namespace ns3 {
+
+/**
+ * \brief Read-only text file mapped into memory, with line and token iteration without iostreams
+ *
+ * Used by topology readers to load large topology files.  Tokens point directly into the mapped
+ * file and are valid while the file object exists.
+ */
+class MappedTextFile {
+public:
+  /**
+   * \brief Part of the file (line or whitespace-separated token), not null-terminated
+   */
+  struct Token {
+    Token()
+      : data(0)
+      , size(0)
+    {
+    }
+
+    Token(const char* _data, size_t _size)
+      : data(_data)
+      , size(_size)
+    {
+    }
+
+    bool
+    empty() const
+    {
+      return size == 0;
+    }
+
+    std::string
+    ToString() const
+    {
+      return std::string(data, size);
+    }
+
+    bool
+    operator==(const char* other) const;
+
+    const char* data;
+    size_t size;
+  };
+
+  /**
+   * \brief Map file into memory
+   *
+   * IsOpen () returns false if the file cannot be opened
+   */
+  explicit MappedTextFile(const std::string& fileName);
+
+  ~MappedTextFile();
+
+  bool
+  IsOpen() const
+  {
+    return m_isOpen;
+  }
+
+  /**
+   * \brief Get the next line (without end of line characters)
+   * \return false if the end of file is reached
+   */
+  bool
+  NextLine(Token& line);
+
+  /**
+   * \brief Split line into whitespace-separated tokens
+   * \return number of tokens
+   */
+  static size_t
+  Split(const Token& line, std::vector<Token>& tokens);
+
+  /**
+   * \brief Parse floating point number
+   * \return false if the token is not a number (value is not changed)
+   */
+  static bool
+  Parse(const Token& token, double& value);
+
+  /**
+   * \brief Parse unsigned integer number
+   * \return false if the token is not a number (value is not changed)
+   */
+  static bool
+  Parse(const Token& token, uint32_t& value);
+
+private:
+  MappedTextFile(const MappedTextFile&);
+  MappedTextFile&
+  operator=(const MappedTextFile&);
+
+private:
+  bool m_isOpen;
+  const char* m_data;
+  size_t m_size;
+  size_t m_position;
+  bool m_isMapped;          ///< \brief false if the file is read into m_buffer instead
+  std::vector<char> m_buffer;
+};
+
+} // namespace ns3
+
+#endif // MAPPED_TEXT_FILE_H
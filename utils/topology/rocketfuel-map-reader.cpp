@@ -44,6 +44,8 @@
 
 #include "ns3/mobility-model.h"
 
+#include "mapped-text-file.hpp"
+
 #include <regex.h>
 
 #include <boost/foreach.hpp>
@@ -93,15 +95,11 @@ RocketfuelMapReader::Read()
         "\\(([0-9]+)\\)" SPACE "(&[0-9]+)*" MAYSPACE "->" MAYSPACE "(<[0-9 \t<>]+>)*" MAYSPACE     \
         "(\\{-[0-9\\{\\} \t-]+\\})*" SPACE "=([A-Za-z0-9.!-]+)" SPACE "r([0-9])" MAYSPACE END
 
-void
-RocketfuelMapReader::CreateLink(string nodeName1, string nodeName2, double averageRtt,
-                                const string& minBw, const string& maxBw, const string& minDelay,
-                                const string& maxDelay)
+RocketfuelMapReader::LinkAttributes
+RocketfuelMapReader::DrawLinkAttributes(double averageRtt, const string& minBw,
+                                        const string& maxBw, const string& minDelay,
+                                        const string& maxDelay)
 {
-  Ptr<Node> node1 = Names::Find<Node>(m_path, nodeName1);
-  Ptr<Node> node2 = Names::Find<Node>(m_path, nodeName2);
-  Link link(node1, nodeName1, node2, nodeName2);
-
   DataRate randBandwidth(
     m_randVar.GetInteger(static_cast<uint32_t>(lexical_cast<DataRate>(minBw).GetBitRate()),
                          static_cast<uint32_t>(lexical_cast<DataRate>(maxBw).GetBitRate())));
@@ -116,11 +114,25 @@ RocketfuelMapReader::CreateLink(string nodeName1, string nodeName2, double avera
 
   uint32_t queue = ceil(averageRtt * (randBandwidth.GetBitRate() / 8.0 / 1100.0));
 
-  link.SetAttribute("DataRate", boost::lexical_cast<string>(randBandwidth));
-  link.SetAttribute("OSPF", boost::lexical_cast<string>(metric));
-  link.SetAttribute("Delay",
-                    boost::lexical_cast<string>(ceil(randDelay.ToDouble(Time::US))) + "us");
-  link.SetAttribute("MaxPackets", boost::lexical_cast<string>(queue));
+  LinkAttributes attributes;
+  attributes["DataRate"] = boost::lexical_cast<string>(randBandwidth);
+  attributes["OSPF"] = boost::lexical_cast<string>(metric);
+  attributes["Delay"] = boost::lexical_cast<string>(ceil(randDelay.ToDouble(Time::US))) + "us";
+  attributes["MaxPackets"] = boost::lexical_cast<string>(queue);
+  return attributes;
+}
+
+void
+RocketfuelMapReader::CreateLink(string nodeName1, string nodeName2,
+                                const LinkAttributes& attributes)
+{
+  Ptr<Node> node1 = Names::Find<Node>(m_path, nodeName1);
+  Ptr<Node> node2 = Names::Find<Node>(m_path, nodeName2);
+  Link link(node1, nodeName1, node2, nodeName2);
+
+  for (LinkAttributes::const_iterator i = attributes.begin(); i != attributes.end(); i++) {
+    link.SetAttribute(i->first, i->second);
+  }
 
   AddLink(link);
 }
@@ -269,53 +281,48 @@ RocketfuelMapReader::Read(RocketfuelParams params, bool keepOneComponent /*=true
                           bool connectBackbones /*=true*/)
 {
   m_maxNodeId = 0;
+  m_readTimes = ReadTimes();
+  Stopwatch stopwatch;
 
-  ifstream topgen;
-  topgen.open(GetFileName().c_str());
+  MappedTextFile topgen(GetFileName());
   // NodeContainer nodes;
   UniformVariable var;
 
-  istringstream lineBuffer;
+  MappedTextFile::Token token;
   string line;
-  int lineNumber = 0;
   char errbuf[512];
 
-  if (!topgen.is_open()) {
+  if (!topgen.IsOpen()) {
     NS_LOG_WARN("Couldn't open the file " << GetFileName());
     return m_nodes;
   }
 
-  while (!topgen.eof()) {
-    int ret;
+  regex_t regex;
+  int ret = regcomp(&regex, ROCKETFUEL_MAPS_LINE, REG_EXTENDED | REG_NEWLINE);
+  if (ret != 0) {
+    regerror(ret, &regex, errbuf, sizeof(errbuf));
+    regfree(&regex);
+    NS_LOG_WARN("Cannot compile maps file regex: " << errbuf);
+    return m_nodes;
+  }
+
+  while (topgen.NextLine(token)) {
     int argc;
     char* argv[REGMATCH_MAX];
     char* buf;
 
-    lineNumber++;
-    line.clear();
-    lineBuffer.clear();
-
-    getline(topgen, line);
-    buf = (char*)line.c_str();
+    // regexec needs a null-terminated string; the buffer keeps its capacity between lines
+    line.assign(token.data, token.size);
+    buf = &line[0];
 
     regmatch_t regmatch[REGMATCH_MAX];
-    regex_t regex;
-
-    ret = regcomp(&regex, ROCKETFUEL_MAPS_LINE, REG_EXTENDED | REG_NEWLINE);
-    if (ret != 0) {
-      regerror(ret, &regex, errbuf, sizeof(errbuf));
-      regfree(&regex);
-      continue;
-    }
 
     ret = regexec(&regex, buf, REGMATCH_MAX, regmatch, 0);
     if (ret == REG_NOMATCH) {
       NS_LOG_WARN("match failed (maps file): %s" << buf);
-      regfree(&regex);
       continue;
     }
 
-    line = buf;
     argc = 0;
 
     /* regmatch[0] is the entire strings that matched */
@@ -331,8 +338,8 @@ RocketfuelMapReader::Read(RocketfuelParams params, bool keepOneComponent /*=true
     }
 
     GenerateFromMapsFile(argc, argv);
-    regfree(&regex);
   }
+  regfree(&regex);
 
   if (keepOneComponent) {
     NS_LOG_DEBUG("Before eliminating disconnected nodes: " << num_vertices(m_graph));
@@ -397,9 +404,66 @@ RocketfuelMapReader::Read(RocketfuelParams params, bool keepOneComponent /*=true
     NS_LOG_DEBUG("After 2 eliminating disconnected nodes:  " << num_vertices(m_graph));
   }
 
+  // Link parameters are drawn before nodes are created, so that link delays can be used to assign
+  // nodes to partitions.  Random draws happen in the same order as link creation
+  map<Traits::vertex_descriptor, uint32_t> vertexIndex;
+  vector<string> nodeNames;
+  for (tie(v, endv) = vertices(m_graph); v != endv; v++) {
+    static const char* prefixes[] = {"", "leaf-", "gw-", "bb-"}; // names nodes get below
+
+    vertexIndex[*v] = nodeNames.size();
+    nodeNames.push_back(prefixes[get(vertex_rank, m_graph, *v)] + get(vertex_name, m_graph, *v));
+  }
+
+  vector<LinkAttributes> linkAttributes;
+  vector<pair<uint32_t, uint32_t>> linkNodes;
+  vector<string> linkDelays;
+  for (tie(e, ende) = edges(m_graph); e != ende; e++) {
+    Traits::vertex_descriptor u = source(*e, m_graph), v = target(*e, m_graph);
+
+    node_type_t u_type = get(vertex_rank, m_graph, u), v_type = get(vertex_rank, m_graph, v);
+
+    if (u_type == BACKBONE && v_type == BACKBONE) {
+      linkAttributes.push_back(DrawLinkAttributes(params.averageRtt, params.minb2bBandwidth,
+                                                  params.maxb2bBandwidth, params.minb2bDelay,
+                                                  params.maxb2bDelay));
+    }
+    else if ((u_type == GATEWAY && v_type == BACKBONE)
+             || (u_type == BACKBONE && v_type == GATEWAY)) {
+      linkAttributes.push_back(DrawLinkAttributes(params.averageRtt, params.minb2gBandwidth,
+                                                  params.maxb2gBandwidth, params.minb2gDelay,
+                                                  params.maxb2gDelay));
+    }
+    else if (u_type == GATEWAY && v_type == GATEWAY) {
+      linkAttributes.push_back(DrawLinkAttributes(params.averageRtt, params.minb2gBandwidth,
+                                                  params.maxb2gBandwidth, params.minb2gDelay,
+                                                  params.maxb2gDelay));
+    }
+    else if ((u_type == GATEWAY && v_type == CLIENT) || (u_type == CLIENT && v_type == GATEWAY)) {
+      linkAttributes.push_back(DrawLinkAttributes(params.averageRtt, params.ming2cBandwidth,
+                                                  params.maxg2cBandwidth, params.ming2cDelay,
+                                                  params.maxg2cDelay));
+    }
+    else {
+      NS_FATAL_ERROR("Wrong link type between nodes: " << u_type << " <-> " << v_type);
+    }
+
+    linkNodes.push_back(make_pair(vertexIndex[u], vertexIndex[v]));
+    linkDelays.push_back(linkAttributes.back()["Delay"]);
+  }
+
+  m_readTimes.parse = stopwatch.Lap();
+
+  vector<uint32_t> systemIds(nodeNames.size(), 0);
+  if (IsPartitioningEnabled()) {
+    systemIds = PartitionNodes(nodeNames, linkNodes, linkDelays);
+  }
+
+  m_readTimes.partition = stopwatch.Lap();
+
   for (tie(v, endv) = vertices(m_graph); v != endv; v++) {
     string nodeName = get(vertex_name, m_graph, *v);
-    Ptr<Node> node = CreateNode(nodeName, 0);
+    Ptr<Node> node = CreateNode(nodeName, systemIds[vertexIndex[*v]]);
 
     node_type_t type = get(vertex_rank, m_graph, *v);
     switch (type) {
@@ -424,37 +488,20 @@ RocketfuelMapReader::Read(RocketfuelParams params, bool keepOneComponent /*=true
     }
   }
 
-  for (tie(e, ende) = edges(m_graph); e != ende; e++) {
-    Traits::vertex_descriptor u = source(*e, m_graph), v = target(*e, m_graph);
+  m_readTimes.nodes = stopwatch.Lap();
 
-    node_type_t u_type = get(vertex_rank, m_graph, u), v_type = get(vertex_rank, m_graph, v);
+  size_t linkIndex = 0;
+  for (tie(e, ende) = edges(m_graph); e != ende; e++, linkIndex++) {
+    Traits::vertex_descriptor u = source(*e, m_graph), v = target(*e, m_graph);
 
     string u_name = get(vertex_name, m_graph, u), v_name = get(vertex_name, m_graph, v);
-
-    if (u_type == BACKBONE && v_type == BACKBONE) {
-      CreateLink(u_name, v_name, params.averageRtt, params.minb2bBandwidth, params.maxb2bBandwidth,
-                 params.minb2bDelay, params.maxb2bDelay);
-    }
-    else if ((u_type == GATEWAY && v_type == BACKBONE)
-             || (u_type == BACKBONE && v_type == GATEWAY)) {
-      CreateLink(u_name, v_name, params.averageRtt, params.minb2gBandwidth, params.maxb2gBandwidth,
-                 params.minb2gDelay, params.maxb2gDelay);
-    }
-    else if (u_type == GATEWAY && v_type == GATEWAY) {
-      CreateLink(u_name, v_name, params.averageRtt, params.minb2gBandwidth, params.maxb2gBandwidth,
-                 params.minb2gDelay, params.maxb2gDelay);
-    }
-    else if ((u_type == GATEWAY && v_type == CLIENT) || (u_type == CLIENT && v_type == GATEWAY)) {
-      CreateLink(u_name, v_name, params.averageRtt, params.ming2cBandwidth, params.maxg2cBandwidth,
-                 params.ming2cDelay, params.maxg2cDelay);
-    }
-    else {
-      NS_FATAL_ERROR("Wrong link type between nodes: " << u_type << " <-> " << v_type);
-    }
+    CreateLink(u_name, v_name, linkAttributes[linkIndex]);
   }
 
   ApplySettings();
 
+  m_readTimes.links = stopwatch.Lap();
+
   NS_LOG_INFO("Clients:   " << m_customerRouters.GetN());
   NS_LOG_INFO("Gateways:  " << m_gatewayRouters.GetN());
   NS_LOG_INFO("Backbones: " << m_backboneRouters.GetN());
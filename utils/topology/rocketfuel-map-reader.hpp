@@ -134,9 +134,14 @@ private:
   void
   GenerateFromMapsFile(int argc, char* argv[]);
 
+  typedef std::map<std::string, std::string> LinkAttributes;
+
+  LinkAttributes
+  DrawLinkAttributes(double averageRtt, const string& minBw, const string& maxBw,
+                     const string& minDelay, const string& maxDelay);
+
   void
-  CreateLink(string nodeName1, string nodeName2, double averageRtt, const string& minBw,
-             const string& maxBw, const string& minDelay, const string& maxDelay);
+  CreateLink(string nodeName1, string nodeName2, const LinkAttributes& attributes);
   void
   KeepOnlyBiggestConnectedComponent();
 
@@ -0,0 +1,367 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "topology-partitioner.hpp"
+
+#include "ns3/log.h"
+#include "ns3/assert.h"
+#include "ns3/fatal-error.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <set>
+
+NS_LOG_COMPONENT_DEFINE("TopologyPartitioner");
+
+namespace ns3 {
+
+static const uint32_t MAX_REFINEMENT_PASSES = 16;
+
+TopologyPartitioner::TopologyPartitioner(uint32_t nPartitions, double imbalance /* = 0.1*/)
+  : m_nPartitions(std::max<uint32_t>(nPartitions, 1))
+  , m_imbalance(imbalance)
+  , m_lookahead(Time::Max())
+  , m_cutSize(0)
+{
+}
+
+uint32_t
+TopologyPartitioner::AddNode(double weight /* = 1.0*/)
+{
+  m_weights.push_back(weight);
+  return m_weights.size() - 1;
+}
+
+void
+TopologyPartitioner::AddLink(uint32_t from, uint32_t to, const Time& delay)
+{
+  NS_ASSERT(from < m_weights.size() && to < m_weights.size());
+  if (from == to)
+    return;
+
+  Link link = {from, to, delay};
+  m_links.push_back(link);
+}
+
+std::vector<uint32_t>
+TopologyPartitioner::Partition()
+{
+  std::vector<uint32_t> partitions(m_weights.size(), 0);
+  m_lookahead = Time::Max();
+  m_cutSize = 0;
+
+  if (m_nPartitions == 1 || m_weights.empty())
+    return partitions;
+
+  if (m_weights.size() < m_nPartitions) {
+    NS_FATAL_ERROR("Cannot split " << m_weights.size() << " nodes into " << m_nPartitions
+                                   << " partitions");
+  }
+
+  // Candidate lookahead thresholds.  The smallest one does not contract any link, so it is used
+  // as the best effort fallback
+  std::vector<Time> thresholds;
+  for (const Link& link : m_links) {
+    thresholds.push_back(link.delay);
+  }
+  std::sort(thresholds.begin(), thresholds.end());
+  thresholds.erase(std::unique(thresholds.begin(), thresholds.end()), thresholds.end());
+  if (thresholds.empty())
+    thresholds.push_back(Time(0));
+
+  bool isBalanced = TryPartition(thresholds[0], partitions);
+
+  // larger threshold contracts more links, making balancing harder
+  size_t lo = 0, hi = thresholds.size() - 1;
+  std::vector<uint32_t> candidate;
+  while (lo < hi) {
+    size_t mid = (lo + hi + 1) / 2;
+    if (TryPartition(thresholds[mid], candidate)) {
+      lo = mid;
+      partitions.swap(candidate);
+      isBalanced = true;
+    }
+    else {
+      hi = mid - 1;
+    }
+  }
+
+  if (!isBalanced) {
+    NS_LOG_WARN("Could not satisfy balance constraint for " << m_nPartitions << " partitions");
+  }
+
+  for (const Link& link : m_links) {
+    if (partitions[link.from] != partitions[link.to]) {
+      m_cutSize++;
+      m_lookahead = std::min(m_lookahead, link.delay);
+    }
+  }
+
+  NS_LOG_INFO("Topology split into " << m_nPartitions << " partitions, " << m_cutSize
+                                     << " cross-partition links, lookahead " << m_lookahead);
+  return partitions;
+}
+
+Time
+TopologyPartitioner::GetLookahead() const
+{
+  return m_lookahead;
+}
+
+uint32_t
+TopologyPartitioner::GetCutSize() const
+{
+  return m_cutSize;
+}
+
+bool
+TopologyPartitioner::TryPartition(const Time& threshold, std::vector<uint32_t>& partitions) const
+{
+  uint32_t nNodes = m_weights.size();
+
+  // contract links that are not allowed to cross partitions
+  std::vector<uint32_t> parent(nNodes);
+  std::iota(parent.begin(), parent.end(), 0);
+
+  auto findRoot = [&parent](uint32_t node) {
+    while (parent[node] != node) {
+      parent[node] = parent[parent[node]];
+      node = parent[node];
+    }
+    return node;
+  };
+
+  for (const Link& link : m_links) {
+    if (link.delay < threshold) {
+      uint32_t a = findRoot(link.from);
+      uint32_t b = findRoot(link.to);
+      if (a != b)
+        parent[std::max(a, b)] = std::min(a, b);
+    }
+  }
+
+  std::vector<uint32_t> component(nNodes);
+  std::vector<uint32_t> componentIndex(nNodes, std::numeric_limits<uint32_t>::max());
+  std::vector<double> weights;
+  double totalWeight = 0;
+  double maxNodeWeight = 0;
+  for (uint32_t node = 0; node < nNodes; node++) {
+    uint32_t root = findRoot(node);
+    if (componentIndex[root] == std::numeric_limits<uint32_t>::max()) {
+      componentIndex[root] = weights.size();
+      weights.push_back(0);
+    }
+    component[node] = componentIndex[root];
+    weights[component[node]] += m_weights[node];
+
+    totalWeight += m_weights[node];
+    maxNodeWeight = std::max(maxNodeWeight, m_weights[node]);
+  }
+
+  // a single node heavier than the average cannot be split
+  double maxWeight = std::max((1 + m_imbalance) * totalWeight / m_nPartitions, maxNodeWeight);
+
+  if (weights.size() < m_nPartitions
+      || *std::max_element(weights.begin(), weights.end()) > maxWeight)
+    return false;
+
+  Adjacency adjacency(weights.size());
+  for (const Link& link : m_links) {
+    uint32_t a = component[link.from];
+    uint32_t b = component[link.to];
+    if (a != b) {
+      adjacency[a][b] += 1;
+      adjacency[b][a] += 1;
+    }
+  }
+
+  std::vector<uint32_t> parts;
+  GrowPartitions(adjacency, weights, maxWeight, parts);
+  RefinePartitions(adjacency, weights, maxWeight, parts);
+
+  std::vector<double> partWeights(m_nPartitions, 0);
+  std::vector<uint32_t> partSizes(m_nPartitions, 0);
+  for (uint32_t i = 0; i < parts.size(); i++) {
+    partWeights[parts[i]] += weights[i];
+    partSizes[parts[i]]++;
+  }
+
+  partitions.resize(nNodes);
+  for (uint32_t node = 0; node < nNodes; node++) {
+    partitions[node] = parts[component[node]];
+  }
+
+  for (uint32_t part = 0; part < m_nPartitions; part++) {
+    if (partSizes[part] == 0 || partWeights[part] > maxWeight * (1 + 1e-9))
+      return false;
+  }
+  return true;
+}
+
+void
+TopologyPartitioner::GrowPartitions(const Adjacency& adjacency, const std::vector<double>& weights,
+                                    double maxWeight, std::vector<uint32_t>& parts) const
+{
+  uint32_t n = weights.size();
+  const uint32_t unassigned = m_nPartitions;
+  parts.assign(n, unassigned);
+
+  uint32_t nUnassigned = n;
+  double remainingWeight = std::accumulate(weights.begin(), weights.end(), 0.0);
+
+  for (uint32_t part = 0; part + 1 < m_nPartitions; part++) {
+    double target = remainingWeight / (m_nPartitions - part);
+    double weight = 0;
+
+    // candidates ordered by decreasing connectivity to the partition, then by index
+    std::set<std::pair<double, uint32_t>> frontier;
+    std::map<uint32_t, double> connectivity;
+
+    // leave at least one vertex for every remaining partition
+    while (weight < target && nUnassigned > m_nPartitions - part - 1) {
+      uint32_t vertex = n;
+      while (!frontier.empty()) {
+        uint32_t candidate = frontier.begin()->second;
+        frontier.erase(frontier.begin());
+        if (weight + weights[candidate] <= maxWeight) {
+          vertex = candidate;
+          break;
+        }
+      }
+
+      if (vertex == n) {
+        // new seed: the most peripheral unassigned vertex that fits
+        uint32_t minDegree = std::numeric_limits<uint32_t>::max();
+        for (uint32_t i = 0; i < n; i++) {
+          if (parts[i] != unassigned || weight + weights[i] > maxWeight)
+            continue;
+
+          uint32_t degree = 0;
+          for (const auto& neighbor : adjacency[i]) {
+            if (parts[neighbor.first] == unassigned)
+              degree++;
+          }
+          if (degree < minDegree) {
+            minDegree = degree;
+            vertex = i;
+          }
+        }
+      }
+
+      if (vertex == n)
+        break;
+
+      parts[vertex] = part;
+      weight += weights[vertex];
+      nUnassigned--;
+
+      for (const auto& neighbor : adjacency[vertex]) {
+        if (parts[neighbor.first] != unassigned)
+          continue;
+
+        double& gain = connectivity[neighbor.first];
+        frontier.erase(std::make_pair(-gain, neighbor.first));
+        gain += neighbor.second;
+        frontier.insert(std::make_pair(-gain, neighbor.first));
+      }
+    }
+
+    remainingWeight -= weight;
+  }
+
+  for (uint32_t i = 0; i < n; i++) {
+    if (parts[i] == unassigned)
+      parts[i] = m_nPartitions - 1;
+  }
+}
+
+void
+TopologyPartitioner::RefinePartitions(const Adjacency& adjacency,
+                                      const std::vector<double>& weights, double maxWeight,
+                                      std::vector<uint32_t>& parts) const
+{
+  uint32_t n = weights.size();
+
+  std::vector<double> partWeights(m_nPartitions, 0);
+  std::vector<uint32_t> partSizes(m_nPartitions, 0);
+  for (uint32_t i = 0; i < n; i++) {
+    partWeights[parts[i]] += weights[i];
+    partSizes[parts[i]]++;
+  }
+
+  for (uint32_t pass = 0; pass < MAX_REFINEMENT_PASSES; pass++) {
+    bool isMoved = false;
+
+    for (uint32_t vertex = 0; vertex < n; vertex++) {
+      uint32_t from = parts[vertex];
+      if (partSizes[from] == 1)
+        continue;
+
+      std::map<uint32_t, double> connectivity;
+      for (const auto& neighbor : adjacency[vertex]) {
+        connectivity[parts[neighbor.first]] += neighbor.second;
+      }
+      double internal = connectivity[from];
+
+      bool isOverloaded = partWeights[from] > maxWeight;
+      if (isOverloaded) {
+        // allow moving to the lightest partition, even if not adjacent
+        uint32_t lightest =
+          std::min_element(partWeights.begin(), partWeights.end()) - partWeights.begin();
+        connectivity.insert(std::make_pair(lightest, 0.0));
+      }
+
+      uint32_t best = from;
+      double bestGain = 0;
+      for (const auto& target : connectivity) {
+        uint32_t to = target.first;
+        if (to == from || partWeights[to] + weights[vertex] > maxWeight)
+          continue;
+
+        double gain = target.second - internal;
+        if (!isOverloaded) {
+          // either reduce the cut, or keep the cut and improve the balance
+          if (gain < 0 || (gain == 0 && partWeights[to] + weights[vertex] >= partWeights[from]))
+            continue;
+        }
+
+        if (best == from || gain > bestGain
+            || (gain == bestGain && partWeights[to] < partWeights[best])) {
+          best = to;
+          bestGain = gain;
+        }
+      }
+
+      if (best != from) {
+        parts[vertex] = best;
+        partWeights[from] -= weights[vertex];
+        partWeights[best] += weights[vertex];
+        partSizes[from]--;
+        partSizes[best]++;
+        isMoved = true;
+      }
+    }
+
+    if (!isMoved)
+      break;
+  }
+}
+
+} // namespace ns3
@@ -0,0 +1,128 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef TOPOLOGY_PARTITIONER_H
+#define TOPOLOGY_PARTITIONER_H
+
+#include "ns3/nstime.h"
+
+#include <vector>
+#include <map>
+
+namespace ns3 {
+
+/**
+ * \brief Partitioner of topology graph for distributed (MPI) simulation
+ *
+ * Assigns every node to one of the partitions (systemIds), so that:
+ * - minimal delay of links crossing partitions (lookahead of the distributed simulator) is as
+ *   large as possible,
+ * - total weight of nodes in every partition does not exceed (1 + imbalance) of the average
+ *   (node weights should reflect expected load, e.g., number of consumers attached to the node),
+ * - number of links crossing partitions is small.
+ *
+ * Links with delays below the selected lookahead threshold are contracted, and the highest
+ * threshold (binary search over distinct link delays) for which the contracted graph can be
+ * balanced is used.  The contracted graph is partitioned using greedy graph growing, followed by
+ * boundary refinement that moves nodes between partitions to reduce the cut and fix imbalance.
+ *
+ * The result depends only on the input graph, so every MPI rank computes the same assignment.
+ */
+class TopologyPartitioner {
+public:
+  /**
+   * \param nPartitions number of partitions (e.g., MpiInterface::GetSize ())
+   * \param imbalance allowed relative excess of partition weight over the average
+   */
+  TopologyPartitioner(uint32_t nPartitions, double imbalance = 0.1);
+
+  /**
+   * \brief Add node to the graph
+   * \return index of the added node (nodes are indexed in order of addition)
+   */
+  uint32_t
+  AddNode(double weight = 1.0);
+
+  /**
+   * \brief Add undirected link between nodes
+   */
+  void
+  AddLink(uint32_t from, uint32_t to, const Time& delay);
+
+  /**
+   * \brief Calculate partitioning
+   * \return partition (systemId) for every node
+   */
+  std::vector<uint32_t>
+  Partition();
+
+  /**
+   * \brief Get minimal delay of links crossing partitions after Partition () call
+   *
+   * Time::Max () is returned if no link crosses partitions
+   */
+  Time
+  GetLookahead() const;
+
+  /**
+   * \brief Get number of links crossing partitions after Partition () call
+   */
+  uint32_t
+  GetCutSize() const;
+
+private:
+  struct Link {
+    uint32_t from;
+    uint32_t to;
+    Time delay;
+  };
+
+  typedef std::vector<std::map<uint32_t, double>> Adjacency;
+
+  /**
+   * \brief Try to partition graph with links faster than threshold contracted
+   * \param threshold links with delay below threshold are not allowed to cross partitions
+   * \param[out] partitions resulting partition for every node
+   * \return true if partitioning satisfies the balance constraint
+   */
+  bool
+  TryPartition(const Time& threshold, std::vector<uint32_t>& partitions) const;
+
+  void
+  GrowPartitions(const Adjacency& adjacency, const std::vector<double>& weights, double maxWeight,
+                 std::vector<uint32_t>& parts) const;
+
+  void
+  RefinePartitions(const Adjacency& adjacency, const std::vector<double>& weights,
+                   double maxWeight, std::vector<uint32_t>& parts) const;
+
+private:
+  uint32_t m_nPartitions;
+  double m_imbalance;
+
+  std::vector<double> m_weights;
+  std::vector<Link> m_links;
+
+  Time m_lookahead;
+  uint32_t m_cutSize;
+};
+
+} // namespace ns3
+
+#endif // TOPOLOGY_PARTITIONER_H
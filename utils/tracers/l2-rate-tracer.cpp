@@ -44,6 +44,19 @@ L2RateTracer::Destroy()
   g_tracers.clear();
 }
 
+ndn::TableMemoryUsage
+L2RateTracer::GetMemoryUsage()
+{
+  ndn::TableMemoryUsage usage;
+  for (const auto& group : g_tracers) {
+    for (const Ptr<L2RateTracer>& tracer : std::get<1>(group)) {
+      usage.nEntries++;
+      usage.nBytes += sizeof(L2RateTracer) + tracer->m_node.capacity();
+    }
+  }
+  return usage;
+}
+
 void
 L2RateTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds (0.5)*/)
 {
@@ -22,6 +22,7 @@
 
 #include "l2-tracer.hpp"
 
+#include "ns3/ndnSIM/utils/ndn-memory-accounting.hpp"
 #include "ns3/nstime.h"
 #include "ns3/event-id.h"
 
@@ -69,6 +70,12 @@ public:
   static void
   Destroy();
 
+  /**
+   * @brief Estimate memory used by all statically created tracers (see MemoryAccounting)
+   */
+  static ndn::TableMemoryUsage
+  GetMemoryUsage();
+
   void
   SetAveragingPeriod(const Time& period);
 
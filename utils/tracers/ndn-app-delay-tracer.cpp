@@ -48,6 +48,19 @@ AppDelayTracer::Destroy()
   g_tracers.clear();
 }
 
+TableMemoryUsage
+AppDelayTracer::GetMemoryUsage()
+{
+  TableMemoryUsage usage;
+  for (const auto& group : g_tracers) {
+    for (const Ptr<AppDelayTracer>& tracer : std::get<1>(group)) {
+      usage.nEntries++;
+      usage.nBytes += sizeof(AppDelayTracer) + tracer->m_node.capacity();
+    }
+  }
+  return usage;
+}
+
 void
 AppDelayTracer::InstallAll(const std::string& file)
 {
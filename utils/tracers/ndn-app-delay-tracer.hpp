@@ -21,6 +21,7 @@
 #define CCNX_APP_DELAY_TRACER_H
 
 #include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/utils/ndn-memory-accounting.hpp"
 
 #include "ns3/ptr.h"
 #include "ns3/simple-ref-count.h"
@@ -113,6 +114,12 @@ public:
   static void
   Destroy();
 
+  /**
+   * @brief Estimate memory used by all statically created tracers (see MemoryAccounting)
+   */
+  static TableMemoryUsage
+  GetMemoryUsage();
+
   /**
    * @brief Trace constructor that attaches to all applications on the node using node's pointer
    * @param os    reference to the output stream
@@ -24,8 +24,7 @@
 #include "ns3/names.h"
 #include "ns3/callback.h"
 
-#include "apps/ndn-app.hpp"
-#include "model/cs/ndn-content-store.hpp"
+#include "model/ndn-l3-protocol.hpp"
 #include "ns3/simulator.h"
 #include "ns3/node-list.h"
 #include "ns3/log.h"
@@ -41,37 +40,71 @@ namespace ndn {
 
 static std::list<std::tuple<shared_ptr<std::ostream>, std::list<Ptr<CsTracer>>>> g_tracers;
 
+static shared_ptr<std::ostream>
+openOutputStream(const std::string& file)
+{
+  if (file == "-") {
+    return shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
+  }
+
+  shared_ptr<std::ofstream> os(new std::ofstream());
+  os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+
+  if (!os->is_open()) {
+    NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+    return nullptr;
+  }
+
+  return os;
+}
+
 void
 CsTracer::Destroy()
 {
   g_tracers.clear();
 }
 
+TableMemoryUsage
+CsTracer::GetMemoryUsage()
+{
+  TableMemoryUsage usage;
+  for (const auto& group : g_tracers) {
+    for (const Ptr<CsTracer>& tracer : std::get<1>(group)) {
+      usage.nEntries++;
+      usage.nBytes += sizeof(CsTracer) + tracer->m_node.capacity();
+
+      cs::PrefixStatsTrie::parent_trie::const_recursive_iterator
+        item(tracer->m_prefixStats.getTrie()), end(0);
+      for (; item != end; item++) {
+        usage.nBytes += sizeof(cs::PrefixStatsTrie::parent_trie);
+        if (item->payload() != 0)
+          usage.nBytes += sizeof(cs::PrefixStats)
+                          + MemoryAccounting::EstimateNameSize(item->payload()->m_prefix);
+      }
+
+      if (tracer->m_reuseDistances != nullptr)
+        usage.nBytes += sizeof(ReuseDistanceHistogram) + tracer->m_reuseDistances->GetMemoryUsage();
+    }
+  }
+  return usage;
+}
+
 void
-CsTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds (0.5)*/)
+CsTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds (0.5)*/,
+                     size_t prefixLength /* = 0*/, double samplingRate /* = 0*/)
 {
   using namespace boost;
   using namespace std;
 
   std::list<Ptr<CsTracer>> tracers;
-  shared_ptr<std::ostream> outputStream;
-  if (file != "-") {
-    shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
-
-    if (!os->is_open()) {
-      NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
-      return;
-    }
-
-    outputStream = os;
-  }
-  else {
-    outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
+  shared_ptr<std::ostream> outputStream = openOutputStream(file);
+  if (outputStream == nullptr) {
+    return;
   }
 
   for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
-    Ptr<CsTracer> trace = Install(*node, outputStream, averagingPeriod);
+    Ptr<CsTracer> trace = Install(*node, outputStream, averagingPeriod, prefixLength,
+                                  samplingRate);
     tracers.push_back(trace);
   }
 
@@ -86,30 +119,21 @@ CsTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds
 
 void
 CsTracer::Install(const NodeContainer& nodes, const std::string& file,
-                  Time averagingPeriod /* = Seconds (0.5)*/)
+                  Time averagingPeriod /* = Seconds (0.5)*/, size_t prefixLength /* = 0*/,
+                  double samplingRate /* = 0*/)
 {
   using namespace boost;
   using namespace std;
 
   std::list<Ptr<CsTracer>> tracers;
-  shared_ptr<std::ostream> outputStream;
-  if (file != "-") {
-    shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
-
-    if (!os->is_open()) {
-      NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
-      return;
-    }
-
-    outputStream = os;
-  }
-  else {
-    outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
+  shared_ptr<std::ostream> outputStream = openOutputStream(file);
+  if (outputStream == nullptr) {
+    return;
   }
 
   for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++) {
-    Ptr<CsTracer> trace = Install(*node, outputStream, averagingPeriod);
+    Ptr<CsTracer> trace = Install(*node, outputStream, averagingPeriod, prefixLength,
+                                  samplingRate);
     tracers.push_back(trace);
   }
 
@@ -124,29 +148,19 @@ CsTracer::Install(const NodeContainer& nodes, const std::string& file,
 
 void
 CsTracer::Install(Ptr<Node> node, const std::string& file,
-                  Time averagingPeriod /* = Seconds (0.5)*/)
+                  Time averagingPeriod /* = Seconds (0.5)*/, size_t prefixLength /* = 0*/,
+                  double samplingRate /* = 0*/)
 {
   using namespace boost;
   using namespace std;
 
   std::list<Ptr<CsTracer>> tracers;
-  shared_ptr<std::ostream> outputStream;
-  if (file != "-") {
-    shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
-
-    if (!os->is_open()) {
-      NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
-      return;
-    }
-
-    outputStream = os;
-  }
-  else {
-    outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
+  shared_ptr<std::ostream> outputStream = openOutputStream(file);
+  if (outputStream == nullptr) {
+    return;
   }
 
-  Ptr<CsTracer> trace = Install(node, outputStream, averagingPeriod);
+  Ptr<CsTracer> trace = Install(node, outputStream, averagingPeriod, prefixLength, samplingRate);
   tracers.push_back(trace);
 
   if (tracers.size() > 0) {
@@ -160,12 +174,15 @@ CsTracer::Install(Ptr<Node> node, const std::string& file,
 
 Ptr<CsTracer>
 CsTracer::Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream,
-                  Time averagingPeriod /* = Seconds (0.5)*/)
+                  Time averagingPeriod /* = Seconds (0.5)*/, size_t prefixLength /* = 0*/,
+                  double samplingRate /* = 0*/)
 {
   NS_LOG_DEBUG("Node: " << node->GetId());
 
   Ptr<CsTracer> trace = Create<CsTracer>(outputStream, node);
   trace->SetAveragingPeriod(averagingPeriod);
+  trace->SetPrefixLength(prefixLength);
+  trace->SetReuseDistanceSampling(samplingRate);
 
   return trace;
 }
@@ -177,6 +194,7 @@ CsTracer::Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream,
 CsTracer::CsTracer(shared_ptr<std::ostream> os, Ptr<Node> node)
   : m_nodePtr(node)
   , m_os(os)
+  , m_prefixLength(0)
 {
   m_node = boost::lexical_cast<std::string>(m_nodePtr->GetId());
 
@@ -191,6 +209,7 @@ CsTracer::CsTracer(shared_ptr<std::ostream> os, Ptr<Node> node)
 CsTracer::CsTracer(shared_ptr<std::ostream> os, const std::string& node)
   : m_node(node)
   , m_os(os)
+  , m_prefixLength(0)
 {
   Connect();
 }
@@ -200,13 +219,29 @@ CsTracer::~CsTracer(){};
 void
 CsTracer::Connect()
 {
-  Ptr<ContentStore> cs = m_nodePtr->GetObject<ContentStore>();
-  cs->TraceConnectWithoutContext("CacheHits", MakeCallback(&CsTracer::CacheHits, this));
-  cs->TraceConnectWithoutContext("CacheMisses", MakeCallback(&CsTracer::CacheMisses, this));
+  Ptr<L3Protocol> l3 = L3Protocol::getL3Protocol(m_nodePtr);
+  l3->TraceConnectWithoutContext("CsHits", MakeCallback(&CsTracer::CacheHits, this));
+  l3->TraceConnectWithoutContext("CsMisses", MakeCallback(&CsTracer::CacheMisses, this));
 
   Reset();
 }
 
+void
+CsTracer::SetPrefixLength(size_t prefixLength)
+{
+  m_prefixLength = prefixLength;
+  m_prefixStats.clear();
+}
+
+void
+CsTracer::SetReuseDistanceSampling(double samplingRate)
+{
+  if (samplingRate > 0)
+    m_reuseDistances.reset(new ReuseDistanceHistogram(samplingRate));
+  else
+    m_reuseDistances.reset();
+}
+
 void
 CsTracer::SetAveragingPeriod(const Time& period)
 {
@@ -231,9 +266,14 @@ CsTracer::PrintHeader(std::ostream& os) const
      << "\t"
 
      << "Node"
-     << "\t"
+     << "\t";
+
+  if (m_prefixLength > 0) {
+    os << "Prefix"
+       << "\t";
+  }
 
-     << "Type"
+  os << "Type"
      << "\t"
      << "Packets"
      << "\t";
@@ -243,31 +283,91 @@ void
 CsTracer::Reset()
 {
   m_stats.Reset();
+
+  cs::PrefixStatsTrie::parent_trie::recursive_iterator item(m_prefixStats.getTrie()), end(0);
+  for (; item != end; item++) {
+    if (item->payload() != 0)
+      item->payload()->m_stats.Reset();
+  }
+
+  if (m_reuseDistances != nullptr)
+    m_reuseDistances->Reset();
 }
 
-#define PRINTER(printName, fieldName)                                                              \
-  os << time.ToDouble(Time::S) << "\t" << m_node << "\t" << printName << "\t" << m_stats.fieldName \
-     << "\n";
+#define PRINTER(prefix, printName, value)                                                          \
+  os << time.ToDouble(Time::S) << "\t" << m_node << "\t";                                         \
+  if (m_prefixLength > 0)                                                                          \
+    os << prefix << "\t";                                                                          \
+  os << printName << "\t" << value << "\n";
 
 void
 CsTracer::Print(std::ostream& os) const
 {
   Time time = Simulator::Now();
 
-  PRINTER("CacheHits", m_cacheHits);
-  PRINTER("CacheMisses", m_cacheMisses);
+  PRINTER("/", "CacheHits", m_stats.m_cacheHits);
+  PRINTER("/", "CacheMisses", m_stats.m_cacheMisses);
+
+  cs::PrefixStatsTrie::parent_trie::const_recursive_iterator item(m_prefixStats.getTrie()), end(0);
+  for (; item != end; item++) {
+    if (item->payload() == 0)
+      continue;
+
+    const cs::PrefixStats& prefixStats = *item->payload();
+    if (prefixStats.m_stats.m_cacheHits == 0 && prefixStats.m_stats.m_cacheMisses == 0)
+      continue;
+
+    PRINTER(prefixStats.m_prefix, "CacheHits", prefixStats.m_stats.m_cacheHits);
+    PRINTER(prefixStats.m_prefix, "CacheMisses", prefixStats.m_stats.m_cacheMisses);
+  }
+
+  if (m_reuseDistances != nullptr) {
+    const std::vector<double>& buckets = m_reuseDistances->GetBuckets();
+    for (size_t bucket = 0; bucket < buckets.size(); ++bucket) {
+      if (buckets[bucket] == 0)
+        continue;
+
+      PRINTER("/", "ReuseDistance" << ReuseDistanceHistogram::GetBucketLowerBound(bucket),
+              buckets[bucket]);
+    }
+    PRINTER("/", "ReuseCold", m_reuseDistances->GetNColdAccesses());
+  }
+}
+
+cs::Stats&
+CsTracer::GetPrefixStats(const Name& name)
+{
+  Name prefix = name.getPrefix(m_prefixLength);
+
+  cs::PrefixStatsTrie::iterator item = m_prefixStats.find_exact(prefix);
+  if (item == m_prefixStats.end()) {
+    item = m_prefixStats.insert(prefix, Create<cs::PrefixStats>(prefix)).first;
+  }
+  return item->payload()->m_stats;
 }
 
 void
-CsTracer::CacheHits(shared_ptr<const Interest>, shared_ptr<const Data>)
+CsTracer::CacheHits(const Interest& interest, const Data&)
 {
   m_stats.m_cacheHits++;
+
+  if (m_prefixLength > 0)
+    GetPrefixStats(interest.getName()).m_cacheHits++;
+
+  if (m_reuseDistances != nullptr)
+    m_reuseDistances->Access(interest.getName());
 }
 
 void
-CsTracer::CacheMisses(shared_ptr<const Interest>)
+CsTracer::CacheMisses(const Interest& interest)
 {
   m_stats.m_cacheMisses++;
+
+  if (m_prefixLength > 0)
+    GetPrefixStats(interest.getName()).m_cacheMisses++;
+
+  if (m_reuseDistances != nullptr)
+    m_reuseDistances->Access(interest.getName());
 }
 
 } // namespace ndn
@@ -21,6 +21,10 @@
 #define CCNX_CS_TRACER_H
 
 #include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/utils/ndn-memory-accounting.hpp"
+#include "ns3/ndnSIM/utils/ndn-reuse-distance-histogram.hpp"
+#include "ns3/ndnSIM/utils/trie/trie-with-policy.hpp"
+#include "ns3/ndnSIM/utils/trie/empty-policy.hpp"
 
 #include "ns3/ptr.h"
 #include "ns3/simple-ref-count.h"
@@ -31,6 +35,7 @@
 #include <tuple>
 #include <map>
 #include <list>
+#include <memory>
 
 namespace ns3 {
 
@@ -52,12 +57,34 @@ struct Stats {
   double m_cacheHits;
   double m_cacheMisses;
 };
+
+struct PrefixStats : public SimpleRefCount<PrefixStats> {
+  PrefixStats(const Name& prefix)
+    : m_prefix(prefix)
+  {
+    m_stats.Reset();
+  }
+  Name m_prefix;
+  Stats m_stats;
+};
+
+typedef ndnSIM::trie_with_policy<Name, ndnSIM::smart_pointer_payload_traits<PrefixStats>,
+                                 ndnSIM::empty_policy_traits> PrefixStatsTrie;
 /// @endcond
 }
 
 /**
  * @ingroup ndn-tracers
  * @brief NDN tracer for cache performance (hits and misses)
+ *
+ * Hits and misses are reported by the forwarder (L3Protocol "CsHits" and "CsMisses" trace
+ * sources), so the tracer works with both NFD and ndnSIM content stores.
+ *
+ * Optionally, the tracer can report:
+ * - hits and misses per name prefix of the specified length (prefix counters are kept in a
+ *   name trie and are allocated on the first lookup of each prefix),
+ * - histogram of reuse distances of the looked up names (see ReuseDistanceHistogram), computed
+ *   over the sampled subset of names.
  */
 class CsTracer : public SimpleRefCount<CsTracer> {
 public:
@@ -67,6 +94,10 @@ public:
    * @param file File to which traces will be written.  If filename is -, then std::out is used
    * @param averagingPeriod How often data will be written into the trace file (default, every half
    *second)
+   * @param prefixLength Length of name prefixes to report hits and misses for (0, default, disables
+   *per-prefix output)
+   * @param samplingRate Fraction of names sampled for the reuse distance histogram (0, default,
+   *disables the histogram)
    *
    * @returns a tuple of reference to output stream and list of tracers. !!! Attention !!! This
    *tuple needs to be preserved
@@ -74,7 +105,8 @@ public:
    *
    */
   static void
-  InstallAll(const std::string& file, Time averagingPeriod = Seconds(0.5));
+  InstallAll(const std::string& file, Time averagingPeriod = Seconds(0.5), size_t prefixLength = 0,
+             double samplingRate = 0);
 
   /**
    * @brief Helper method to install tracers on the selected simulation nodes
@@ -83,6 +115,10 @@ public:
    * @param file File to which traces will be written.  If filename is -, then std::out is used
    * @param averagingPeriod How often data will be written into the trace file (default, every half
    *second)
+   * @param prefixLength Length of name prefixes to report hits and misses for (0, default, disables
+   *per-prefix output)
+   * @param samplingRate Fraction of names sampled for the reuse distance histogram (0, default,
+   *disables the histogram)
    *
    * @returns a tuple of reference to output stream and list of tracers. !!! Attention !!! This
    *tuple needs to be preserved
@@ -90,7 +126,8 @@ public:
    *
    */
   static void
-  Install(const NodeContainer& nodes, const std::string& file, Time averagingPeriod = Seconds(0.5));
+  Install(const NodeContainer& nodes, const std::string& file, Time averagingPeriod = Seconds(0.5),
+          size_t prefixLength = 0, double samplingRate = 0);
 
   /**
    * @brief Helper method to install tracers on a specific simulation node
@@ -99,6 +136,10 @@ public:
    * @param file File to which traces will be written.  If filename is -, then std::out is used
    * @param averagingPeriod How often data will be written into the trace file (default, every half
    *second)
+   * @param prefixLength Length of name prefixes to report hits and misses for (0, default, disables
+   *per-prefix output)
+   * @param samplingRate Fraction of names sampled for the reuse distance histogram (0, default,
+   *disables the histogram)
    *
    * @returns a tuple of reference to output stream and list of tracers. !!! Attention !!! This
    *tuple needs to be preserved
@@ -106,7 +147,8 @@ public:
    *
    */
   static void
-  Install(Ptr<Node> node, const std::string& file, Time averagingPeriod = Seconds(0.5));
+  Install(Ptr<Node> node, const std::string& file, Time averagingPeriod = Seconds(0.5),
+          size_t prefixLength = 0, double samplingRate = 0);
 
   /**
    * @brief Helper method to install tracers on a specific simulation node
@@ -115,6 +157,10 @@ public:
    * @param outputStream Smart pointer to a stream
    * @param averagingPeriod How often data will be written into the trace file (default, every half
    *second)
+   * @param prefixLength Length of name prefixes to report hits and misses for (0, default, disables
+   *per-prefix output)
+   * @param samplingRate Fraction of names sampled for the reuse distance histogram (0, default,
+   *disables the histogram)
    *
    * @returns a tuple of reference to output stream and list of tracers. !!! Attention !!! This
    *tuple needs to be preserved
@@ -122,7 +168,7 @@ public:
    */
   static Ptr<CsTracer>
   Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream,
-          Time averagingPeriod = Seconds(0.5));
+          Time averagingPeriod = Seconds(0.5), size_t prefixLength = 0, double samplingRate = 0);
 
   /**
    * @brief Explicit request to remove all statically created tracers
@@ -133,6 +179,12 @@ public:
   static void
   Destroy();
 
+  /**
+   * @brief Estimate memory used by all statically created tracers (see MemoryAccounting)
+   */
+  static TableMemoryUsage
+  GetMemoryUsage();
+
   /**
    * @brief Trace constructor that attaches to the node using node pointer
    * @param os    reference to the output stream
@@ -168,15 +220,40 @@ public:
   void
   Print(std::ostream& os) const;
 
+  /**
+   * @brief Enable accounting of hits and misses per name prefix
+   *
+   * @param prefixLength number of name components of the prefix (0 disables per-prefix output)
+   *
+   * When enabled, "Prefix" column is added to the trace and node totals are reported for
+   * prefix "/"
+   */
+  void
+  SetPrefixLength(size_t prefixLength);
+
+  /**
+   * @brief Enable reuse distance histogram
+   *
+   * @param samplingRate fraction of names to sample, in (0, 1] (0 disables the histogram)
+   *
+   * Each period, non-empty buckets are reported as "ReuseDistance<lower bound>" rows and first
+   * accesses as "ReuseCold" row.  Values are scaled to the full (unsampled) stream of lookups.
+   */
+  void
+  SetReuseDistanceSampling(double samplingRate);
+
 private:
   void
   Connect();
 
   void
-  CacheHits(shared_ptr<const Interest>, shared_ptr<const Data>);
+  CacheHits(const Interest& interest, const Data&);
 
   void
-  CacheMisses(shared_ptr<const Interest>);
+  CacheMisses(const Interest& interest);
+
+  cs::Stats&
+  GetPrefixStats(const Name& name);
 
 private:
   void
@@ -197,6 +274,11 @@ private:
   Time m_period;
   EventId m_printEvent;
   cs::Stats m_stats;
+
+  size_t m_prefixLength;
+  cs::PrefixStatsTrie m_prefixStats;
+
+  std::unique_ptr<ReuseDistanceHistogram> m_reuseDistances;
 };
 
 /**
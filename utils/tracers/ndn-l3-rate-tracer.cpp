@@ -28,6 +28,8 @@
 
 #include "daemon/table/pit-entry.hpp"
 
+#include "ns3/ndnSIM/model/ndn-net-device-face.hpp"
+
 #include <fstream>
 #include <boost/lexical_cast.hpp>
 
@@ -45,6 +47,24 @@ L3RateTracer::Destroy()
   g_tracers.clear();
 }
 
+TableMemoryUsage
+L3RateTracer::GetMemoryUsage()
+{
+  static const size_t statsSize = sizeof(std::pair<const shared_ptr<const Face>,
+                                                   std::tuple<Stats, Stats, Stats, Stats>>)
+                                  + MemoryAccounting::CONTAINER_NODE_OVERHEAD;
+
+  TableMemoryUsage usage;
+  for (const auto& group : g_tracers) {
+    for (const Ptr<L3RateTracer>& tracer : std::get<1>(group)) {
+      usage.nEntries++;
+      usage.nBytes += sizeof(L3RateTracer) + tracer->m_node.capacity()
+                      + tracer->m_stats.size() * statsSize;
+    }
+  }
+  return usage;
+}
+
 void
 L3RateTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds (0.5)*/)
 {
@@ -275,6 +295,20 @@ L3RateTracer::Print(std::ostream& os) const
 
     PRINTER("OutSatisfiedInterests", m_outSatisfiedInterests);
     PRINTER("OutTimedOutInterests", m_outTimedOutInterests);
+
+    auto netDeviceFace = std::dynamic_pointer_cast<const NetDeviceFace>(stats.first);
+    if (netDeviceFace != nullptr && netDeviceFace->IsInterestShapingEnabled()) {
+      PRINTER("ShapedInterests", m_shapedInterests);
+      PRINTER("DroppedInterests", m_droppedInterests);
+
+      // backlog is an instantaneous value, not a rate
+      double backlog = netDeviceFace->GetInterestBacklog();
+      double backlogKilobytes = netDeviceFace->GetInterestBacklogBytes() / 1024.0;
+      os << time.ToDouble(Time::S) << "\t" << m_node << "\t" << stats.first->getId() << "\t"
+         << stats.first->getLocalUri() << "\t"
+         << "InterestBacklog\t" << backlog << "\t" << backlogKilobytes << "\t" << backlog << "\t"
+         << backlogKilobytes << "\n";
+    }
   }
 
   {
@@ -342,6 +376,26 @@ L3RateTracer::SatisfiedInterests(const nfd::pit::Entry& entry, const Face&, cons
   }
 }
 
+void
+L3RateTracer::ShapedInterests(const Interest& interest, const Face& face)
+{
+  std::get<0>(m_stats[face.shared_from_this()]).m_shapedInterests++;
+  if (interest.hasWire()) {
+    std::get<1>(m_stats[face.shared_from_this()]).m_shapedInterests +=
+      interest.wireEncode().size();
+  }
+}
+
+void
+L3RateTracer::DroppedInterests(const Interest& interest, const Face& face)
+{
+  std::get<0>(m_stats[face.shared_from_this()]).m_droppedInterests++;
+  if (interest.hasWire()) {
+    std::get<1>(m_stats[face.shared_from_this()]).m_droppedInterests +=
+      interest.wireEncode().size();
+  }
+}
+
 void
 L3RateTracer::TimedOutInterests(const nfd::pit::Entry& entry)
 {
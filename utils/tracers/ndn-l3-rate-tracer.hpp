@@ -21,6 +21,7 @@
 #define CCNX_RATE_L3_TRACER_H
 
 #include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/utils/ndn-memory-accounting.hpp"
 
 #include "ndn-l3-tracer.hpp"
 
@@ -83,6 +84,12 @@ public:
   static void
   Destroy();
 
+  /**
+   * @brief Estimate memory used by all statically created tracers (see MemoryAccounting)
+   */
+  static TableMemoryUsage
+  GetMemoryUsage();
+
   /**
    * @brief Trace constructor that attaches to the node using node pointer
    * @param os    reference to the output stream
@@ -145,6 +152,12 @@ protected:
   virtual void
   TimedOutInterests(const nfd::pit::Entry&);
 
+  virtual void
+  ShapedInterests(const Interest& interest, const Face& face);
+
+  virtual void
+  DroppedInterests(const Interest& interest, const Face& face);
+
 private:
   void
   SetAveragingPeriod(const Time& period);
@@ -68,6 +68,22 @@ L3Tracer::Connect()
 
   l3->TraceConnectWithoutContext("TimedOutInterests",
                                  MakeCallback(&L3Tracer::TimedOutInterests, this));
+
+  // Interest shaping on NetDeviceFaces
+  l3->TraceConnectWithoutContext("ShapedInterests",
+                                 MakeCallback(&L3Tracer::ShapedInterests, this));
+  l3->TraceConnectWithoutContext("DroppedInterests",
+                                 MakeCallback(&L3Tracer::DroppedInterests, this));
+}
+
+void
+L3Tracer::ShapedInterests(const Interest&, const Face&)
+{
+}
+
+void
+L3Tracer::DroppedInterests(const Interest&, const Face&)
+{
 }
 
 } // namespace ndn
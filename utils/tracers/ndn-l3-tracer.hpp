@@ -100,6 +100,18 @@ protected:
   virtual void
   TimedOutInterests(const nfd::pit::Entry&) = 0;
 
+  /**
+   * @brief Interest queued by NetDeviceFace Interest shaper (no-op by default)
+   */
+  virtual void
+  ShapedInterests(const Interest&, const Face&);
+
+  /**
+   * @brief Interest dropped by NetDeviceFace Interest shaper (no-op by default)
+   */
+  virtual void
+  DroppedInterests(const Interest&, const Face&);
+
 protected:
   std::string m_node;
   Ptr<Node> m_nodePtr;
@@ -117,6 +129,9 @@ protected:
 
       m_outSatisfiedInterests = 0;
       m_outTimedOutInterests = 0;
+
+      m_shapedInterests = 0;
+      m_droppedInterests = 0;
     }
 
     double m_inInterests;
@@ -127,6 +142,8 @@ protected:
     double m_timedOutInterests;
     double m_outSatisfiedInterests;
     double m_outTimedOutInterests;
+    double m_shapedInterests;
+    double m_droppedInterests;
   };
 };
 
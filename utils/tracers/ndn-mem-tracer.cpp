@@ -0,0 +1,217 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-mem-tracer.hpp"
+#include "ns3/node.h"
+#include "ns3/names.h"
+#include "ns3/simulator.h"
+#include "ns3/node-list.h"
+#include "ns3/log.h"
+
+#include <boost/lexical_cast.hpp>
+
+#include <fstream>
+
+NS_LOG_COMPONENT_DEFINE("ndn.MemTracer");
+
+namespace ns3 {
+namespace ndn {
+
+static std::list<std::tuple<shared_ptr<std::ostream>, std::list<Ptr<MemTracer>>>> g_tracers;
+
+static shared_ptr<std::ostream>
+OpenOutputStream(const std::string& file)
+{
+  if (file == "-") {
+    return shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
+  }
+
+  shared_ptr<std::ofstream> os(new std::ofstream());
+  os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+
+  if (!os->is_open()) {
+    NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+    return nullptr;
+  }
+
+  return os;
+}
+
+void
+MemTracer::Destroy()
+{
+  g_tracers.clear();
+}
+
+TableMemoryUsage
+MemTracer::GetMemoryUsage()
+{
+  TableMemoryUsage usage;
+  for (const auto& group : g_tracers) {
+    for (const Ptr<MemTracer>& tracer : std::get<1>(group)) {
+      usage.nEntries++;
+      usage.nBytes += sizeof(MemTracer) + tracer->m_node.capacity();
+    }
+  }
+  return usage;
+}
+
+void
+MemTracer::InstallAll(const std::string& file, Time period /* = Seconds (1.0)*/)
+{
+  shared_ptr<std::ostream> outputStream = OpenOutputStream(file);
+  if (outputStream == nullptr)
+    return;
+
+  std::list<Ptr<MemTracer>> tracers;
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    tracers.push_back(Install(*node, outputStream, period));
+  }
+
+  InstallGroup(tracers, outputStream);
+}
+
+void
+MemTracer::Install(const NodeContainer& nodes, const std::string& file,
+                   Time period /* = Seconds (1.0)*/)
+{
+  shared_ptr<std::ostream> outputStream = OpenOutputStream(file);
+  if (outputStream == nullptr)
+    return;
+
+  std::list<Ptr<MemTracer>> tracers;
+  for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++) {
+    tracers.push_back(Install(*node, outputStream, period));
+  }
+
+  InstallGroup(tracers, outputStream);
+}
+
+void
+MemTracer::Install(Ptr<Node> node, const std::string& file, Time period /* = Seconds (1.0)*/)
+{
+  shared_ptr<std::ostream> outputStream = OpenOutputStream(file);
+  if (outputStream == nullptr)
+    return;
+
+  std::list<Ptr<MemTracer>> tracers;
+  tracers.push_back(Install(node, outputStream, period));
+
+  InstallGroup(tracers, outputStream);
+}
+
+Ptr<MemTracer>
+MemTracer::Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream,
+                   Time period /* = Seconds (1.0)*/)
+{
+  NS_LOG_DEBUG("Node: " << node->GetId());
+
+  Ptr<MemTracer> trace = Create<MemTracer>(outputStream, node);
+  trace->SetPeriod(period);
+
+  return trace;
+}
+
+void
+MemTracer::InstallGroup(std::list<Ptr<MemTracer>>& tracers, shared_ptr<std::ostream> outputStream)
+{
+  if (tracers.size() > 0) {
+    tracers.front()->m_printGlobal = true;
+
+    tracers.front()->PrintHeader(*outputStream);
+    *outputStream << "\n";
+  }
+
+  g_tracers.push_back(std::make_tuple(outputStream, tracers));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+MemTracer::MemTracer(shared_ptr<std::ostream> os, Ptr<Node> node)
+  : m_nodePtr(node)
+  , m_os(os)
+  , m_printGlobal(false)
+{
+  m_node = boost::lexical_cast<std::string>(m_nodePtr->GetId());
+
+  std::string name = Names::FindName(node);
+  if (!name.empty()) {
+    m_node = name;
+  }
+}
+
+MemTracer::~MemTracer()
+{
+  m_printEvent.Cancel();
+}
+
+void
+MemTracer::SetPeriod(const Time& period)
+{
+  m_period = period;
+  m_printEvent.Cancel();
+  m_printEvent = Simulator::Schedule(m_period, &MemTracer::PeriodicPrinter, this);
+}
+
+void
+MemTracer::PeriodicPrinter()
+{
+  Print(*m_os);
+
+  m_printEvent = Simulator::Schedule(m_period, &MemTracer::PeriodicPrinter, this);
+}
+
+void
+MemTracer::PrintHeader(std::ostream& os) const
+{
+  os << "Time"
+     << "\t"
+
+     << "Node"
+     << "\t"
+
+     << "Table"
+     << "\t"
+     << "Entries"
+     << "\t"
+     << "Bytes";
+}
+
+void
+MemTracer::Print(std::ostream& os) const
+{
+  Time time = Simulator::Now();
+
+  for (const auto& table : MemoryAccounting::Collect(m_nodePtr)) {
+    os << time.ToDouble(Time::S) << "\t" << m_node << "\t" << table.first << "\t"
+       << table.second.nEntries << "\t" << table.second.nBytes << "\n";
+  }
+
+  if (m_printGlobal) {
+    for (const auto& table : MemoryAccounting::CollectGlobal()) {
+      os << time.ToDouble(Time::S) << "\t*\t" << table.first << "\t"
+         << table.second.nEntries << "\t" << table.second.nBytes << "\n";
+    }
+  }
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,167 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_MEM_TRACER_H
+#define NDN_MEM_TRACER_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/utils/ndn-memory-accounting.hpp"
+
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+#include <ns3/nstime.h>
+#include <ns3/event-id.h>
+#include <ns3/node-container.h>
+
+#include <tuple>
+#include <list>
+
+namespace ns3 {
+
+class Node;
+
+namespace ndn {
+
+/**
+ * @ingroup ndn-tracers
+ * @brief NDN tracer for per-table memory usage (entries and estimated bytes)
+ *
+ * Every period the tracer writes one line per NFD table (NameTree, Fib, Pit, Cs, Measurements,
+ * StrategyChoice, DeadNonceList), the ndnSIM content store (if used), and the aggregated
+ * bookkeeping of NDN applications installed on the node.  The first tracer of each installed
+ * group additionally reports process-wide structures with node name "*".
+ *
+ * @see MemoryAccounting
+ */
+class MemTracer : public SimpleRefCount<MemTracer> {
+public:
+  /**
+   * @brief Helper method to install tracers on all simulation nodes
+   *
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param period How often data will be written into the trace file (default, every second)
+   */
+  static void
+  InstallAll(const std::string& file, Time period = Seconds(1.0));
+
+  /**
+   * @brief Helper method to install tracers on the selected simulation nodes
+   *
+   * @param nodes Nodes on which to install tracer
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param period How often data will be written into the trace file (default, every second)
+   */
+  static void
+  Install(const NodeContainer& nodes, const std::string& file, Time period = Seconds(1.0));
+
+  /**
+   * @brief Helper method to install tracers on a specific simulation node
+   *
+   * @param node Node on which to install tracer
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param period How often data will be written into the trace file (default, every second)
+   */
+  static void
+  Install(Ptr<Node> node, const std::string& file, Time period = Seconds(1.0));
+
+  /**
+   * @brief Helper method to install tracers on a specific simulation node
+   *
+   * @param node Node on which to install tracer
+   * @param outputStream Smart pointer to a stream
+   * @param period How often data will be written into the trace file (default, every second)
+   */
+  static Ptr<MemTracer>
+  Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream, Time period = Seconds(1.0));
+
+  /**
+   * @brief Explicit request to remove all statically created tracers
+   */
+  static void
+  Destroy();
+
+  /**
+   * @brief Estimate memory used by all statically created tracers (see MemoryAccounting)
+   */
+  static TableMemoryUsage
+  GetMemoryUsage();
+
+  /**
+   * @brief Trace constructor that attaches to the node using node pointer
+   * @param os    reference to the output stream
+   * @param node  pointer to the node
+   */
+  MemTracer(shared_ptr<std::ostream> os, Ptr<Node> node);
+
+  ~MemTracer();
+
+  /**
+   * @brief Print head of the trace (e.g., for post-processing)
+   *
+   * @param os reference to output stream
+   */
+  void
+  PrintHeader(std::ostream& os) const;
+
+  /**
+   * @brief Print current trace data
+   *
+   * @param os reference to output stream
+   */
+  void
+  Print(std::ostream& os) const;
+
+private:
+  static void
+  InstallGroup(std::list<Ptr<MemTracer>>& tracers, shared_ptr<std::ostream> outputStream);
+
+  void
+  SetPeriod(const Time& period);
+
+  void
+  PeriodicPrinter();
+
+private:
+  std::string m_node;
+  Ptr<Node> m_nodePtr;
+
+  shared_ptr<std::ostream> m_os;
+
+  Time m_period;
+  EventId m_printEvent;
+  bool m_printGlobal;
+};
+
+/**
+ * @brief Helper to dump the trace to an output stream
+ */
+inline std::ostream&
+operator<<(std::ostream& os, const MemTracer& tracer)
+{
+  os << "# ";
+  tracer.PrintHeader(os);
+  os << "\n";
+  tracer.Print(os);
+  return os;
+}
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_MEM_TRACER_H